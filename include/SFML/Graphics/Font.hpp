@@ -29,12 +29,14 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Export.hpp>
 
+#include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Glyph.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include <SFML/System/Vector2.hpp>
 
+#include <array>
 #include <filesystem>
 #include <memory>
 #include <string>
@@ -45,16 +47,19 @@
 #include <cstdint>
 
 
-#ifdef SFML_SYSTEM_ANDROID
 namespace sf::priv
 {
+#ifdef SFML_SYSTEM_ANDROID
 class ResourceStream;
-}
 #endif
+class SkylinePacker;
+} // namespace sf::priv
 
 namespace sf
 {
 class InputStream;
+class RenderTarget;
+class Shader;
 
 ////////////////////////////////////////////////////////////
 /// \brief Class for loading and manipulating character fonts
@@ -72,6 +77,30 @@ public:
         std::string family; //!< The font family
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Statistics about the textures holding the glyphs
+    ///
+    /// \see `getAtlasStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct AtlasStatistics
+    {
+        std::size_t pageCount{};      //!< Number of glyph pages, one per character size in use
+        std::size_t glyphCount{};     //!< Number of glyphs stored in the pages
+        std::size_t textureBytes{};   //!< Graphics memory used by the page textures, in bytes
+        std::size_t occupiedPixels{}; //!< Number of texture pixels covered by glyphs and their padding
+        std::size_t totalPixels{};    //!< Number of texture pixels of all the pages
+        std::size_t evictions{};      //!< Number of pages evicted or emptied to stay within the memory budget
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Static member data
+    ////////////////////////////////////////////////////////////
+    // NOLINTBEGIN(readability-identifier-naming)
+    static constexpr unsigned int DistanceFieldCharacterSize{48}; //!< Character size of the distance field glyphs
+    static constexpr unsigned int DistanceFieldSpread{6}; //!< Maximum distance stored in the distance field, in pixels
+    // NOLINTEND(readability-identifier-naming)
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -239,6 +268,55 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] const Glyph& getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the glyphs of a set of characters ahead of time
+    ///
+    /// Glyphs are otherwise loaded the first time they are
+    /// requested, typically while a text is drawn, which can
+    /// cause frame time spikes when many new characters appear
+    /// at once. Preloading them, e.g. behind a loading screen,
+    /// avoids that.
+    ///
+    /// The glyphs are rasterized on several threads, each one
+    /// with its own FreeType face, then written to the texture
+    /// of the character size on the calling thread, merging
+    /// neighboring glyphs into a single texture update. This
+    /// function returns once all the glyphs are loaded, and
+    /// must be called from the thread that draws the texts.
+    /// Fonts opened from a stream are rasterized on the calling
+    /// thread only, as the stream can't be shared.
+    ///
+    /// Glyphs that are already loaded are skipped.
+    ///
+    /// \param characters       Unicode code points of the characters to load
+    /// \param characterSize    Reference character size
+    /// \param bold             Load the bold versions or the regular ones?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    ///
+    /// \see `getGlyph`
+    ///
+    ////////////////////////////////////////////////////////////
+    void preloadGlyphs(const std::u32string& characters, unsigned int characterSize, bool bold = false, float outlineThickness = 0) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the glyphs of a range of characters ahead of time
+    ///
+    /// This overload loads the characters from `first` to `last`,
+    /// both included, e.g. `U' '` to `U'~'` for printable ASCII.
+    /// Code points that the font doesn't represent all share its
+    /// default glyph, which is loaded only once.
+    ///
+    /// \param first            Unicode code point of the first character to load
+    /// \param last             Unicode code point of the last character to load
+    /// \param characterSize    Reference character size
+    /// \param bold             Load the bold versions or the regular ones?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyphs will not be filled)
+    ///
+    /// \see `getGlyph`
+    ///
+    ////////////////////////////////////////////////////////////
+    void preloadGlyphs(char32_t first, char32_t last, unsigned int characterSize, bool bold = false, float outlineThickness = 0) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Determine if this font has a glyph representing the requested code point
     ///
@@ -358,26 +436,177 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSmooth() const;
 
-private:
     ////////////////////////////////////////////////////////////
-    /// \brief Structure defining a row of glyphs
+    /// \brief Enable or disable the rendering of texts with a distance field
+    ///
+    /// By default, glyphs are rasterized for every character
+    /// size they are requested at, each size having its own
+    /// texture. Zooming a view or animating the character size
+    /// of a text thus keeps rasterizing glyphs, and the scaled
+    /// glyphs look blurry or pixelated.
+    ///
+    /// When the distance field is enabled, `sf::Text` uses the
+    /// distance field glyphs instead: they are rasterized once
+    /// at `DistanceFieldCharacterSize`, and a built-in shader
+    /// renders them sharply at any scale, along with the outline
+    /// and glow of the text. This requires shaders to be
+    /// available and the built-in shader to compile, otherwise
+    /// texts keep using rasterized glyphs.
+    ///
+    /// Small character sizes, that are not scaled, look better
+    /// with rasterized glyphs because of hinting.
+    ///
+    /// Distance field rendering is disabled by default.
+    ///
+    /// \param enabled `true` to render texts with a distance field, `false` to rasterize their glyphs
+    ///
+    /// \see `isDistanceFieldEnabled`, `getDistanceFieldGlyph`
     ///
     ////////////////////////////////////////////////////////////
-    struct Row
-    {
-        Row(unsigned int rowTop, unsigned int rowHeight) : top(rowTop), height(rowHeight)
-        {
-        }
+    void setDistanceFieldEnabled(bool enabled);
 
-        unsigned int width{}; //!< Current width of the row
-        unsigned int top;     //!< Y position of the row into the texture
-        unsigned int height;  //!< Height of the row
-    };
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether texts are rendered with a distance field
+    ///
+    /// \return `true` if texts are rendered with a distance field, `false` otherwise
+    ///
+    /// \see `setDistanceFieldEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDistanceFieldEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve a distance field glyph of the font
+    ///
+    /// The metrics of the glyph are those of the character at
+    /// `DistanceFieldCharacterSize`, scale them to render the
+    /// character at another size. The texture of the glyph
+    /// extends `DistanceFieldSpread` pixels beyond its texture
+    /// rectangle on each side.
+    ///
+    /// The alpha channel of the texture stores the distance
+    /// to the edge of the glyph: 0.5 on the edge, increasing
+    /// inside and decreasing outside, by 0.5 per spread.
+    ///
+    /// This function is mainly used internally by `sf::Text`,
+    /// it can be used to render distance field glyphs with a
+    /// custom shader. It doesn't depend on whether distance
+    /// field rendering is enabled.
+    ///
+    /// \param codePoint Unicode code point of the character to get
+    /// \param bold      Retrieve the bold version or the regular one?
+    ///
+    /// \return The distance field glyph corresponding to `codePoint`
+    ///
+    /// \see `getDistanceFieldTexture`, `getDistanceFieldKerning`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Glyph& getDistanceFieldGlyph(char32_t codePoint, bool bold) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the kerning offset of two distance field glyphs
+    ///
+    /// \param first  Unicode code point of the first character
+    /// \param second Unicode code point of the second character
+    /// \param bold   Retrieve the bold version or the regular one?
+    ///
+    /// \return Kerning value for `first` and `second`, in pixels at `DistanceFieldCharacterSize`
+    ///
+    /// \see `getDistanceFieldGlyph`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getDistanceFieldKerning(std::uint32_t first, std::uint32_t second, bool bold = false) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve the texture containing the loaded distance field glyphs
+    ///
+    /// The texture is always smooth, as the distance field
+    /// must be interpolated between its pixels.
+    ///
+    /// \return Texture containing the distance field glyphs
+    ///
+    /// \see `getDistanceFieldGlyph`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getDistanceFieldTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Limit the graphics memory used by the glyph textures
+    ///
+    /// Each character size has its own page of glyphs, whose
+    /// texture grows as glyphs are added. By default, pages
+    /// are kept until the font is destroyed, which can use a
+    /// lot of memory when many character sizes or a large
+    /// character set (e.g. CJK) are rendered.
+    ///
+    /// When a memory budget is set, the least recently used
+    /// pages are evicted when the textures would exceed it.
+    /// If that's not enough, the page that needs more room is
+    /// emptied instead of growing, and its glyphs are loaded
+    /// again when requested. `sf::Text` detects it and updates
+    /// its geometry.
+    ///
+    /// Evicting a page invalidates the references to its
+    /// glyphs and texture previously returned by `getGlyph`
+    /// and `getTexture`.
+    ///
+    /// A single page may exceed the budget if one glyph
+    /// doesn't fit otherwise.
+    ///
+    /// \param bytes Maximum graphics memory used by the glyph textures, in bytes, or 0 for no limit
+    ///
+    /// \see `getMemoryBudget`, `getAtlasStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMemoryBudget(std::size_t bytes);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the limit of graphics memory used by the glyph textures
+    ///
+    /// \return Maximum graphics memory used by the glyph textures, in bytes, or 0 for no limit
+    ///
+    /// \see `setMemoryBudget`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMemoryBudget() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get statistics about the textures holding the glyphs
+    ///
+    /// The ratio of occupied pixels to total pixels tells how
+    /// well the glyphs are packed in the textures.
+    ///
+    /// \return Statistics about the glyph pages
+    ///
+    /// \see `setMemoryBudget`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AtlasStatistics getAtlasStatistics() const;
+
+private:
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    using GlyphTable = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
+    using GlyphTable   = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
+    using KerningTable = std::unordered_map<std::uint64_t, float>; //!< Table mapping glyph index pairs to their kerning
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Direct lookup of the most common glyphs of a page
+    ///
+    /// Points to the glyphs of the first 256 code points (ASCII
+    /// and Latin-1) without outline, in the glyph table of the
+    /// page. Copies start empty, as they would otherwise point
+    /// to the glyphs of the original page.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DenseGlyphTable
+    {
+        DenseGlyphTable() = default;
+        DenseGlyphTable(const DenseGlyphTable&);
+        DenseGlyphTable& operator=(const DenseGlyphTable&);
+
+        std::array<const Glyph*, 2 * 256> glyphs{}; //!< Regular glyphs by code point, followed by the bold ones
+    };
 
     ////////////////////////////////////////////////////////////
     /// \brief Structure defining a page of glyphs
@@ -387,27 +616,70 @@ private:
     {
         explicit Page(bool smooth);
 
-        GlyphTable       glyphs;     //!< Table mapping code points to their corresponding glyph
-        Texture          texture;    //!< Texture containing the pixels of the glyphs
-        unsigned int     nextRow{3}; //!< Y position of the next new row in the texture
-        std::vector<Row> rows;       //!< List containing the position of all the existing rows
+        GlyphTable                           glyphs;           //!< Table mapping glyph keys to their glyph
+        Texture                              texture;          //!< Texture containing the pixels of the glyphs
+        std::shared_ptr<priv::SkylinePacker> packer;           //!< Placement of the glyphs, shared until modified
+        std::size_t                          occupiedPixels{}; //!< Number of texture pixels covered by glyphs
+        std::uint64_t                        lastUse{};        //!< Value of the use counter when the page was last used
+        KerningTable                         kerning;          //!< Kerning of the glyph pairs already requested
+        DenseGlyphTable                      denseGlyphs;      //!< Direct lookup of the ASCII and Latin-1 glyphs
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Style of a text rendered with distance field glyphs
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DistanceFieldStyle
+    {
+        Color outlineColor;       //!< Color of the outline, transparent for none
+        float outlineThickness{}; //!< Thickness of the outline, as a distance stored in the texture
+        Color glowColor;          //!< Color of the glow
+        float glowThickness{};    //!< Thickness of the glow, as a distance stored in the texture
     };
 
+    friend class Text;
+
     ////////////////////////////////////////////////////////////
     /// \brief Free all the internal resources
     ///
     ////////////////////////////////////////////////////////////
     void cleanup();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader rendering the distance field glyphs
+    ///
+    /// The shader is created the first time it's requested.
+    ///
+    /// \return Pointer to the shader, or a null pointer if it isn't available or failed to compile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Shader* getDistanceFieldShader() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader rendering the distance field glyphs with a style
+    ///
+    /// The geometry batched by \a target reads the uniforms of
+    /// the shader only when it's submitted, so it is flushed
+    /// before the style changes.
+    ///
+    /// \param target Render target the text is drawn to
+    /// \param style  Style of the text
+    ///
+    /// \return Pointer to the shader, or a null pointer if it isn't available
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Shader* getDistanceFieldShader(RenderTarget& target, const DistanceFieldStyle& style) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Find or create the glyphs page corresponding to the given character size
     ///
     /// \param characterSize Reference character size
+    /// \param distanceField Get the page of distance field glyphs rather than rasterized ones?
     ///
     /// \return The glyphs page corresponding to \a characterSize
     ///
     ////////////////////////////////////////////////////////////
-    Page& loadPage(unsigned int characterSize) const;
+    Page& loadPage(unsigned int characterSize, bool distanceField = false) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Load a new glyph and store it in the cache
@@ -416,11 +688,65 @@ private:
     /// \param characterSize    Reference character size
     /// \param bold             Retrieve the bold version or the regular one?
     /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+    /// \param distanceField    Load the distance field of the glyph rather than its coverage?
     ///
     /// \return The glyph corresponding to `codePoint` and `characterSize`
     ///
     ////////////////////////////////////////////////////////////
-    Glyph loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
+    Glyph loadGlyph(char32_t     codePoint,
+                    unsigned int characterSize,
+                    bool         bold,
+                    float        outlineThickness,
+                    bool         distanceField) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Retrieve a glyph of a page, loading it if needed
+    ///
+    /// \param codePoint        Unicode code point of the character to get
+    /// \param characterSize    Reference character size
+    /// \param bold             Retrieve the bold version or the regular one?
+    /// \param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+    /// \param distanceField    Retrieve the distance field glyph rather than the rasterized one?
+    ///
+    /// \return The glyph corresponding to `codePoint` and `characterSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    const Glyph& getGlyph(char32_t     codePoint,
+                          unsigned int characterSize,
+                          bool         bold,
+                          float        outlineThickness,
+                          bool         distanceField) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the kerning offset of two glyphs of a page
+    ///
+    /// \param first         Unicode code point of the first character
+    /// \param second        Unicode code point of the second character
+    /// \param characterSize Reference character size
+    /// \param bold          Retrieve the bold version or the regular one?
+    /// \param distanceField Use the distance field glyphs rather than rasterized ones?
+    ///
+    /// \return Kerning value for `first` and `second`, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    float getKerning(std::uint32_t first,
+                     std::uint32_t second,
+                     unsigned int  characterSize,
+                     bool          bold,
+                     bool          distanceField) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the index of the glyph of a code point in the font
+    ///
+    /// The indices are cached, as looking them up in the
+    /// character map of the font is comparatively slow.
+    ///
+    /// \param codePoint Unicode code point of the character
+    ///
+    /// \return Index of the glyph, 0 if the font has no glyph for `codePoint`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint32_t getGlyphIndex(char32_t codePoint) const;
 
     ////////////////////////////////////////////////////////////
     /// \brief Find a suitable rectangle within the texture for a glyph
@@ -433,6 +759,17 @@ private:
     ////////////////////////////////////////////////////////////
     IntRect findGlyphRect(Page& page, Vector2u size) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Evict the least recently used pages until the memory budget allows an allocation
+    ///
+    /// \param keep       Page that must not be evicted
+    /// \param extraBytes Size of the allocation, in bytes
+    ///
+    /// \return `true` if the allocation fits in the memory budget
+    ///
+    ////////////////////////////////////////////////////////////
+    bool makeRoom(const Page* keep, std::size_t extraBytes) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Make sure that the given size is the current one
     ///
@@ -447,7 +784,8 @@ private:
     // Types
     ////////////////////////////////////////////////////////////
     struct FontHandles;
-    using PageTable = std::unordered_map<unsigned int, Page>; //!< Table mapping a character size to its page (texture)
+    struct DistanceFieldShader;
+    using PageTable = std::unordered_map<std::uint64_t, Page>; //!< Table mapping a character size and kind to its page
 
     ////////////////////////////////////////////////////////////
     // Member data
@@ -457,6 +795,13 @@ private:
     Info                         m_info;           //!< Information about the font
     mutable PageTable            m_pages;          //!< Table containing the glyphs pages by character size
     mutable std::vector<std::uint8_t> m_pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
+    std::size_t                       m_memoryBudget{}; //!< Maximum memory used by the page textures, 0 for none
+    mutable std::uint64_t             m_useCounter{};   //!< Counter incremented every time a page is used
+    mutable std::size_t               m_evictions{};    //!< Number of pages evicted or emptied by the budget
+    mutable std::unordered_map<char32_t, std::uint32_t> m_glyphIndices;         //!< Cached glyph indices by code point
+    mutable std::array<std::uint32_t, 256>              m_latin1GlyphIndices{}; //!< Latin-1 glyph indices + 1, 0 if unknown
+    bool                            m_isDistanceFieldEnabled{}; //!< Are texts rendered with a distance field?
+    mutable std::shared_ptr<DistanceFieldShader> m_distanceFieldShader; //!< Shader rendering the distance field glyphs
 #ifdef SFML_SYSTEM_ANDROID
     std::shared_ptr<priv::ResourceStream> m_stream; //!< Asset file streamer (if loaded from file)
 #endif
@@ -54,6 +54,18 @@ class InputStream;
 class SFML_GRAPHICS_API Image
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Filter used to sample the source image of a scaled copy
+    ///
+    /// \see `copyScaled`
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Filter
+    {
+        Nearest, //!< Take the source pixel nearest to the center of each destination pixel
+        Bilinear //!< Interpolate the 4 source pixels nearest to the center of each destination pixel
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -268,10 +280,10 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Copy pixels from another image onto this one
     ///
-    /// This function does a slow pixel copy and should not be
-    /// used intensively. It can be used to prepare a complex
-    /// static image from several others, but if you need this
-    /// kind of feature in real-time you'd better use `sf::RenderTexture`.
+    /// This function copies the pixels on the CPU. It can be
+    /// used to prepare a complex static image from several
+    /// others, but if you need this kind of feature in real-time
+    /// you'd better use `sf::RenderTexture`.
     ///
     /// If `sourceRect` is empty, the whole image is copied.
     /// If `applyAlpha` is set to `true`, alpha blending is
@@ -299,6 +311,37 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool copy(const Image& source, Vector2u dest, const IntRect& sourceRect = {}, bool applyAlpha = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy pixels from another image onto this one, scaling them
+    ///
+    /// The pixels of `sourceRect` are stretched to cover
+    /// `destRect`, sampled with `filter`. The source pixels are
+    /// copied with their alpha value, no blending is applied.
+    ///
+    /// If `sourceRect` is empty, the whole source image is copied.
+    /// The parts of `destRect` that are outside of this image
+    /// are clipped, without changing the scale.
+    ///
+    /// This function fails if either image is empty, if
+    /// `sourceRect` is not within the boundaries of the `source`
+    /// parameter, or if `destRect` is empty or doesn't
+    /// intersect this image; the image is then left unchanged.
+    ///
+    /// \param source     Source image to copy
+    /// \param destRect   Rectangle of this image to cover with the scaled pixels
+    /// \param sourceRect Sub-rectangle of the source image to copy
+    /// \param filter     Filter used to sample the source image
+    ///
+    /// \return `true` if the operation was successful, `false` otherwise
+    ///
+    /// \see `copy`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool copyScaled(const Image&   source,
+                                  const IntRect& destRect,
+                                  const IntRect& sourceRect = {},
+                                  Filter         filter     = Filter::Nearest);
+
     ////////////////////////////////////////////////////////////
     /// \brief Change the color of a pixel
     ///
@@ -357,6 +400,59 @@ public:
     ////////////////////////////////////////////////////////////
     void flipVertically();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Fill a rectangle of the image with a color
+    ///
+    /// The parts of `rect` that are outside of the image are
+    /// ignored. No blending is applied.
+    ///
+    /// \param rect  Rectangle to fill
+    /// \param color Color to fill the rectangle with
+    ///
+    ////////////////////////////////////////////////////////////
+    void fillRect(const IntRect& rect, Color color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Multiply the color components of every pixel by its alpha
+    ///
+    /// Premultiplied pixels can be blended with
+    /// `sf::BlendMode(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha)`,
+    /// which doesn't bleed the color of transparent pixels
+    /// into their neighbors when filtered. The components are
+    /// rounded to the nearest value.
+    ///
+    /// \see `unpremultiplyAlpha`
+    ///
+    ////////////////////////////////////////////////////////////
+    void premultiplyAlpha();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Divide the color components of every pixel by its alpha
+    ///
+    /// This reverts `premultiplyAlpha`, up to the precision
+    /// lost by premultiplying: the components are rounded to
+    /// the nearest value, and fully transparent pixels become
+    /// transparent black.
+    ///
+    /// \see `premultiplyAlpha`
+    ///
+    ////////////////////////////////////////////////////////////
+    void unpremultiplyAlpha();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Modulate then offset the color of every pixel
+    ///
+    /// Each pixel becomes `pixel * multiplier + offset`, with
+    /// the component-wise operators of `sf::Color`: the
+    /// multiplication is a modulation and the addition is
+    /// clamped to 255.
+    ///
+    /// \param multiplier Color to modulate the pixels with
+    /// \param offset     Color to add to the modulated pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void transformColors(Color multiplier, Color offset = Color::Transparent);
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -0,0 +1,279 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <SFML/System/Time.hpp>
+
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Decode images on worker threads and upload them
+///        to textures within a time budget
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ImageLoader
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Timings of an image loaded by the loader
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Statistics
+    {
+        std::string name;       //!< File name of the image, or name given to the memory it was decoded from
+        Time        decodeTime; //!< Time spent decoding the image on a worker thread
+        Time        uploadTime; //!< Time spent uploading the image to its texture, zero if it has no texture
+        bool        failed{};   //!< Did the decoding or the upload fail?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the loader and start its worker threads
+    ///
+    /// \param threadCount Number of worker threads, 0 to use one per hardware thread
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ImageLoader(unsigned int threadCount = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits for the images being decoded, and drops the ones
+    /// still waiting for a worker or for their upload. The
+    /// futures of the dropped images report a broken promise.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ImageLoader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageLoader(const ImageLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageLoader& operator=(const ImageLoader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageLoader(ImageLoader&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageLoader& operator=(ImageLoader&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode an image from a file on a worker thread
+    ///
+    /// The returned future holds the image once it's decoded,
+    /// or a `sf::Exception` if it couldn't be loaded.
+    ///
+    /// \param filename Path of the image file to load
+    ///
+    /// \return Future of the decoded image
+    ///
+    /// \see `loadFromMemory`, `loadToTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<Image> loadFromFile(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode an image from a file in memory on a worker thread
+    ///
+    /// The returned future holds the image once it's decoded,
+    /// or a `sf::Exception` if it couldn't be loaded.
+    ///
+    /// \param data Content of the image file
+    /// \param name Name of the image in the statistics
+    ///
+    /// \return Future of the decoded image
+    ///
+    /// \see `loadFromFile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<Image> loadFromMemory(std::vector<std::uint8_t> data, std::string name = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Decode an image from a file, then upload it to a texture
+    ///
+    /// The image is decoded on a worker thread, then waits in
+    /// the upload queue until a call to `processUploads` loads
+    /// it into `texture`. The texture must stay alive until
+    /// the returned future is ready.
+    ///
+    /// The returned future is ready once the texture is loaded,
+    /// and holds a `sf::Exception` if the image couldn't be
+    /// decoded or uploaded.
+    ///
+    /// \param filename Path of the image file to load
+    /// \param texture  Texture to load the image into
+    /// \param sRgb     `true` to enable sRGB conversion, `false` to disable it
+    ///
+    /// \return Future that is ready once the texture is loaded
+    ///
+    /// \see `processUploads`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::future<void> loadToTexture(const std::filesystem::path& filename,
+                                                  Texture&                     texture,
+                                                  bool                         sRgb = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload decoded images to their textures
+    ///
+    /// This function must be called from the thread that
+    /// renders, typically once per frame. The images that are
+    /// decoded are uploaded in the order they were requested,
+    /// until `budget` is spent; at least one image is uploaded
+    /// if any is ready, so that the queue always makes progress.
+    /// Images that failed to decode are removed from the queue
+    /// and counted as well.
+    ///
+    /// \param budget Time to spend uploading images
+    ///
+    /// \return Number of images uploaded
+    ///
+    /// \see `loadToTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t processUploads(Time budget);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of images waiting to be uploaded
+    ///
+    /// This includes the images that are still being decoded.
+    ///
+    /// \return Number of pending uploads
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPendingUploadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the timings of the images loaded so far
+    ///
+    /// An image appears in the statistics once it's decoded,
+    /// or once it's uploaded if it was requested with
+    /// `loadToTexture`.
+    ///
+    /// \return Statistics of the loaded images
+    ///
+    /// \see `clearStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<Statistics> getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the timings of the images loaded so far
+    ///
+    /// \see `getStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearStatistics();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ImageLoader
+/// \ingroup graphics
+///
+/// `sf::ImageLoader` loads many images without blocking the
+/// thread that renders. Decoding an image file is the slow
+/// part of loading a texture, and it doesn't need an OpenGL
+/// context: the loader decodes the images on a pool of
+/// worker threads, and returns a future for each of them.
+///
+/// Uploading the decoded pixels to a texture has to happen
+/// on the thread that renders. Images requested with
+/// `loadToTexture` are queued for upload once decoded, and
+/// `processUploads` uploads as many of them as fit in a time
+/// budget, so that streaming a level's textures doesn't
+/// cause a long frame.
+///
+/// The loader records how long each image took to decode
+/// and to upload, to help find the assets that are too
+/// large or in a slow format.
+///
+/// Usage example:
+/// \code
+/// sf::ImageLoader loader;
+///
+/// // Decode an image to process it on the CPU
+/// std::future<sf::Image> heightMap = loader.loadFromFile("height.png");
+///
+/// // Load the textures of the level
+/// std::vector<sf::Texture> textures(paths.size());
+/// std::vector<std::future<void>> loaded;
+/// for (std::size_t i = 0; i < paths.size(); ++i)
+///     loaded.push_back(loader.loadToTexture(paths[i], textures[i]));
+///
+/// while (window.isOpen())
+/// {
+///     // Spend at most 2 milliseconds per frame uploading textures
+///     loader.processUploads(sf::milliseconds(2));
+///
+///     // Draw...
+/// }
+///
+/// for (const auto& statistics : loader.getStatistics())
+///     std::cout << statistics.name << ": " << statistics.decodeTime.asMilliseconds() << " ms\n";
+/// \endcode
+///
+/// \see `sf::Image`, `sf::Texture`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,397 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Index buffer storage, used to draw vertex buffers
+///        with shared vertices
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API IndexBuffer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Types of indices
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Type
+    {
+        UInt16, //!< 16-bit unsigned indices, up to 65536 vertices
+        UInt32  //!< 32-bit unsigned indices
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// They have the same meaning as for `sf::VertexBuffer`.
+    ///
+    ////////////////////////////////////////////////////////////
+    using Usage = VertexBuffer::Usage;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty index buffer of 16-bit indices.
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an `IndexBuffer` with a specific index type
+    ///
+    /// Creates an empty index buffer and sets its index type to \p type.
+    ///
+    /// \param type Type of indices
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IndexBuffer(Type type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an `IndexBuffer` with a specific usage specifier
+    ///
+    /// Creates an empty index buffer and sets its usage to \p usage.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit IndexBuffer(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an `IndexBuffer` with a specific index type and usage specifier
+    ///
+    /// \param type  Type of indices
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer(Type type, Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// \param copy instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer(const IndexBuffer& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~IndexBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the index buffer
+    ///
+    /// Creates the index buffer and allocates enough graphics
+    /// memory to hold `indexCount` indices. Any previously
+    /// allocated memory is freed in the process.
+    ///
+    /// In order to deallocate previously allocated memory pass 0
+    /// as `indexCount`. Don't forget to recreate with a non-zero
+    /// value when graphics memory should be allocated again.
+    ///
+    /// \param indexCount Number of indices worth of memory to allocate
+    ///
+    /// \return `true` if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t indexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the index count
+    ///
+    /// \return Number of indices in the index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getIndexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole buffer from an array of 16-bit indices
+    ///
+    /// The index array is assumed to have the same size as
+    /// the created buffer.
+    ///
+    /// This function fails if `indices` is null, if the buffer
+    /// was not previously created or if its type is not
+    /// `Type::UInt16`.
+    ///
+    /// \param indices Array of indices to copy to the buffer
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const std::uint16_t* indices);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of 16-bit indices
+    ///
+    /// `offset` is specified as the number of indices to skip
+    /// from the beginning of the buffer. The buffer is resized
+    /// following the same rules as `sf::VertexBuffer::update`.
+    ///
+    /// This function fails if the type of the buffer is not
+    /// `Type::UInt16`.
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const std::uint16_t* indices, std::size_t indexCount, unsigned int offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole buffer from an array of 32-bit indices
+    ///
+    /// The index array is assumed to have the same size as
+    /// the created buffer.
+    ///
+    /// This function fails if `indices` is null, if the buffer
+    /// was not previously created or if its type is not
+    /// `Type::UInt32`.
+    ///
+    /// \param indices Array of indices to copy to the buffer
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const std::uint32_t* indices);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of 32-bit indices
+    ///
+    /// `offset` is specified as the number of indices to skip
+    /// from the beginning of the buffer. The buffer is resized
+    /// following the same rules as `sf::VertexBuffer::update`.
+    ///
+    /// This function fails if the type of the buffer is not
+    /// `Type::UInt32`.
+    ///
+    /// \param indices    Array of indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const std::uint32_t* indices, std::size_t indexCount, unsigned int offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy the contents of another buffer into this buffer
+    ///
+    /// Both buffers must store indices of the same type.
+    ///
+    /// \param indexBuffer Index buffer whose contents to copy into this index buffer
+    ///
+    /// \return `true` if the copy was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const IndexBuffer& indexBuffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overload of assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer& operator=(const IndexBuffer& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the contents of this index buffer with those of another
+    ///
+    /// \param right Instance to swap with
+    ///
+    ////////////////////////////////////////////////////////////
+    void swap(IndexBuffer& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the index buffer.
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the index buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the type of the indices stored in the buffer
+    ///
+    /// \return Index type
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Type getType() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the usage specifier of this index buffer
+    ///
+    /// After changing the usage specifier, the index buffer has
+    /// to be updated with new data for the usage specifier to
+    /// take effect.
+    ///
+    /// The default usage type is `sf::IndexBuffer::Usage::Stream`.
+    ///
+    /// \param usage Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUsage(Usage usage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of this index buffer
+    ///
+    /// \return Usage specifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind an index buffer for rendering
+    ///
+    /// This function is not part of the graphics API, it mustn't be
+    /// used when drawing SFML entities. It must be used only if you
+    /// mix `sf::IndexBuffer` with OpenGL code.
+    ///
+    /// \param indexBuffer Pointer to the index buffer to bind, can be null to use no index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    static void bind(const IndexBuffer* indexBuffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports index buffers
+    ///
+    /// Index buffers are available whenever vertex buffers are.
+    ///
+    /// \return `true` if index buffers are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports 32-bit indices
+    ///
+    /// 32-bit indices are always supported by desktop OpenGL.
+    /// OpenGL ES 1 only supports 16-bit indices.
+    ///
+    /// \return `true` if 32-bit indices are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isUInt32Available();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from raw index data
+    ///
+    /// \param indices    Pointer to the indices, of the buffer's type
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool updateIndices(const void* indices, std::size_t indexCount, unsigned int offset);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_buffer{};             //!< Internal buffer identifier
+    std::size_t  m_size{};               //!< Size in indices of the currently allocated buffer
+    Type         m_type{Type::UInt16};   //!< Type of the indices
+    Usage        m_usage{Usage::Stream}; //!< How this index buffer is to be used
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Swap the contents of one index buffer with those of another
+///
+/// \param left First instance to swap
+/// \param right Second instance to swap
+///
+////////////////////////////////////////////////////////////
+SFML_GRAPHICS_API void swap(IndexBuffer& left, IndexBuffer& right) noexcept;
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::IndexBuffer
+/// \ingroup graphics
+///
+/// `sf::IndexBuffer` is a buffer of vertex indices stored in
+/// graphics memory. Combined with a `sf::VertexBuffer`, it
+/// allows primitives to share vertices: a quad only needs 4
+/// vertices and 6 indices instead of 6 full vertices, and a
+/// mesh stores each of its vertices once.
+///
+/// Indices are either 16-bit or 32-bit. 16-bit indices take
+/// half the memory and bandwidth and should be preferred
+/// whenever the vertex buffer holds no more than 65536 vertices.
+///
+/// Index buffers are drawn with the `sf::RenderTarget::draw`
+/// overloads taking both a vertex buffer and an index buffer.
+/// The primitive type of the vertex buffer defines how the
+/// indexed vertices are assembled. Client-side vertex arrays
+/// can also be drawn with indices, using the `sf::RenderTarget::draw`
+/// overloads taking a pointer to the indices.
+///
+/// Example:
+/// \code
+/// // Two quads sharing an edge
+/// const std::array<sf::Vertex, 6> vertices = ...;
+/// const std::array<std::uint16_t, 12> indices = {0, 1, 3, 3, 1, 4, 1, 2, 4, 4, 2, 5};
+///
+/// sf::VertexBuffer vertexBuffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static);
+/// vertexBuffer.create(vertices.size());
+/// vertexBuffer.update(vertices.data());
+///
+/// sf::IndexBuffer indexBuffer(sf::IndexBuffer::Type::UInt16, sf::IndexBuffer::Usage::Static);
+/// indexBuffer.create(indices.size());
+/// indexBuffer.update(indices.data());
+/// ...
+/// window.draw(vertexBuffer, indexBuffer);
+/// \endcode
+///
+/// \see `sf::VertexBuffer`, `sf::RenderTarget`
+///
+////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@
 #include <SFML/Graphics/BlendMode.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/CoordinateType.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
@@ -39,9 +40,13 @@
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/View.hpp>
 
+#include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 
-#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -51,10 +56,17 @@ namespace sf
 {
 class Drawable;
 class Shader;
+class SpriteBatch;
 class Texture;
 class Transform;
 class VertexBuffer;
 
+namespace priv
+{
+class RenderTimers;
+class StreamBuffer;
+} // namespace priv
+
 ////////////////////////////////////////////////////////////
 /// \brief Base class for all render targets (window, texture, ...)
 ///
@@ -62,11 +74,47 @@ class VertexBuffer;
 class SFML_GRAPHICS_API RenderTarget
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Counters describing the work submitted to the target
+    ///
+    ////////////////////////////////////////////////////////////
+    struct DrawStatistics
+    {
+        std::size_t drawsSubmitted{};            //!< Number of draw requests received by the target
+        std::size_t drawCallsIssued{};           //!< Number of OpenGL draw calls actually issued
+        std::size_t preTransformedDraws{};       //!< Number of draws whose vertices were transformed on the CPU
+        std::size_t preTransformedVertices{};    //!< Number of vertices transformed on the CPU
+        std::size_t matrixTransformedDraws{};    //!< Number of draws transformed by the OpenGL model-view matrix
+        std::size_t matrixTransformedVertices{}; //!< Number of vertices transformed by the OpenGL model-view matrix
+        std::size_t shaderBinds{};               //!< Number of times a shader was bound along with its textures
+        std::size_t shaderBindsSkipped{};        //!< Number of shader binds skipped because the shader was still bound
+        std::size_t shaderCallsSkipped{};        //!< Number of OpenGL calls saved by the skipped shader binds
+        std::size_t textureBinds{};              //!< Number of times the texture of a draw was bound (or unbound)
+        std::size_t textureBindsSkipped{};       //!< Number of texture binds skipped because it was still bound
+        std::size_t blendModeChanges{};          //!< Number of times the blend mode was applied
+        std::size_t blendModeChangesSkipped{};   //!< Number of blend mode changes skipped because it was unchanged
+        std::size_t stencilModeChanges{};        //!< Number of times the stencil mode was applied
+        std::size_t stencilModeChangesSkipped{}; //!< Number of stencil mode changes skipped because it was unchanged
+        std::size_t viewChanges{};               //!< Number of times the view (viewport and projection) was applied
+        std::size_t viewChangesSkipped{};        //!< Number of view changes skipped because it was unchanged
+        std::size_t bytesUploaded{};             //!< Bytes of vertices and indices sent from client memory
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Time spent rendering a region timed with `beginTimer`/`endTimer`
+    ///
+    ////////////////////////////////////////////////////////////
+    struct TimerResults
+    {
+        Time                cpuTime; //!< Time spent by the CPU between `beginTimer` and `endTimer`, the last time
+        std::optional<Time> gpuTime; //!< Time spent by the GPU on the region a few frames ago, if known yet
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
     ////////////////////////////////////////////////////////////
-    virtual ~RenderTarget() = default;
+    virtual ~RenderTarget();
 
     ////////////////////////////////////////////////////////////
     /// \brief Deleted copy constructor
@@ -84,13 +132,13 @@ public:
     /// \brief Move constructor
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget(RenderTarget&&) noexcept = default;
+    RenderTarget(RenderTarget&&) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Move assignment
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget& operator=(RenderTarget&&) noexcept = default;
+    RenderTarget& operator=(RenderTarget&&) noexcept;
 
     ////////////////////////////////////////////////////////////
     /// \brief Clear the entire target with a single color
@@ -321,6 +369,52 @@ public:
               PrimitiveType       type,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices and 16-bit indices
+    ///
+    /// The vertices are assembled into primitives in the order
+    /// given by `indices`, which allows primitives to share
+    /// vertices. The indices must all be lower than `vertexCount`,
+    /// otherwise an error is printed and nothing is drawn.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint16_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices and 32-bit indices
+    ///
+    /// The vertices are assembled into primitives in the order
+    /// given by `indices`, which allows primitives to share
+    /// vertices. The indices must all be lower than `vertexCount`,
+    /// otherwise an error is printed and nothing is drawn.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              const std::uint32_t* indices,
+              std::size_t          indexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = RenderStates::Default);
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw primitives defined by a vertex buffer
     ///
@@ -344,6 +438,200 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = RenderStates::Default);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and an index buffer
+    ///
+    /// The primitive type of the vertex buffer is used.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer, referencing vertices of `vertexBuffer`
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer and a range of an index buffer
+    ///
+    /// The primitive type of the vertex buffer is used.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer, referencing vertices of `vertexBuffer`
+    /// \param firstIndex   Position of the first index to render
+    /// \param indexCount   Number of indices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = RenderStates::Default);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable automatic batching of draw calls
+    ///
+    /// When batching is enabled, consecutive draws of vertex
+    /// arrays that use compatible render states (same texture,
+    /// coordinate type, shader, blend mode and stencil mode) are
+    /// pre-transformed on the CPU and gathered into a single
+    /// buffer, which is submitted with one OpenGL draw call
+    /// when the states change, or when `flush()`, `clear()`,
+    /// `setView()` or `display()` is called.
+    ///
+    /// Since the geometry is only submitted later, the textures
+    /// and shaders used by the pending draws must stay alive and
+    /// unmodified until the batch is flushed. Shader uniforms
+    /// are read at the time the batch is flushed.
+    ///
+    /// Disabling batching flushes any pending geometry.
+    /// Batching is disabled by default.
+    ///
+    /// \param enabled `true` to enable batching, `false` to disable it
+    ///
+    /// \see `isBatchingEnabled`, `flush`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBatchingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether automatic batching of draw calls is enabled
+    ///
+    /// \return `true` if batching is enabled, `false` otherwise
+    ///
+    /// \see `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isBatchingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum number of vertices pre-transformed on the CPU
+    ///
+    /// When batching is disabled, vertex arrays of at most
+    /// `vertexCount` vertices are transformed on the CPU into an
+    /// internal cache, which avoids changing the OpenGL model-view
+    /// matrix for every draw. Larger arrays are drawn as they are,
+    /// and transformed by loading their transform into OpenGL.
+    /// The cache grows on demand to hold the largest array drawn.
+    ///
+    /// Pre-transforming is cheaper for many small drawables
+    /// (sprites, text, ...), while loading the matrix is cheaper
+    /// for a few big meshes. Use 0 to always use the OpenGL matrix,
+    /// or `std::numeric_limits<std::size_t>::max()` to always
+    /// transform on the CPU. The statistics returned by
+    /// `getDrawStatistics()` report how often each path is taken.
+    ///
+    /// The default threshold is 4 vertices, which covers sprites.
+    ///
+    /// \param vertexCount Maximum number of vertices to pre-transform
+    ///
+    /// \see `getVertexCacheThreshold`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVertexCacheThreshold(std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of vertices pre-transformed on the CPU
+    ///
+    /// \return Maximum number of vertices to pre-transform
+    ///
+    /// \see `setVertexCacheThreshold`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getVertexCacheThreshold() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit the geometry gathered by the batching mode
+    ///
+    /// This function does nothing if batching is disabled or if
+    /// no geometry is pending. You only need to call it yourself
+    /// before issuing OpenGL commands directly, or before
+    /// modifying a texture or shader used by a pending draw.
+    ///
+    /// \see `setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the draw statistics accumulated by the target
+    ///
+    /// The counters accumulate until `resetDrawStatistics()`
+    /// is called, which is typically done once per frame.
+    ///
+    /// \return Draw statistics of the target
+    ///
+    /// \see `resetDrawStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const DrawStatistics& getDrawStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset all the draw statistics counters to zero
+    ///
+    /// \see `getDrawStatistics`
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetDrawStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start timing a region of the frame
+    ///
+    /// Everything drawn until `endTimer()` is called is
+    /// attributed to the region named \a name. The CPU time is
+    /// measured with a clock, and where `isGpuTimerAvailable()`
+    /// returns `true` the GPU time is measured with OpenGL timer
+    /// queries. The GPU results are read back without ever
+    /// waiting for the GPU, so they lag a few frames behind and
+    /// timing regions can be left enabled in production builds.
+    ///
+    /// Regions can't be nested, and a region must be ended
+    /// before the target is deactivated, since timer queries
+    /// belong to the OpenGL context of the target.
+    ///
+    /// \param name Name of the region
+    ///
+    /// \see `endTimer`, `getTimerResults`
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginTimer(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop timing the current region of the frame
+    ///
+    /// This function does nothing if no region is being timed.
+    ///
+    /// \see `beginTimer`, `getTimerResults`
+    ///
+    ////////////////////////////////////////////////////////////
+    void endTimer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the latest time spent rendering a region
+    ///
+    /// \param name Name of the region
+    ///
+    /// \return Time spent rendering the region, or `std::nullopt` if it was never timed
+    ///
+    /// \see `beginTimer`, `endTimer`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<TimerResults> getTimerResults(const std::string& name) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system can measure GPU times
+    ///
+    /// GPU times require the ARB_timer_query extension (core
+    /// since OpenGL 3.3). Without it, timed regions only report
+    /// CPU times.
+    ///
+    /// \return `true` if GPU times can be measured, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isGpuTimerAvailable();
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -455,7 +743,7 @@ protected:
     /// \brief Default constructor
     ///
     ////////////////////////////////////////////////////////////
-    RenderTarget() = default;
+    RenderTarget();
 
     ////////////////////////////////////////////////////////////
     /// \brief Performs the common initialization step after creation
@@ -467,6 +755,8 @@ protected:
     void initialize();
 
 private:
+    friend class SpriteBatch;
+
     ////////////////////////////////////////////////////////////
     /// \brief Apply the current view
     ///
@@ -514,6 +804,111 @@ private:
     ////////////////////////////////////////////////////////////
     void applyShader(const Shader* shader);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a shader is still bound from a previous draw
+    ///
+    /// The shader must have the same program and texture
+    /// variables as when it was bound, and its textures must
+    /// still be the ones bound to its texture units.
+    ///
+    /// \param shader Shader to check
+    ///
+    /// \return `true` if binding the shader again can be skipped
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isShaderBound(const Shader& shader) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Indices assembling client-side vertices into primitives
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Indices
+    {
+        const void*       data{};                          //!< Pointer to the indices, null if not indexed
+        std::size_t       count{};                         //!< Number of indices
+        IndexBuffer::Type type{IndexBuffer::Type::UInt16}; //!< Type of the indices
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Count, then batch or draw primitives defined by an array of vertices
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    /// \param indices     Indices of the vertices to draw, if any
+    ///
+    ////////////////////////////////////////////////////////////
+    void submitVertices(const Vertex*       vertices,
+                        std::size_t         vertexCount,
+                        PrimitiveType       type,
+                        const RenderStates& states,
+                        const Indices&      indices);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices, bypassing the batch
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    /// \param indices     Indices of the vertices to draw, if any
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertices(const Vertex*       vertices,
+                      std::size_t         vertexCount,
+                      PrimitiveType       type,
+                      const RenderStates& states,
+                      const Indices&      indices);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by a vertex buffer, optionally indexed
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer, or null to draw the vertices in order
+    /// \param first        Index of the first vertex, or position of the first index, to render
+    /// \param count        Number of vertices, or indices, to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertexBuffer(const VertexBuffer& vertexBuffer,
+                          const IndexBuffer*  indexBuffer,
+                          std::size_t         first,
+                          std::size_t         count,
+                          const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the instances of a sprite batch with a single instanced draw call
+    ///
+    /// \param spriteBatch Sprite batch to draw
+    /// \param states      Render states to use for drawing, including the batch's instancing shader
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawInstances(const SpriteBatch& spriteBatch, const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append primitives to the pending batch
+    ///
+    /// The pending batch is flushed first if its render states
+    /// are not compatible with `states`.
+    ///
+    /// Indexed vertices are expanded, the batch itself is
+    /// never indexed. The indices have already been checked
+    /// to be lower than `vertexCount`.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    /// \param indices     Indices of the vertices to draw, if any
+    ///
+    ////////////////////////////////////////////////////////////
+    void batchVertices(const Vertex*       vertices,
+                       std::size_t         vertexCount,
+                       PrimitiveType       type,
+                       const RenderStates& states,
+                       const Indices&      indices);
+
     ////////////////////////////////////////////////////////////
     /// \brief Setup environment for drawing
     ///
@@ -533,6 +928,20 @@ private:
     ////////////////////////////////////////////////////////////
     void drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw indexed primitives
+    ///
+    /// \param type       Type of primitives to draw
+    /// \param indexType  Type of the indices
+    /// \param indices    Pointer to the indices, or offset in the bound index buffer
+    /// \param indexCount Number of indices to use when drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedPrimitives(PrimitiveType     type,
+                               IndexBuffer::Type indexType,
+                               const void*       indices,
+                               std::size_t       indexCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up environment after drawing
     ///
@@ -547,27 +956,47 @@ private:
     ////////////////////////////////////////////////////////////
     struct StatesCache
     {
-        bool                  enable{};                //!< Is the cache enabled?
-        bool                  glStatesSet{};           //!< Are our internal GL states set yet?
-        bool                  viewChanged{};           //!< Has the current view changed since last draw?
-        bool                  scissorEnabled{};        //!< Is scissor testing enabled?
-        bool                  stencilEnabled{};        //!< Is stencil testing enabled?
-        BlendMode             lastBlendMode;           //!< Cached blending mode
-        StencilMode           lastStencilMode;         //!< Cached stencil
-        std::uint64_t         lastTextureId{};         //!< Cached texture
-        CoordinateType        lastCoordinateType{};    //!< Texture coordinate type
-        bool                  texCoordsArrayEnabled{}; //!< Is `GL_TEXTURE_COORD_ARRAY` client state enabled?
-        bool                  useVertexCache{};        //!< Did we previously use the vertex cache?
-        std::array<Vertex, 4> vertexCache{};           //!< Pre-transformed vertices cache
+        bool                       enable{};                //!< Is the cache enabled?
+        bool                       glStatesSet{};           //!< Are our internal GL states set yet?
+        bool                       viewChanged{};           //!< Has the current view changed since last draw?
+        bool                       scissorEnabled{};        //!< Is scissor testing enabled?
+        bool                       stencilEnabled{};        //!< Is stencil testing enabled?
+        BlendMode                  lastBlendMode;           //!< Cached blending mode
+        StencilMode                lastStencilMode;         //!< Cached stencil
+        std::uint64_t              lastTextureId{};         //!< Cached texture
+        CoordinateType             lastCoordinateType{};    //!< Texture coordinate type
+        std::uint64_t              lastShaderId{};          //!< Cached shader
+        std::vector<std::uint64_t> lastShaderTextureIds;    //!< Textures bound to the units of the cached shader
+        bool                       texCoordsArrayEnabled{}; //!< Is `GL_TEXTURE_COORD_ARRAY` client state enabled?
+        bool                       useVertexCache{};        //!< Did we previously use the vertex cache?
+        std::size_t                vertexCacheThreshold{4}; //!< Maximum number of vertices to pre-transform
+        std::vector<Vertex>        vertexCache;             //!< Pre-transformed vertices cache
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Geometry gathered by the batching mode
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Batch
+    {
+        bool                enabled{};   //!< Is batching enabled?
+        RenderStates        states;      //!< Render states shared by the pending geometry (with an identity transform)
+        std::uint64_t       textureId{}; //!< Unique identifier of the pending texture
+        PrimitiveType       type{};      //!< Type of the pending primitives (points, lines or triangles)
+        std::vector<Vertex> vertices;    //!< Pending pre-transformed vertices
     };
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    View          m_defaultView; //!< Default view
-    View          m_view;        //!< Current view
-    StatesCache   m_cache{};     //!< Render states cache
-    std::uint64_t m_id{};        //!< Unique number that identifies the RenderTarget
+    View                                m_defaultView;  //!< Default view
+    View                                m_view;         //!< Current view
+    StatesCache                         m_cache{};      //!< Render states cache
+    Batch                               m_batch;        //!< Pending batched geometry
+    DrawStatistics                      m_statistics{}; //!< Draw statistics
+    std::uint64_t                       m_id{};         //!< Unique number that identifies the RenderTarget
+    std::unique_ptr<priv::StreamBuffer> m_streamBuffer; //!< Buffer object used to stream vertices to the GPU
+    std::unique_ptr<priv::RenderTimers> m_timers;       //!< Timed regions of the frame
 };
 
 } // namespace sf
@@ -595,6 +1024,38 @@ private:
 /// OpenGL states are not messed up by calling the
 /// `pushGLStates`/`popGLStates` functions.
 ///
+/// Scenes made of many small drawables sharing the same texture
+/// can enable batching with `setBatchingEnabled`: compatible
+/// consecutive draws are then merged and submitted with a single
+/// OpenGL draw call. `getDrawStatistics` reports how many draws
+/// were requested and how many OpenGL draw calls were issued.
+///
+/// The draw statistics also count the state changes sent to
+/// OpenGL and those skipped because the state was unchanged,
+/// as well as the bytes of geometry uploaded by the draws.
+/// Combined with `beginTimer`/`endTimer`, which measure the
+/// CPU and GPU time of regions of the frame, they are cheap
+/// enough to be read every frame:
+/// \code
+/// window.resetDrawStatistics();
+///
+/// window.beginTimer("world");
+/// drawWorld(window);
+/// window.endTimer();
+///
+/// window.display();
+///
+/// const sf::RenderTarget::DrawStatistics& statistics = window.getDrawStatistics();
+/// if (const std::optional world = window.getTimerResults("world"); world && world->gpuTime)
+///     overlay.show(statistics.drawCallsIssued, world->gpuTime->asMicroseconds());
+/// \endcode
+///
+/// The shader of the last draw stays bound until a draw needs
+/// another one, so that consecutive draws with the same shader
+/// and textures don't bind them again. OpenGL code interleaved
+/// with SFML drawing should therefore be surrounded by
+/// `pushGLStates`/`popGLStates`, or followed by `resetGLStates`.
+///
 /// While render targets are moveable, it is not valid to move them
 /// between threads. This will cause your program to crash. The
 /// problem boils down to OpenGL being limited with regard to how it
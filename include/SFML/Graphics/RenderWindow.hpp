@@ -178,6 +178,17 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool setActive(bool active = true) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Display on screen what has been rendered to the window so far
+    ///
+    /// Any geometry still pending in the batch is rendered
+    /// before the window is displayed.
+    ///
+    /// \see `RenderTarget::setBatchingEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void display();
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Function called after the window has been created
@@ -34,17 +34,21 @@
 #include <SFML/Window/GlResource.hpp>
 
 #include <filesystem>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <cstddef>
+#include <cstdint>
 
 
 namespace sf
 {
 class InputStream;
 class Texture;
+class UniformBuffer;
 
 ////////////////////////////////////////////////////////////
 /// \brief Shader class (vertex, geometry and fragment)
@@ -84,6 +88,45 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static inline CurrentTextureType CurrentTexture;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle to a uniform variable of a shader
+    ///
+    /// Handles are looked up once by name with `getUniformHandle`,
+    /// then setting a uniform through its handle involves no
+    /// string lookup. A handle is only valid for the shader
+    /// that returned it, until the shader is loaded again.
+    ///
+    ////////////////////////////////////////////////////////////
+    class UniformHandle
+    {
+    private:
+        friend class Shader;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct the handle from the index of the uniform
+        ///
+        ////////////////////////////////////////////////////////////
+        explicit UniformHandle(std::size_t index) : m_index(index)
+        {
+        }
+
+        std::size_t m_index; //!< Index of the uniform in the shader (see Shader::m_uniformValues)
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Source codes of a shader loaded by `loadManyFromMemory`
+    ///
+    /// Empty source codes are skipped, like with `loadFromMemory`.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct MemorySources
+    {
+        Shader*          shader{};       //!< Shader to load, must not be null
+        std::string_view vertexShader;   //!< Source code of the vertex shader, or empty
+        std::string_view geometryShader; //!< Source code of the geometry shader, or empty
+        std::string_view fragmentShader; //!< Source code of the fragment shader, or empty
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -449,6 +492,30 @@ public:
                                       std::string_view geometryShader,
                                       std::string_view fragmentShader);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Load several shaders from source codes in memory at once
+    ///
+    /// Each shader is loaded like with `loadFromMemory`, but all
+    /// of them are submitted to the driver before the result of
+    /// any compilation is checked. Drivers which compile on
+    /// background threads, and those supporting the
+    /// KHR_parallel_shader_compile extension which this function
+    /// enables, then compile the shaders in parallel instead of
+    /// one after the other.
+    ///
+    /// A shader which fails to load is left unchanged, and the
+    /// errors are reported like with `loadFromMemory`.
+    ///
+    /// \param sources Pointer to the sources of the shaders
+    /// \param count   Number of shaders to load
+    ///
+    /// \return Number of shaders successfully loaded
+    ///
+    /// \see `loadFromMemory`, `setProgramCacheDirectory`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::size_t loadManyFromMemory(const MemorySources* sources, std::size_t count);
+
     ////////////////////////////////////////////////////////////
     /// \brief Load the vertex, geometry or fragment shader from a custom stream
     ///
@@ -514,6 +581,19 @@ public:
                                       InputStream& geometryShaderStream,
                                       InputStream& fragmentShaderStream);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Look up the handle of a uniform variable
+    ///
+    /// The handle can then be passed to the `setUniform` and
+    /// `setUniformArray` overloads instead of the name.
+    ///
+    /// \param name Name of the uniform variable in GLSL
+    ///
+    /// \return Handle of the uniform, or `std::nullopt` if the shader has no active uniform with this name
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<UniformHandle> getUniformHandle(const std::string& name);
+
     ////////////////////////////////////////////////////////////
     /// \brief Specify value for \p float uniform
     ///
@@ -778,6 +858,230 @@ public:
     ////////////////////////////////////////////////////////////
     void setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p float uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param x      Value of the float scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, float x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec2 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the vec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, Glsl::Vec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec3 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the vec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p vec4 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the vec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Vec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p int uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param x      Value of the int scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, int x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec2 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the ivec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, Glsl::Ivec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec3 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the ivec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p ivec4 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the ivec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Ivec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bool uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param x      Value of the bool scalar
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, bool x);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec2 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the bvec2 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, Glsl::Bvec2 vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec3 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the bvec3 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec3& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p bvec4 uniform
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param vector Value of the bvec4 vector
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Bvec4& vector);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat3 matrix
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param matrix Value of the mat3 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Mat3& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify value for \p mat4 matrix
+    ///
+    /// \param handle Handle of the uniform variable
+    /// \param matrix Value of the mat4 matrix
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniform(UniformHandle handle, const Glsl::Mat4& matrix);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p float[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param scalarArray pointer to array of \p float values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const float* scalarArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec2[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param vectorArray pointer to array of \p vec2 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Vec2* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec3[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param vectorArray pointer to array of \p vec3 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Vec3* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p vec4[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param vectorArray pointer to array of \p vec4 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Vec4* vectorArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p mat3[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param matrixArray pointer to array of \p mat3 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Mat3* matrixArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify values for \p mat4[] array uniform
+    ///
+    /// \param handle      Handle of the uniform variable
+    /// \param matrixArray pointer to array of \p mat4 values
+    /// \param length      Number of elements in the array
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformArray(UniformHandle handle, const Glsl::Mat4* matrixArray, std::size_t length);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Specify a uniform buffer as the storage of a uniform block
+    ///
+    /// \a name is the name of an interface block of uniforms
+    /// in the shader. Its values are read from \a buffer, which
+    /// can be shared by several shaders so that common values
+    /// are uploaded once for all of them.
+    ///
+    /// Example:
+    /// \code
+    /// layout(std140) uniform Frame // this is the block in the shader
+    /// {
+    ///     mat4 camera;
+    ///     float time;
+    /// };
+    /// \endcode
+    /// \code
+    /// sf::UniformBuffer buffer;
+    /// ...
+    /// shader.setUniformBlock("Frame", buffer);
+    /// \endcode
+    /// It is important to note that `buffer` must remain alive as long
+    /// as the shader uses it, no copy is made internally.
+    ///
+    /// \param name   Name of the uniform block in the shader
+    /// \param buffer Uniform buffer to assign
+    ///
+    /// \see `sf::UniformBuffer`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformBlock(const std::string& name, const UniformBuffer& buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary uniform buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformBlock(const std::string& name, const UniformBuffer&& buffer) = delete;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the underlying OpenGL handle of the shader.
     ///
@@ -808,6 +1112,10 @@ public:
     /// // draw OpenGL stuff that use no shader...
     /// \endcode
     ///
+    /// Binding a shader uploads the uniforms set since it was
+    /// last bound, so uniforms changed while it is bound only
+    /// take effect once it is bound again.
+    ///
     /// \param shader Shader to bind, can be null to use no shader
     ///
     ////////////////////////////////////////////////////////////
@@ -844,7 +1152,55 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static bool isGeometryAvailable();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable caching the compiled shaders on disk
+    ///
+    /// Once a directory is set, every shader linked successfully
+    /// is saved to it in the binary form returned by the driver,
+    /// and the next loads of the same source codes skip the
+    /// compilation by reading it back. Entries are keyed by the
+    /// source codes and by the vendor, renderer and version of
+    /// the driver, so that an update of the driver or a change
+    /// of GPU never reuses stale binaries; if the driver still
+    /// rejects a binary, the shader is compiled from its source
+    /// codes as if the cache was empty.
+    ///
+    /// The cache is disabled by default, and has no effect if
+    /// `isProgramCacheAvailable()` returns `false`.
+    ///
+    /// \param directory Directory where the compiled shaders are stored, empty to disable the cache
+    ///
+    /// \see `getProgramCacheDirectory`, `isProgramCacheAvailable`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void setProgramCacheDirectory(const std::filesystem::path& directory);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the directory where compiled shaders are cached
+    ///
+    /// \return Directory of the cache, empty if it is disabled
+    ///
+    /// \see `setProgramCacheDirectory`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::filesystem::path getProgramCacheDirectory();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system can cache compiled shaders
+    ///
+    /// Caching requires the ARB_get_program_binary extension
+    /// (core since OpenGL 4.1).
+    ///
+    /// \return `true` if compiled shaders can be cached, `false` otherwise
+    ///
+    /// \see `setProgramCacheDirectory`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isProgramCacheAvailable();
+
 private:
+    friend class RenderTarget;
+
     ////////////////////////////////////////////////////////////
     /// \brief Compile the shader(s) and create the program
     ///
@@ -862,6 +1218,17 @@ private:
                                std::string_view geometryShaderCode,
                                std::string_view fragmentShaderCode);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the program by a newly linked one
+    ///
+    /// The previous program is destroyed, and everything that
+    /// depended on it (textures, uniforms) is reset.
+    ///
+    /// \param shaderProgram OpenGL handle of the new program
+    ///
+    ////////////////////////////////////////////////////////////
+    void replaceProgram(unsigned int shaderProgram);
+
     ////////////////////////////////////////////////////////////
     /// \brief Bind all the textures used by the shader
     ///
@@ -871,6 +1238,15 @@ private:
     ////////////////////////////////////////////////////////////
     void bindTextures() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the values of the uniforms set since
+    ///        the shader was last bound
+    ///
+    /// The shader must be bound.
+    ///
+    ////////////////////////////////////////////////////////////
+    void uploadUniforms() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the location ID of a shader uniform
     ///
@@ -882,27 +1258,69 @@ private:
     int getUniformLocation(const std::string& name);
 
     ////////////////////////////////////////////////////////////
-    /// \brief RAII object to save and restore the program
-    ///        binding while uniforms are being set
+    /// \brief Type of the value of a uniform
     ///
-    /// Implementation is private in the .cpp file.
+    ////////////////////////////////////////////////////////////
+    enum class UniformType : std::uint8_t
+    {
+        Float,
+        Vec2,
+        Vec3,
+        Vec4,
+        Int,
+        Ivec2,
+        Ivec3,
+        Ivec4,
+        Mat3,
+        Mat4
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Location and last value of a uniform
     ///
     ////////////////////////////////////////////////////////////
-    struct UniformBinder;
+    struct Uniform
+    {
+        int                location{-1}; //!< Location of the variable in the program, -1 if it doesn't exist
+        UniformType        type{};       //!< Type of the value
+        std::size_t        count{};      //!< Number of array elements of the value, 0 until a value is set
+        std::vector<float> floats;       //!< Components of a floating point value
+        std::vector<int>   ints;         //!< Components of an integer value
+        bool               pending{};    //!< Is the value waiting to be uploaded?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Store the value of a uniform until the shader is bound
+    ///
+    /// Values equal to the last one set are ignored.
+    ///
+    /// \param handle Handle of the uniform
+    /// \param type   Type of the value
+    /// \param values Components of the value, or of each element of the array
+    /// \param count  Number of array elements
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    void storeUniform(UniformHandle handle, UniformType type, const T* values, std::size_t count);
 
     ////////////////////////////////////////////////////////////
     // Types
     ////////////////////////////////////////////////////////////
-    using TextureTable = std::unordered_map<int, const Texture*>;
-    using UniformTable = std::unordered_map<std::string, int>;
+    using TextureTable      = std::unordered_map<int, const Texture*>;
+    using UniformBlockTable = std::unordered_map<unsigned int, const UniformBuffer*>;
+    using UniformTable      = std::unordered_map<std::string, std::size_t>;
 
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int m_shaderProgram{};    //!< OpenGL identifier for the program
-    int          m_currentTexture{-1}; //!< Location of the current texture in the shader
-    TextureTable m_textures;           //!< Texture variables in the shader, mapped to their location
-    UniformTable m_uniforms;           //!< Parameters location cache
+    unsigned int                     m_shaderProgram{};    //!< OpenGL identifier for the program
+    int                              m_currentTexture{-1}; //!< Location of the current texture in the shader
+    TextureTable                     m_textures;           //!< Texture variables in the shader, by location
+    UniformBlockTable                m_uniformBlocks;      //!< Uniform buffers of the shader, by block index
+    UniformTable                     m_uniforms;           //!< Index of the uniforms in m_uniformValues, by name
+    mutable std::vector<Uniform>     m_uniformValues;      //!< Location and value of the uniforms looked up
+    mutable std::vector<std::size_t> m_pendingUniforms;    //!< Uniforms to upload when the shader is bound
+    std::uint64_t                    m_cacheId{};          //!< Identifies the program and what it binds (RenderTarget)
 };
 
 } // namespace sf
@@ -969,6 +1387,40 @@ private:
 /// given \p sampler2D uniform to the current texture of the
 /// object being drawn (which cannot be known in advance).
 ///
+/// Uniform values are not sent to the graphics card right away:
+/// they are stored and uploaded the next time the shader is bound,
+/// either by a draw or by `sf::Shader::bind`, and setting a value
+/// that a uniform already has costs nothing. Uniforms set every
+/// frame are best set through handles, looked up once by name:
+/// \code
+/// const std::optional time = shader.getUniformHandle("time");
+/// ...
+/// if (time)
+///     shader.setUniform(*time, clock.getElapsedTime().asSeconds());
+/// \endcode
+///
+/// Values shared by many shaders, such as a camera or lights,
+/// can be grouped in a uniform block stored in a `sf::UniformBuffer`:
+/// the buffer is updated once and every shader assigned to it with
+/// `setUniformBlock` reads the new values.
+///
+/// Compiling many shaders can noticeably slow down the start of
+/// an application. `sf::Shader::loadManyFromMemory` lets the
+/// driver compile them in parallel, and
+/// `sf::Shader::setProgramCacheDirectory` saves the compiled
+/// shaders to disk so that the next runs skip the compilation:
+/// \code
+/// sf::Shader::setProgramCacheDirectory("cache/shaders");
+///
+/// sf::Shader blur, bloom;
+/// const std::array<sf::Shader::MemorySources, 2> sources = {{{&blur, blurVertex, {}, blurFragment},
+///                                                            {&bloom, {}, {}, bloomFragment}}};
+/// if (sf::Shader::loadManyFromMemory(sources.data(), sources.size()) != sources.size())
+/// {
+///     // error...
+/// }
+/// \endcode
+///
 /// To apply a shader to a drawable, you must pass it as an
 /// additional parameter to the `RenderWindow::draw` function:
 /// \code
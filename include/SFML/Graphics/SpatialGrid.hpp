@@ -0,0 +1,303 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class View;
+
+////////////////////////////////////////////////////////////
+/// \brief Spatial index finding the objects visible in an area
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpatialGrid
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty grid with cells of 256x256 units.
+    ///
+    ////////////////////////////////////////////////////////////
+    SpatialGrid() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty grid with a specific cell size
+    ///
+    /// Queries are fastest when the cells are about the size of
+    /// the typical object: much smaller cells make large
+    /// objects span many of them, much larger cells make queries
+    /// test many objects outside the queried area.
+    ///
+    /// \param cellSize Size of the cells, in world units (both components must be positive)
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpatialGrid(Vector2f cellSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an object to the grid
+    ///
+    /// Identifiers of removed objects are reused. A rectangle
+    /// with a negative size is normalized.
+    ///
+    /// \param bounds Bounding rectangle of the object, in world coordinates
+    ///
+    /// \return Identifier of the object
+    ///
+    /// \see `update`, `remove`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t insert(const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the bounding rectangle of an object
+    ///
+    /// Call this function when an object moves or changes size.
+    /// Moving within the same cells only stores the new bounds,
+    /// so that updating dynamic objects every frame stays cheap.
+    ///
+    /// \param id     Identifier of the object
+    /// \param bounds New bounding rectangle of the object, in world coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(std::size_t id, const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an object from the grid
+    ///
+    /// \param id Identifier of the object
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(std::size_t id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the objects from the grid
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether an identifier refers to an object of the grid
+    ///
+    /// \param id Identifier to check
+    ///
+    /// \return `true` if the object is in the grid, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool contains(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounding rectangle of an object
+    ///
+    /// \param id Identifier of the object
+    ///
+    /// \return Bounding rectangle of the object, in world coordinates, with a positive size
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const FloatRect& getBounds(std::size_t id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of objects in the grid
+    ///
+    /// \return Number of objects
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getObjectCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the cells of the grid
+    ///
+    /// \return Size of the cells, in world units
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getCellSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the objects overlapping an area
+    ///
+    /// The identifiers are appended to \a ids, each one once,
+    /// in no particular order. The vector isn't cleared first,
+    /// so that its storage can be reused from one frame to the
+    /// next.
+    ///
+    /// \param area Area to search, in world coordinates
+    /// \param ids  Vector receiving the identifiers of the objects overlapping the area
+    ///
+    ////////////////////////////////////////////////////////////
+    void query(const FloatRect& area, std::vector<std::size_t>& ids) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the objects visible in a view
+    ///
+    /// The searched area is the bounding rectangle of the area
+    /// of the world displayed by the view, so rotated views may
+    /// return objects slightly outside of it.
+    ///
+    /// \param view View to search
+    /// \param ids  Vector receiving the identifiers of the visible objects
+    ///
+    /// \see `query(const FloatRect&, std::vector<std::size_t>&) const`
+    ///
+    ////////////////////////////////////////////////////////////
+    void query(const View& view, std::vector<std::size_t>& ids) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Range of cells covered by a rectangle
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CellRange
+    {
+        Vector2i first; //!< Top-left cell of the range
+        Vector2i last;  //!< Bottom-right cell of the range (included)
+
+        [[nodiscard]] bool operator==(const CellRange& other) const
+        {
+            return (first == other.first) && (last == other.last);
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Object stored in the grid
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Object
+    {
+        FloatRect bounds; //!< Bounding rectangle of the object
+        CellRange cells;  //!< Cells the object is registered in
+        bool      used{}; //!< Is the identifier in use?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the range of cells covered by a rectangle
+    ///
+    /// The right and bottom edges of the rectangle are excluded,
+    /// so that a rectangle ending on the border of a cell doesn't
+    /// cover the next one.
+    ///
+    /// \param rectangle Rectangle in world coordinates, with a positive size
+    ///
+    /// \return Cells overlapped by the rectangle
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] CellRange getCells(const FloatRect& rectangle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Register an object in a range of cells
+    ///
+    /// \param id    Identifier of the object
+    /// \param cells Cells to register the object in
+    ///
+    ////////////////////////////////////////////////////////////
+    void link(std::size_t id, const CellRange& cells);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unregister an object from a range of cells
+    ///
+    /// \param id    Identifier of the object
+    /// \param cells Cells to unregister the object from
+    ///
+    ////////////////////////////////////////////////////////////
+    void unlink(std::size_t id, const CellRange& cells);
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    using CellTable = std::unordered_map<std::uint64_t, std::vector<std::size_t>>;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2f                 m_cellSize{256.f, 256.f}; //!< Size of the cells
+    std::vector<Object>      m_objects;                //!< Objects, indexed by identifier
+    std::vector<std::size_t> m_freeIds;                //!< Identifiers of removed objects
+    CellTable                m_cells;                  //!< Objects overlapping each non-empty cell
+    std::vector<std::size_t> m_largeIds;               //!< Objects covering too many cells to be registered in them
+    std::size_t              m_objectCount{};          //!< Number of objects in the grid
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpatialGrid
+/// \ingroup graphics
+///
+/// `sf::RenderTarget` sends every drawable it is given to the
+/// GPU, even when it lies outside of the current view. With
+/// large worlds, most of the work is then spent on objects
+/// that are never seen. `sf::SpatialGrid` indexes the bounding
+/// rectangles of the objects in a uniform grid, so that the
+/// objects visible in a view can be found without testing
+/// all of them.
+///
+/// The grid only stores identifiers and rectangles: the
+/// objects themselves, whether drawables or ranges of a
+/// vertex array, stay wherever the application keeps them,
+/// typically in a vector indexed by the identifiers.
+/// Dynamic objects are moved with `update`, which is cheap
+/// as long as they stay in the same cells. Objects much larger
+/// than the cells are kept in a separate list tested by every
+/// query, rather than registered in all the cells they cover.
+///
+/// Usage example:
+/// \code
+/// std::vector<sf::Sprite> sprites = ...;
+///
+/// sf::SpatialGrid grid({128.f, 128.f});
+/// std::vector<std::size_t> spriteIds;
+/// for (const sf::Sprite& sprite : sprites)
+///     spriteIds.push_back(grid.insert(sprite.getGlobalBounds()));
+///
+/// // When a sprite moves
+/// grid.update(spriteIds[index], sprites[index].getGlobalBounds());
+///
+/// // Every frame
+/// std::vector<std::size_t> visible;
+/// grid.query(window.getView(), visible);
+/// for (const std::size_t id : visible)
+///     window.draw(sprites[id]); // identifiers match the indices when no sprite is removed
+/// \endcode
+///
+/// \see `sf::View`, `sf::RenderTarget`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,394 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+class RenderTarget;
+class Sprite;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Collection of sprites sharing the same texture,
+///        drawn with a single draw call
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpriteBatch : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty sprite batch from a source texture
+    ///
+    /// \param texture Source texture shared by all the instances
+    ///
+    /// \see `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpriteBatch(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow construction from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SpriteBatch(const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SpriteBatch() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    /// Only the instances are copied, the graphics resources
+    /// are created again by the copy when it is first drawn.
+    ///
+    /// \param copy Instance to copy
+    ///
+    ////////////////////////////////////////////////////////////
+    SpriteBatch(const SpriteBatch& copy);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy assignment operator
+    ///
+    /// \param right Instance to assign
+    ///
+    /// \return Reference to self
+    ///
+    ////////////////////////////////////////////////////////////
+    SpriteBatch& operator=(const SpriteBatch& right);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SpriteBatch(SpriteBatch&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    SpriteBatch& operator=(SpriteBatch&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the source texture of the batch
+    ///
+    /// The `texture` argument refers to a texture that must
+    /// exist as long as the batch uses it. The texture
+    /// rectangles of the instances are left unchanged.
+    ///
+    /// \param texture New texture
+    ///
+    /// \see `getTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary texture
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTexture(const Texture&& texture) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the source texture of the batch
+    ///
+    /// \return Reference to the batch's texture
+    ///
+    /// \see `setTexture`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an instance to the batch
+    ///
+    /// The instance is rendered like a sprite using the same
+    /// texture rectangle, color and transform.
+    ///
+    /// \param transform   Transform of the instance, relative to the batch
+    /// \param textureRect Rectangle of the texture displayed by the instance
+    /// \param color       Color modulated with the texture
+    ///
+    /// \return Index of the new instance
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t addInstance(const Transform& transform, const IntRect& textureRect, Color color = Color::White);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an instance mirroring a sprite
+    ///
+    /// The transform, texture rectangle and color of the sprite
+    /// are copied. Its texture is ignored: the instance always
+    /// uses the texture of the batch.
+    ///
+    /// \param sprite Sprite to copy
+    ///
+    /// \return Index of the new instance
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t addInstance(const Sprite& sprite);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an instance from the batch
+    ///
+    /// The last instance is moved to the place of the removed
+    /// one, so that removal doesn't shift the whole batch.
+    /// The index of the last instance thus becomes `index`.
+    ///
+    /// \param index Index of the instance to remove
+    ///
+    ////////////////////////////////////////////////////////////
+    void removeInstance(std::size_t index);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the instances
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve storage for a number of instances
+    ///
+    /// \param instanceCount Number of instances to reserve storage for
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t instanceCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the number of instances in the batch
+    ///
+    /// \return Number of instances
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getInstanceCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the transform of an instance
+    ///
+    /// \param index     Index of the instance
+    /// \param transform New transform, relative to the batch
+    ///
+    /// \see `getInstanceTransform`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInstanceTransform(std::size_t index, const Transform& transform);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the texture rectangle of an instance
+    ///
+    /// \param index       Index of the instance
+    /// \param textureRect New texture rectangle
+    ///
+    /// \see `getInstanceTextureRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInstanceTextureRect(std::size_t index, const IntRect& textureRect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the color of an instance
+    ///
+    /// \param index Index of the instance
+    /// \param color New color
+    ///
+    /// \see `getInstanceColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setInstanceColor(std::size_t index, Color color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the transform of an instance
+    ///
+    /// \param index Index of the instance
+    ///
+    /// \return Transform of the instance
+    ///
+    /// \see `setInstanceTransform`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Transform getInstanceTransform(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture rectangle of an instance
+    ///
+    /// \param index Index of the instance
+    ///
+    /// \return Texture rectangle of the instance
+    ///
+    /// \see `setInstanceTextureRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const IntRect& getInstanceTextureRect(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the color of an instance
+    ///
+    /// \param index Index of the instance
+    ///
+    /// \return Color of the instance
+    ///
+    /// \see `setInstanceColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Color getInstanceColor(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports instanced drawing
+    ///
+    /// When instancing is not available, sprite batches are
+    /// still drawn, but their geometry is expanded on the CPU.
+    ///
+    /// \return `true` if instanced drawing is supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isInstancingAvailable();
+
+private:
+    friend class RenderTarget;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the sprite batch to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the instance buffer and set up the vertex arrays
+    ///
+    /// Called by the render target once its context is active
+    /// and its states are applied. The instance data is uploaded
+    /// first if it changed since the last draw.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setupInstanceArrays() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the vertex arrays set up by `setupInstanceArrays`
+    ///
+    ////////////////////////////////////////////////////////////
+    void cleanupInstanceArrays() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Expand the instances into triangles
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateVertices() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the instance data as modified
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate();
+
+    struct Instancing;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const Texture*                      m_texture;              //!< Texture shared by all the instances
+    std::vector<float>                  m_transforms;           //!< First two rows of each instance's transform, 6 floats per instance
+    std::vector<IntRect>                m_textureRects;         //!< Texture rectangle of each instance
+    std::vector<Color>                  m_colors;               //!< Color of each instance
+    mutable std::vector<Vertex>         m_vertices;             //!< Expanded geometry used when instancing is not available
+    mutable bool                        m_verticesNeedUpdate{}; //!< Do the expanded vertices need to be rebuilt?
+    mutable bool                        m_needUpload{};         //!< Does the instance buffer need to be uploaded?
+    mutable std::unique_ptr<Instancing> m_instancing;           //!< Graphics resources used for instanced drawing
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpriteBatch
+/// \ingroup graphics
+///
+/// `sf::SpriteBatch` draws a large number of sprites that share
+/// a single texture, such as particles or the tiles of a map
+/// layer, with one draw call.
+///
+/// Each instance has its own transform, texture rectangle and
+/// color. They are stored as separate compact arrays (structure
+/// of arrays) which are uploaded to the graphics card only when
+/// they change, so that static batches cost nothing to keep
+/// around.
+///
+/// When the system supports it, the batch is drawn with
+/// instanced rendering: the instance arrays are read directly
+/// by a built-in shader and only 4 vertices are submitted. When
+/// instancing is not available, or when a custom shader is
+/// given in the render states, the instances are expanded into
+/// triangles on the CPU instead, so that the batch always
+/// renders the same way. Blend mode, stencil mode and render
+/// textures work with both paths.
+///
+/// `sf::SpriteBatch` also inherits the functions of
+/// `sf::Transformable`, which transform the whole batch.
+///
+/// As with `sf::Sprite`, the texture is not copied and must
+/// remain alive as long as the batch uses it.
+///
+/// Usage example:
+/// \code
+/// const sf::Texture texture("particles.png");
+///
+/// sf::SpriteBatch batch(texture);
+/// batch.reserve(particles.size());
+///
+/// for (const Particle& particle : particles)
+/// {
+///     sf::Transform transform;
+///     transform.translate(particle.position).rotate(particle.rotation);
+///     batch.addInstance(transform, {{0, 0}, {8, 8}}, particle.color);
+/// }
+///
+/// window.draw(batch);
+/// \endcode
+///
+/// \see `sf::Sprite`, `sf::Texture`
+///
+////////////////////////////////////////////////////////////
@@ -40,6 +40,8 @@
 #include <SFML/System/String.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <vector>
+
 #include <cstddef>
 #include <cstdint>
 
@@ -106,6 +108,10 @@ public:
     /// \endcode
     /// A text's string is empty by default.
     ///
+    /// Only the characters from the first one that differs from
+    /// the previous string are laid out again, which makes
+    /// appending to a long string cheap.
+    ///
     /// \param string New string
     ///
     /// \see `getString`
@@ -209,6 +215,9 @@ public:
     /// Setting the fill color to a transparent color with an outline
     /// will cause the outline to be displayed in the fill area of the text.
     ///
+    /// This also resets the colors of all the characters set
+    /// with `setFillColor(Color, std::size_t, std::size_t)`.
+    ///
     /// \param color New fill color of the text
     ///
     /// \see `getFillColor`
@@ -216,6 +225,28 @@ public:
     ////////////////////////////////////////////////////////////
     void setFillColor(Color color);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the fill color of a range of characters
+    ///
+    /// The vertices of the characters are recolored in place,
+    /// the text is not laid out again. The colors stick to
+    /// the characters when the string is changed: characters
+    /// that are kept, from the start of the string up to the
+    /// first changed one, keep their color, and new characters
+    /// get the fill color of the text.
+    ///
+    /// Underlines and strike throughs keep the fill color of
+    /// the text.
+    ///
+    /// \param color New fill color of the characters
+    /// \param first Index of the first character to recolor
+    /// \param count Number of characters to recolor
+    ///
+    /// \see `getFillColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFillColor(Color color, std::size_t first, std::size_t count);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set the outline color of the text
     ///
@@ -243,6 +274,41 @@ public:
     ////////////////////////////////////////////////////////////
     void setOutlineThickness(float thickness);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the color of the text's glow
+    ///
+    /// The glow fades from this color at the outline, or at the
+    /// edge of the glyphs without outline, to transparent at
+    /// the glow thickness. It is only drawn when the font renders
+    /// texts with a distance field.
+    ///
+    /// By default, the glow color is opaque black.
+    ///
+    /// \param color New glow color of the text
+    ///
+    /// \see `getGlowColor`, `sf::Font::setDistanceFieldEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGlowColor(Color color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the thickness of the text's glow
+    ///
+    /// The glow is only drawn when the font renders texts with
+    /// a distance field. The outline and the glow together can't
+    /// extend further than `sf::Font::DistanceFieldSpread` pixels,
+    /// scaled from `sf::Font::DistanceFieldCharacterSize` to the
+    /// character size.
+    ///
+    /// By default, the glow thickness is 0.
+    ///
+    /// \param thickness New glow thickness, in pixels
+    ///
+    /// \see `getGlowThickness`, `sf::Font::setDistanceFieldEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGlowThickness(float thickness);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the text's string
     ///
@@ -325,6 +391,18 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Color getFillColor() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the fill color of a character
+    ///
+    /// \param index Index of the character
+    ///
+    /// \return Fill color of the character, or of the text if `index` is out of range
+    ///
+    /// \see `setFillColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Color getFillColor(std::size_t index) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the outline color of the text
     ///
@@ -345,6 +423,26 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] float getOutlineThickness() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the glow color of the text
+    ///
+    /// \return Glow color of the text
+    ///
+    /// \see `setGlowColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Color getGlowColor() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the glow thickness of the text
+    ///
+    /// \return Glow thickness of the text, in pixels
+    ///
+    /// \see `setGlowThickness`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getGlowThickness() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the position of the `index`-th character
     ///
@@ -409,6 +507,22 @@ private:
     ////////////////////////////////////////////////////////////
     void ensureGeometryUpdate() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Layout state of the text before one of its characters
+    ///
+    /// Allows to lay out the text again from any character,
+    /// and to find the position of any character immediately.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct CharacterLayout
+    {
+        Vector2f    position;             //!< Position of the pen before the character and its kerning
+        std::size_t vertexCount{};        //!< Number of fill vertices before the character
+        std::size_t outlineVertexCount{}; //!< Number of outline vertices before the character
+        Vector2f    minimum;              //!< Minimum coordinates of the geometry before the character
+        Vector2f    maximum;              //!< Maximum coordinates of the geometry before the character
+    };
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -421,11 +535,16 @@ private:
     Color                 m_fillColor{Color::White};                   //!< Text fill color
     Color                 m_outlineColor{Color::Black};                //!< Text outline color
     float                 m_outlineThickness{0.f};                     //!< Thickness of the text's outline
+    Color                 m_glowColor{Color::Black};                   //!< Text glow color
+    float                 m_glowThickness{0.f};                        //!< Thickness of the text's glow
     mutable VertexArray   m_vertices{PrimitiveType::Triangles};        //!< Vertex array containing the fill geometry
     mutable VertexArray   m_outlineVertices{PrimitiveType::Triangles}; //!< Vertex array containing the outline geometry
     mutable FloatRect     m_bounds;               //!< Bounding rectangle of the text (in local coordinates)
     mutable bool          m_geometryNeedUpdate{}; //!< Does the geometry need to be recomputed?
     mutable std::uint64_t m_fontTextureId{};      //!< The font texture id
+    mutable std::vector<CharacterLayout> m_layout;                //!< Layout before each character and at the end
+    mutable std::size_t                  m_validCharacterCount{}; //!< Number of leading characters laid out
+    std::vector<Color>                   m_characterColors;       //!< Fill color of each character, or empty
 };
 
 } // namespace sf
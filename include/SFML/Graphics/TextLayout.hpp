@@ -0,0 +1,352 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <SFML/System/String.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+class Font;
+class RenderTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Paragraph of styled text runs, wrapped to a width
+///        and drawn with a few draw calls
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextLayout : public Drawable, public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Piece of text sharing the same font and style
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Run
+    {
+        const Font*   font{};                     //!< Font used to draw the run, must not be null
+        String        string;                     //!< Text of the run
+        unsigned int  characterSize{30};          //!< Base size of the characters, in pixels
+        std::uint32_t style{Text::Regular};       //!< Combination of `sf::Text::Style` flags
+        Color         fillColor{Color::White};    //!< Fill color of the characters
+        Color         outlineColor{Color::Black}; //!< Outline color of the characters
+        float         outlineThickness{};         //!< Thickness of the outline of the characters, in pixels
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty layout, which doesn't wrap its lines.
+    ///
+    ////////////////////////////////////////////////////////////
+    TextLayout() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a run to the end of the layout
+    ///
+    /// The run is laid out right after the previous one, on the
+    /// same line; start its string with `'\n'` to begin a new line.
+    ///
+    /// \param run Run to append, its font must be set
+    ///
+    ////////////////////////////////////////////////////////////
+    void addRun(Run run);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append a run with the default style to the end of the layout
+    ///
+    /// \param font          Font used to draw the run
+    /// \param string        Text of the run
+    /// \param characterSize Base size of the characters, in pixels
+    /// \param style         Combination of `sf::Text::Style` flags
+    /// \param fillColor     Fill color of the characters
+    ///
+    ////////////////////////////////////////////////////////////
+    void addRun(const Font&   font,
+                String        string,
+                unsigned int  characterSize = 30,
+                std::uint32_t style         = Text::Regular,
+                Color         fillColor     = Color::White);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow runs drawn with a temporary font
+    ///
+    ////////////////////////////////////////////////////////////
+    void addRun(const Font&&  font,
+                String        string,
+                unsigned int  characterSize = 30,
+                std::uint32_t style         = Text::Regular,
+                Color         fillColor     = Color::White) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace a run of the layout
+    ///
+    /// \param index Index of the run to replace
+    /// \param run   New run, its font must be set
+    ///
+    /// \see `getRun`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRun(std::size_t index, Run run);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the runs of the layout
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of runs of the layout
+    ///
+    /// \return Number of runs
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getRunCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a run of the layout
+    ///
+    /// \param index Index of the run
+    ///
+    /// \return Run at the given index
+    ///
+    /// \see `setRun`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Run& getRun(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the width at which lines are wrapped
+    ///
+    /// Lines are broken after the last whitespace that fits in
+    /// the width, or before the first character that doesn't fit
+    /// if a word is wider than the whole width.
+    /// A width of 0 disables the wrapping, lines only end at `'\n'`.
+    /// The wrap width is 0 by default.
+    ///
+    /// \param width Maximum width of the lines, in pixels
+    ///
+    /// \see `getWrapWidth`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setWrapWidth(float width);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the width at which lines are wrapped
+    ///
+    /// \return Maximum width of the lines, in pixels
+    ///
+    /// \see `setWrapWidth`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getWrapWidth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the line spacing factor
+    ///
+    /// The spacing of each line is the largest line spacing of
+    /// the runs it contains, multiplied by this factor.
+    /// The default spacing between lines is 1.
+    ///
+    /// \param spacingFactor New line spacing factor
+    ///
+    /// \see `getLineSpacing`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setLineSpacing(float spacingFactor);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the line spacing factor
+    ///
+    /// \return Line spacing factor
+    ///
+    /// \see `setLineSpacing`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getLineSpacing() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of lines of the layout
+    ///
+    /// This counts the lines ended by `'\n'` and the lines
+    /// created by the wrapping.
+    ///
+    /// \return Number of lines
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getLineCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of batches of the layout
+    ///
+    /// Runs that use the same font and character size share the
+    /// same glyph texture and end up in the same batch. Each
+    /// batch is drawn with one draw call, plus one for the
+    /// outlines if any of its runs has an outline.
+    ///
+    /// \return Number of batches
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getBatchCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in local coordinates, which means
+    /// that it ignores the transformations (translation, rotation,
+    /// scale, ...) that are applied to the entity.
+    /// In other words, this function returns the bounds of the
+    /// entity in the entity's coordinate system.
+    ///
+    /// \return Local bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global bounding rectangle of the entity
+    ///
+    /// The returned rectangle is in global coordinates, which means
+    /// that it takes into account the transformations (translation,
+    /// rotation, scale, ...) that are applied to the entity.
+    /// In other words, this function returns the bounds of the
+    /// layout in the global 2D world's coordinate system.
+    ///
+    /// \return Global bounding rectangle of the entity
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the layout to a render target
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make sure the layout's geometry is updated
+    ///
+    /// All the attributes related to rendering are cached, such
+    /// that the geometry is only updated when necessary.
+    ///
+    ////////////////////////////////////////////////////////////
+    void ensureGeometryUpdate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Geometry of the runs sharing a glyph texture
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Batch
+    {
+        const Font*   font{};                                    //!< Font of the glyph texture
+        unsigned int  characterSize{};                           //!< Character size of the glyph texture
+        std::uint64_t textureId{};                               //!< Cache id of the glyph texture before layout
+        VertexArray   vertices{PrimitiveType::Triangles};        //!< Fill vertices of the batch
+        VertexArray   outlineVertices{PrimitiveType::Triangles}; //!< Outline vertices of the batch
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Run>           m_runs;                   //!< Runs of the layout
+    float                      m_wrapWidth{};            //!< Maximum width of the lines, 0 to disable wrapping
+    float                      m_lineSpacingFactor{1.f}; //!< Spacing factor between lines
+    mutable std::vector<Batch> m_batches;                //!< Geometry of the layout, one batch per glyph texture
+    mutable std::size_t        m_lineCount{};            //!< Number of lines of the layout
+    mutable FloatRect          m_bounds;                 //!< Bounding rectangle of the layout (in local coordinates)
+    mutable bool               m_geometryNeedUpdate{};   //!< Does the geometry need to be recomputed?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextLayout
+/// \ingroup graphics
+///
+/// `sf::TextLayout` displays a paragraph made of several runs
+/// of text, each with its own font, character size, style and
+/// colors, such as a sentence with a bold word or a link in
+/// a different color. Drawing the same paragraph with
+/// `sf::Text` requires one instance and at least one draw call
+/// per run, and doesn't wrap the lines.
+///
+/// The runs are laid out one after the other, and the lines
+/// are wrapped at the wrap width if one is set. The geometry
+/// of all the runs that use the same font and character size,
+/// and therefore the same glyph texture, is gathered in a
+/// single vertex array, plus one for their outlines. A whole
+/// panel of text in a couple of fonts and sizes is therefore
+/// drawn in a handful of draw calls.
+///
+/// The glyphs are always taken from the rasterized pages of
+/// the font, at the character size of each run, even when the
+/// distance field mode of `sf::Font` is enabled: that mode is
+/// used by `sf::Text` only.
+///
+/// Like `sf::Text`, `sf::TextLayout` doesn't copy the fonts
+/// that it uses, they must stay alive as long as the layout
+/// uses them.
+///
+/// Usage example:
+/// \code
+/// const sf::Font font("arial.ttf");
+/// const sf::Font mono("courier.ttf");
+///
+/// sf::TextLayout layout;
+/// layout.setWrapWidth(400);
+/// layout.addRun(font, "Press ", 20);
+/// layout.addRun(mono, "Ctrl+S", 20, sf::Text::Bold, sf::Color::Yellow);
+/// layout.addRun(font, " to save the document.", 20);
+///
+/// window.draw(layout);
+/// \endcode
+///
+/// \see `sf::Text`, `sf::Font`
+///
+////////////////////////////////////////////////////////////
@@ -287,6 +287,14 @@ public:
     /// If the `area` rectangle crosses the bounds of the image, it
     /// is adjusted to fit the image size.
     ///
+    /// Besides the image formats supported by `sf::Image`, DDS and
+    /// KTX2 files are supported. Their compressed pixels (BC1, BC3,
+    /// BC7, ETC2 or ASTC) and mipmap levels are uploaded as they
+    /// are when the graphics driver supports their format and the
+    /// whole texture is loaded; otherwise BC1 and BC3 pixels are
+    /// decompressed and the mipmap is generated. Compressed
+    /// textures can't be updated afterwards.
+    ///
     /// The maximum size for a texture depends on the graphics
     /// driver and can be retrieved with the `getMaximumSize` function.
     ///
@@ -312,6 +320,14 @@ public:
     /// If the `area` rectangle crosses the bounds of the image, it
     /// is adjusted to fit the image size.
     ///
+    /// Besides the image formats supported by `sf::Image`, DDS and
+    /// KTX2 files are supported. Their compressed pixels (BC1, BC3,
+    /// BC7, ETC2 or ASTC) and mipmap levels are uploaded as they
+    /// are when the graphics driver supports their format and the
+    /// whole texture is loaded; otherwise BC1 and BC3 pixels are
+    /// decompressed and the mipmap is generated. Compressed
+    /// textures can't be updated afterwards.
+    ///
     /// The maximum size for a texture depends on the graphics
     /// driver and can be retrieved with the `getMaximumSize` function.
     ///
@@ -338,6 +354,14 @@ public:
     /// If the `area` rectangle crosses the bounds of the image, it
     /// is adjusted to fit the image size.
     ///
+    /// Besides the image formats supported by `sf::Image`, DDS and
+    /// KTX2 files are supported. Their compressed pixels (BC1, BC3,
+    /// BC7, ETC2 or ASTC) and mipmap levels are uploaded as they
+    /// are when the graphics driver supports their format and the
+    /// whole texture is loaded; otherwise BC1 and BC3 pixels are
+    /// decompressed and the mipmap is generated. Compressed
+    /// textures can't be updated afterwards.
+    ///
     /// The maximum size for a texture depends on the graphics
     /// driver and can be retrieved with the `getMaximumSize` function.
     ///
@@ -713,6 +737,9 @@ public:
 
 private:
     friend class Text;
+    friend class TextLayout;
+    friend class TextureReadback;
+    friend class TextureUploader;
     friend class RenderTexture;
     friend class RenderTarget;
 
@@ -731,6 +758,36 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static unsigned int getValidSize(unsigned int size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from an array of pixels
+    ///
+    /// Unlike `update`, `pixels` may be null: when a pixel
+    /// unpack buffer is bound, it's an offset in that buffer.
+    ///
+    /// \param pixels Array of pixels, or offset in the bound pixel unpack buffer
+    /// \param size   Width and height of the pixel region
+    /// \param dest   Coordinates of the destination position
+    ///
+    ////////////////////////////////////////////////////////////
+    void updatePixels(const void* pixels, Vector2u size, Vector2u dest);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Load the texture from a DDS or KTX2 file in memory
+    ///
+    /// Levels in a compressed format supported by the driver are
+    /// uploaded as they are, otherwise the first level is
+    /// decompressed on the CPU when possible.
+    ///
+    /// \param data Pointer to the file data in memory
+    /// \param size Size of the data to load, in bytes
+    /// \param sRgb `true` to enable sRGB conversion, `false` to disable it
+    /// \param area Area of the image to load
+    ///
+    /// \return `true` if loading was successful, `false` if it failed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool loadFromContainer(const void* data, std::size_t size, bool sRgb, const IntRect& area);
+
     ////////////////////////////////////////////////////////////
     /// \brief Invalidate the mipmap if one exists
     ///
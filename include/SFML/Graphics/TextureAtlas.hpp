@@ -0,0 +1,309 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+class SkylinePacker;
+}
+
+namespace sf
+{
+class Image;
+
+////////////////////////////////////////////////////////////
+/// \brief Texture packing many images together
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureAtlas
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty atlas, with 1 pixel of padding around
+    /// its entries.
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty atlas with a specific padding
+    ///
+    /// The padding is the number of transparent pixels left
+    /// between the entries, and between the entries and the
+    /// top and left edges of the texture. It prevents
+    /// neighboring entries from bleeding into each other when
+    /// the texture is smooth.
+    ///
+    /// \param padding Number of pixels left around the entries
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureAtlas(unsigned int padding);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureAtlas();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas(const TextureAtlas&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas(TextureAtlas&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureAtlas& operator=(TextureAtlas&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an image to the atlas
+    ///
+    /// The texture grows as needed, up to the maximum texture
+    /// size. Entries never move once added, so the returned
+    /// rectangle stays valid until the atlas is cleared.
+    ///
+    /// \param image Image to add
+    ///
+    /// \return Area of the texture containing the image, or `std::nullopt` if it couldn't be added
+    ///
+    /// \see `freeze`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<IntRect> add(const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an array of pixels to the atlas
+    ///
+    /// The pixel array is assumed to contain 32-bits RGBA pixels,
+    /// and have the given size.
+    ///
+    /// \param pixels Array of pixels to add
+    /// \param size   Width and height of the pixel array
+    ///
+    /// \return Area of the texture containing the pixels, or `std::nullopt` if they couldn't be added
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<IntRect> add(const std::uint8_t* pixels, Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add several images to the atlas at once
+    ///
+    /// The images are placed from the tallest to the shortest,
+    /// which packs them tighter than adding them one by one,
+    /// and the texture grows at most once.
+    ///
+    /// Either all images are added, or none of them.
+    ///
+    /// \param images Images to add
+    ///
+    /// \return Areas of the texture containing the images, in the same
+    ///         order as the images, or `std::nullopt` if they couldn't be added
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::vector<IntRect>> add(const std::vector<Image>& images);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop adding entries to the atlas
+    ///
+    /// The texture is cropped to the area covered by the entries
+    /// and the packing data is released. Entries keep their
+    /// position, and adding entries fails until the atlas
+    /// is cleared.
+    ///
+    /// Cropping reads the texture back from graphics memory,
+    /// so this should be done once, after loading.
+    ///
+    /// \see `isFrozen`, `clear`
+    ///
+    ////////////////////////////////////////////////////////////
+    void freeze();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the atlas is frozen
+    ///
+    /// \return `true` if entries can't be added anymore, `false` otherwise
+    ///
+    /// \see `freeze`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isFrozen() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the entries and release the texture
+    ///
+    /// The atlas can be filled again afterwards, even if it was frozen.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the texture containing the entries
+    ///
+    /// The texture is replaced when the atlas grows, so it
+    /// must be retrieved again after adding entries.
+    ///
+    /// \return Texture of the atlas
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of pixels left around the entries
+    ///
+    /// \return Padding of the entries, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getPadding() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter of the texture
+    ///
+    /// \param smooth `true` to enable smoothing, `false` to disable it
+    ///
+    /// \see `isSmooth`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter of the texture is enabled or not
+    ///
+    /// \return `true` if smoothing is enabled, `false` if it is disabled
+    ///
+    /// \see `setSmooth`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSmooth() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Pixels of an entry to add
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Pixels
+    {
+        const std::uint8_t* data{}; //!< 32-bits RGBA pixels
+        Vector2u            size;   //!< Width and height of the pixels
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Place entries in the atlas and upload their pixels
+    ///
+    /// \param entries Pixels of the entries to add
+    ///
+    /// \return Areas of the texture containing the entries, or `std::nullopt` on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::vector<IntRect>> insert(const std::vector<Pixels>& entries);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the texture with a bigger one, keeping its contents
+    ///
+    /// \param size New size of the texture
+    ///
+    /// \return `true` if the texture was resized
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool resizeTexture(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Texture                              m_texture;    //!< Texture containing the entries
+    std::unique_ptr<priv::SkylinePacker> m_packer;     //!< Placement of the entries, released when frozen
+    unsigned int                         m_padding{1}; //!< Number of pixels left around the entries
+    bool                                 m_isSmooth{}; //!< Status of the smooth filter
+    bool                                 m_isFrozen{}; //!< Can entries still be added?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureAtlas
+/// \ingroup graphics
+///
+/// `sf::TextureAtlas` packs many small images into a single
+/// texture. Drawing several sprites from the same texture
+/// doesn't require switching textures, which lets the
+/// render target batch them into fewer draw calls, and
+/// only one texture has to be kept alive.
+///
+/// Entries are placed with a skyline packer and the texture
+/// grows on demand. Once an entry is added, its area of the
+/// texture never changes.
+///
+/// When all the entries are added, `freeze` crops the texture
+/// to the area that is actually used.
+///
+/// Usage example:
+/// \code
+/// sf::TextureAtlas atlas;
+///
+/// const auto playerRect = atlas.add(sf::Image("player.png")).value();
+/// const auto tileRects  = atlas.add(tileImages).value();
+/// atlas.freeze();
+///
+/// sf::Sprite player(atlas.getTexture(), playerRect);
+/// sf::Sprite tile(atlas.getTexture(), tileRects[0]);
+/// \endcode
+///
+/// \see `sf::Texture`, `sf::Sprite`
+///
+////////////////////////////////////////////////////////////
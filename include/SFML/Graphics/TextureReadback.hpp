@@ -0,0 +1,262 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+#include <optional>
+
+
+namespace sf
+{
+class RenderWindow;
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Copy the pixels of a texture or a window to an
+///        image without waiting for the GPU
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureReadback : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates a readback that is not reading any texture.
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the readback and start reading a texture
+    ///
+    /// \param texture Texture to read
+    ///
+    /// \see `start`
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit TextureReadback(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureReadback();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback(const TextureReadback&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback& operator=(const TextureReadback&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback(TextureReadback&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureReadback& operator=(TextureReadback&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start reading the current pixels of a texture
+    ///
+    /// The GPU copies the pixels to a pixel buffer once it
+    /// has finished the commands that draw to the texture;
+    /// this function returns without waiting for it. The
+    /// texture can be modified or destroyed right after.
+    ///
+    /// A readback that is started again drops the pixels it
+    /// was reading, and reuses its pixel buffer, so it's cheap
+    /// to start a few readbacks in turn every frame.
+    ///
+    /// \param texture Texture to read
+    ///
+    /// \return `true` if reading started, `false` if the texture is empty
+    ///
+    /// \see `isReady`, `getImage`
+    ///
+    ////////////////////////////////////////////////////////////
+    bool start(const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start reading the current pixels of a window
+    ///
+    /// The pixels are read from the back buffer of the window,
+    /// so this function must be called after drawing and
+    /// before `display`, like `Texture::update(const Window&)`.
+    /// The draws gathered by the batching mode of the window
+    /// are submitted first. Like for a texture, this function
+    /// returns without waiting for the GPU, and the window can
+    /// be displayed and drawn again right after.
+    ///
+    /// \param window Window to read
+    ///
+    /// \return `true` if reading started, `false` if the window couldn't be activated
+    ///
+    /// \see `isReady`, `getImage`
+    ///
+    ////////////////////////////////////////////////////////////
+    bool start(RenderWindow& window);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the pixels have arrived
+    ///
+    /// This function never waits for the GPU. The pixels are
+    /// usually ready one or two frames after `start`.
+    ///
+    /// \return `true` if `getImage` can return the image without waiting
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isReady() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the pixels if they have arrived
+    ///
+    /// Once returned, the image is dropped from the readback.
+    ///
+    /// \return Image holding the pixels as they were at the
+    ///         call to `start`, or `std::nullopt` if they
+    ///         haven't arrived yet or nothing is read
+    ///
+    /// \see `waitForImage`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Image> getImage();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for the pixels and get them
+    ///
+    /// This function blocks until the GPU has copied the
+    /// pixels, like `Texture::copyToImage`. Once returned,
+    /// the image is dropped from the readback.
+    ///
+    /// \return Image holding the pixels as they were at the
+    ///         call to `start`, or `std::nullopt` if nothing
+    ///         is read
+    ///
+    /// \see `getImage`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Image> waitForImage();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the texture or window being read
+    ///
+    /// \return Size of the image, in pixels, or (0, 0) if nothing is read
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports asynchronous readbacks
+    ///
+    /// Asynchronous readbacks need pixel buffer objects, mapping
+    /// of buffer ranges and sync objects. When they are not
+    /// available, `sf::TextureReadback` still works, but `start`
+    /// copies the pixels synchronously, like
+    /// `Texture::copyToImage`, and the image is ready right away.
+    ///
+    /// \return `true` if asynchronous readbacks are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureReadback
+/// \ingroup graphics
+///
+/// `Texture::copyToImage` waits until the GPU has finished
+/// drawing to the texture and has copied its pixels, which
+/// stalls the thread that renders for a whole frame when
+/// called every frame, for example to record a video of a
+/// `sf::RenderTexture`.
+///
+/// `sf::TextureReadback` asks the GPU to copy the pixels to a
+/// pixel buffer object instead, and returns right away. A
+/// fence tells when the copy is done, usually one or two
+/// frames later, and the pixels are then read from the pixel
+/// buffer without waiting.
+///
+/// The pixels of a `sf::RenderWindow` can be read the same
+/// way, from its back buffer, to take screenshots or record
+/// the window without copying it to a texture first.
+///
+/// Usage example:
+/// \code
+/// // A few readbacks in flight, reused in turn
+/// std::array<sf::TextureReadback, 3> readbacks;
+/// std::size_t frame = 0;
+///
+/// while (window.isOpen())
+/// {
+///     renderTexture.clear();
+///     renderTexture.draw(scene);
+///     renderTexture.display();
+///
+///     // Collect the frame captured a few frames ago, then capture this one
+///     sf::TextureReadback& readback = readbacks[frame++ % readbacks.size()];
+///     if (std::optional<sf::Image> image = readback.waitForImage())
+///         recorder.addFrame(*image);
+///     readback.start(renderTexture.getTexture());
+///
+///     // Draw renderTexture to the window...
+/// }
+/// \endcode
+///
+/// \see `sf::Texture`, `sf::Image`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,235 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <memory>
+
+#include <cstdint>
+
+
+namespace sf
+{
+class Texture;
+
+////////////////////////////////////////////////////////////
+/// \brief Upload pixels to textures without stalling the
+///        thread that renders
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureUploader : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The pixel buffer is only created on the first upload.
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureUploader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Uploads that were submitted still complete.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureUploader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureUploader(const TextureUploader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureUploader& operator=(const TextureUploader&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureUploader(TextureUploader&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureUploader& operator=(TextureUploader&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get memory to write the pixels of an upload to
+    ///
+    /// The returned memory holds `size.x * size.y` RGBA pixels.
+    /// When pixel buffers are available, it's mapped memory of
+    /// the pixel buffer: pixels decoded directly into it are
+    /// never copied by the CPU. Otherwise, it's a staging array.
+    ///
+    /// The memory is valid until `unmap` is called, which must
+    /// happen before any other call to `map` or `update`.
+    ///
+    /// \param size Width and height of the pixel region to upload
+    ///
+    /// \return Pointer to the memory to write the pixels to, or a
+    ///         null pointer if `size` is empty or mapping failed
+    ///
+    /// \see `unmap`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint8_t* map(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Submit the upload of the mapped pixels to a texture
+    ///
+    /// The texture is updated from the pixel buffer by the GPU,
+    /// the function returns without waiting for the transfer.
+    /// Drawing the texture afterwards is always correct, the
+    /// GPU finishes the transfer first.
+    ///
+    /// The pixel region must fit in the texture.
+    ///
+    /// \param texture Texture to update
+    /// \param dest    Coordinates of the destination position
+    ///
+    /// \return Identifier of the upload, to pass to `isComplete`,
+    ///         or 0 if the upload failed
+    ///
+    /// \see `map`, `isComplete`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t unmap(Texture& texture, Vector2u dest = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload an array of pixels to a texture
+    ///
+    /// This function copies the pixels to the pixel buffer and
+    /// submits the upload; it's a shortcut for `map`, a copy,
+    /// and `unmap`. Prefer writing the pixels to the memory
+    /// returned by `map` when possible, to avoid the copy.
+    ///
+    /// \param texture Texture to update
+    /// \param pixels  Array of pixels to copy to the texture
+    /// \param size    Width and height of the pixel region contained in `pixels`
+    /// \param dest    Coordinates of the destination position
+    ///
+    /// \return Identifier of the upload, to pass to `isComplete`,
+    ///         or 0 if the upload failed
+    ///
+    /// \see `isComplete`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t update(Texture&            texture,
+                                       const std::uint8_t* pixels,
+                                       Vector2u            size,
+                                       Vector2u            dest = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the GPU has finished an upload
+    ///
+    /// This function never waits for the GPU. Without sync
+    /// objects, or without pixel buffers, uploads are reported
+    /// complete as soon as they're submitted.
+    ///
+    /// \param upload Identifier of the upload returned by `unmap` or `update`
+    ///
+    /// \return `true` if the upload is complete (always the case for 0)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isComplete(std::uint64_t upload) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports asynchronous uploads
+    ///
+    /// Asynchronous uploads need pixel buffer objects and
+    /// mapping of buffer ranges. When they are not available,
+    /// `sf::TextureUploader` still works, but `unmap` and
+    /// `update` upload the pixels synchronously.
+    ///
+    /// \return `true` if asynchronous uploads are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    std::unique_ptr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureUploader
+/// \ingroup graphics
+///
+/// `Texture::update` copies the pixels from client memory
+/// before it returns, which stalls the thread that renders
+/// when the pixels are large, such as video frames or
+/// streamed tiles. `sf::TextureUploader` stages the pixels in
+/// a ring-buffered pixel buffer object instead: the pixels
+/// are written straight into memory mapped by the driver, and
+/// the GPU copies them to the texture on its own time.
+///
+/// The ring buffer orphans its storage when it's full, so
+/// writing never waits for the GPU to finish earlier
+/// uploads. `isComplete` tells when an upload is done,
+/// without blocking, for example to recycle the decoder's
+/// frame or to report streaming progress.
+///
+/// Usage example:
+/// \code
+/// sf::Texture frameTexture({1920, 1080});
+/// sf::TextureUploader uploader;
+///
+/// // Decode the next video frame straight into the pixel buffer
+/// if (std::uint8_t* pixels = uploader.map(frameTexture.getSize()))
+///     decoder.decodeFrame(pixels);
+/// const std::uint64_t upload = uploader.unmap(frameTexture);
+///
+/// // Draw as usual, the GPU finishes the upload first
+/// window.draw(sf::Sprite(frameTexture));
+///
+/// // Later...
+/// if (uploader.isComplete(upload))
+///     decoder.recycleFrame();
+/// \endcode
+///
+/// \see `sf::Texture`
+///
+////////////////////////////////////////////////////////////
@@ -35,6 +35,8 @@
 
 #include <array>
 
+#include <cstddef>
+
 
 namespace sf
 {
@@ -115,6 +117,21 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] constexpr Vector2f transformPoint(Vector2f point) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform an array of 2D points in place
+    ///
+    /// The result is the same as calling `transformPoint` on
+    /// every point, but the loop is written so that compilers
+    /// can vectorize it.
+    ///
+    /// \param points Pointer to the points to transform
+    /// \param count  Number of points in the array
+    ///
+    /// \see `transformPoint`
+    ///
+    ////////////////////////////////////////////////////////////
+    SFML_GRAPHICS_API void transformPoints(Vector2f* points, std::size_t count) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Transform a rectangle
     ///
@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Block of uniform values stored in graphics memory,
+///        shared by several shaders
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API UniformBuffer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty uniform buffer.
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UniformBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(UniformBuffer&& source) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(UniformBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the uniform buffer
+    ///
+    /// Creates the uniform buffer and allocates \p size bytes of
+    /// graphics memory, with undefined contents. Any previously
+    /// allocated memory is freed in the process, but shaders
+    /// using the buffer keep using it.
+    ///
+    /// \param size Size of the buffer, in bytes
+    ///
+    /// \return `true` if creation was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool create(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the buffer
+    ///
+    /// \return Size of the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the whole buffer
+    ///
+    /// \p data must point to `getSize()` bytes laid out as
+    /// the uniform block of the shaders (usually with the
+    /// `std140` layout).
+    ///
+    /// \param data Pointer to the new contents of the buffer
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer
+    ///
+    /// The range must fit in the buffer.
+    ///
+    /// \param data   Pointer to the new contents of the range
+    /// \param size   Size of the range, in bytes
+    /// \param offset Offset of the range in the buffer, in bytes
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data, std::size_t size, std::size_t offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the uniform buffer
+    ///
+    /// You shouldn't need to use this function, unless you have
+    /// very specific stuff to implement that SFML doesn't support,
+    /// or implement a temporary workaround until a bug is fixed.
+    ///
+    /// \return OpenGL handle of the uniform buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports uniform buffers
+    ///
+    /// This function should always be called before using
+    /// the uniform buffer features. If it returns `false`, then
+    /// any attempt to use `sf::UniformBuffer` will fail.
+    ///
+    /// \return `true` if uniform buffers are supported, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_buffer{}; //!< Internal buffer identifier
+    std::size_t  m_size{};   //!< Size in bytes of the currently allocated buffer
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UniformBuffer
+/// \ingroup graphics
+///
+/// `sf::UniformBuffer` stores the values of a uniform block
+/// in graphics memory. Uniform blocks group uniforms of
+/// a shader in a GLSL interface block:
+/// \code
+/// #version 140
+/// layout(std140) uniform Frame
+/// {
+///     mat4  camera;
+///     vec4  ambient;
+///     float time;
+/// };
+/// \endcode
+///
+/// Data shared by many shaders, such as a camera, lights or
+/// the time, can then be uploaded once per frame with
+/// `update`, instead of being set on each shader. Each
+/// shader refers to the buffer with `sf::Shader::setUniformBlock`,
+/// and the buffer is bound when the shader is used.
+///
+/// The contents of the buffer must follow the layout of
+/// the block. With the `std140` layout, vectors of 3 or 4
+/// components and matrix columns are aligned on 16 bytes.
+///
+/// Usage example:
+/// \code
+/// struct Frame
+/// {
+///     std::array<float, 16> camera;
+///     std::array<float, 4>  ambient;
+///     float                 time;
+///     std::array<float, 3>  padding;
+/// };
+///
+/// sf::UniformBuffer buffer;
+/// if (!buffer.create(sizeof(Frame)))
+///     // error...
+///
+/// for (sf::Shader* shader : shaders)
+///     shader->setUniformBlock("Frame", buffer);
+///
+/// // Once per frame
+/// const Frame frame = ...;
+/// if (!buffer.update(&frame))
+///     // error...
+/// \endcode
+///
+/// Uniform buffers require OpenGL 3.1 or the
+/// ARB_uniform_buffer_object extension.
+///
+/// \see `sf::Shader`
+///
+////////////////////////////////////////////////////////////
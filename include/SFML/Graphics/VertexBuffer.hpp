@@ -35,6 +35,8 @@
 
 #include <SFML/Window/GlResource.hpp>
 
+#include <memory>
+
 #include <cstddef>
 
 
@@ -73,7 +75,7 @@ public:
     /// Creates an empty vertex buffer.
     ///
     ////////////////////////////////////////////////////////////
-    VertexBuffer() = default;
+    VertexBuffer();
 
     ////////////////////////////////////////////////////////////
     /// \brief Construct a `VertexBuffer` with a specific `PrimitiveType`
@@ -286,6 +288,45 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Usage getUsage() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of buffer objects that updates cycle through
+    ///
+    /// By default, the vertices are stored in a single OpenGL
+    /// buffer object. Updating it while the GPU is still drawing
+    /// its previous contents may stall until the GPU is done.
+    ///
+    /// With a buffer count greater than 1, each update writes
+    /// into the next buffer object of a ring instead, which then
+    /// becomes the one that is drawn. The GPU is usually done
+    /// with that buffer object, and when it isn't, its storage
+    /// is replaced rather than waited for. Vertices that a
+    /// partial update doesn't overwrite are copied from the
+    /// previously drawn buffer object on the GPU.
+    ///
+    /// 2 or 3 buffer objects are enough for vertices updated
+    /// once per frame. The new count takes effect on the next
+    /// update. Streaming updates must not be made from several
+    /// threads at once.
+    ///
+    /// The default buffer count is 1.
+    ///
+    /// \param count Number of buffer objects, 1 to disable streaming
+    ///
+    /// \see `getBufferCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBufferCount(std::size_t count);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of buffer objects that updates cycle through
+    ///
+    /// \return Number of buffer objects
+    ///
+    /// \see `setBufferCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getBufferCount() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Bind a vertex buffer for rendering
     ///
@@ -331,13 +372,40 @@ private:
     ////////////////////////////////////////////////////////////
     void draw(RenderTarget& target, RenderStates states) const override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Resize the ring of buffer objects to the buffer count
+    ///
+    /// The current buffer object is always kept.
+    ///
+    ////////////////////////////////////////////////////////////
+    void resizeRing();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the next buffer object of the ring and make it current
+    ///
+    /// \param vertices    Array of vertices to copy to the buffer
+    /// \param vertexCount Number of vertices to copy
+    /// \param offset      Offset in the buffer to copy to
+    ///
+    /// \return `true` if the update was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool streamVertices(const Vertex* vertices, std::size_t vertexCount, unsigned int offset);
+
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    struct Ring;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int  m_buffer{};                             //!< Internal buffer identifier
-    std::size_t   m_size{};                               //!< Size in Vertices of the currently allocated buffer
-    PrimitiveType m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
-    Usage         m_usage{Usage::Stream};                 //!< How this vertex buffer is to be used
+    unsigned int          m_buffer{};                             //!< Internal buffer identifier
+    std::size_t           m_size{};                               //!< Size in Vertices of the currently allocated buffer
+    PrimitiveType         m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
+    Usage                 m_usage{Usage::Stream};                 //!< How this vertex buffer is to be used
+    std::size_t           m_bufferCount{1};                       //!< Number of buffer objects updates cycle through
+    std::unique_ptr<Ring> m_ring;                                 //!< Buffer objects cycled through, when streaming
 };
 
 ////////////////////////////////////////////////////////////
@@ -395,6 +463,11 @@ SFML_GRAPHICS_API void swap(VertexBuffer& left, VertexBuffer& right) noexcept;
 /// pending data transfers complete before the vertex buffer is sourced
 /// by the rendering pipeline.
 ///
+/// Vertices that are rewritten every frame, such as dynamic meshes,
+/// can be streamed through several buffer objects with `setBufferCount`,
+/// so that writing them doesn't have to wait for the GPU to finish
+/// drawing the previous frame.
+///
 /// It inherits `sf::Drawable`, but unlike other drawables it
 /// is not transformable.
 ///
@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+
+#include <SFML/System/Export.hpp>
+
+#include <SFML/System/InputStream.hpp>
+
+#include <filesystem>
+#ifdef SFML_SYSTEM_ANDROID
+#include <vector>
+#endif
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Implementation of input stream based on a file mapped in memory
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API MappedFileInputStream : public InputStream
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Construct a mapped file input stream that is not
+    /// associated with a file to read.
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Unmaps the file.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~MappedFileInputStream() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream(const MappedFileInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream& operator=(const MappedFileInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream(MappedFileInputStream&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream& operator=(MappedFileInputStream&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the stream from a file path
+    ///
+    /// \param filename Name of the file to map
+    ///
+    /// \throws sf::Exception on error
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit MappedFileInputStream(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open the stream from a file path
+    ///
+    /// The whole file is mapped in memory; its pages are only
+    /// read from the disk when they are accessed. A previously
+    /// mapped file is unmapped.
+    ///
+    /// \param filename Name of the file to map
+    ///
+    /// \return `true` on success, `false` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool open(const std::filesystem::path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from the stream
+    ///
+    /// After reading, the stream's reading position must be
+    /// advanced by the amount of bytes read.
+    ///
+    /// \param data Buffer where to copy the read data
+    /// \param size Desired number of bytes to read
+    ///
+    /// \return The number of bytes actually read, or `std::nullopt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> read(void* data, std::size_t size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current reading position
+    ///
+    /// \param position The position to seek to, from the beginning
+    ///
+    /// \return The position actually sought to, or `std::nullopt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> seek(std::size_t position) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the stream
+    ///
+    /// \return The current position, or `std::nullopt` on error.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> tell() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the stream
+    ///
+    /// \return The total number of bytes available in the stream, or `std::nullopt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    std::optional<std::size_t> getSize() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the contents of the file
+    ///
+    /// The contents can be passed to functions loading resources
+    /// from memory, which then read them without any copy. They
+    /// remain valid until the stream is destroyed or opened again.
+    ///
+    /// \return Pointer to the first byte of the file, or a null
+    ///         pointer if no file is open or if it's empty
+    ///
+    /// \see `getDataSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const std::byte* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the contents of the file
+    ///
+    /// \return Size of the file in bytes, 0 if no file is open
+    ///
+    /// \see `getData`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getDataSize() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Unmap the file, if any
+    ///
+    ////////////////////////////////////////////////////////////
+    void close();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+#ifdef SFML_SYSTEM_ANDROID
+    std::vector<std::byte> m_asset; //!< Contents of the asset, which are read in memory instead of being mapped
+#endif
+
+    const std::byte* m_data{};   //!< First byte of the mapped file
+    std::size_t      m_size{};   //!< Size of the mapped file
+    std::size_t      m_offset{}; //!< Current reading position
+    bool             m_isOpen{}; //!< Is a file mapped?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::MappedFileInputStream
+/// \ingroup system
+///
+/// This class is a specialization of `InputStream` that
+/// reads from a file on disk mapped in memory.
+///
+/// Unlike `FileInputStream`, it doesn't copy the contents of
+/// the file through the buffers of the standard library: the
+/// operating system reads the pages of the file the first time
+/// they are accessed, which makes it well suited to large
+/// files, such as asset packs, of which only parts are read.
+///
+/// The mapped contents are exposed with `getData` and
+/// `getDataSize`, so that they can be given to the functions
+/// loading resources from memory without copying them. The
+/// stream must then outlive the resources that keep reading
+/// from memory, like `sf::Font`.
+///
+/// On Android, assets can't be mapped and are read in memory
+/// when the stream is opened.
+///
+/// Usage example:
+/// \code
+/// sf::MappedFileInputStream stream("assets.pak");
+///
+/// // Use the stream like any other input stream
+/// process(stream);
+///
+/// // Or load resources from the mapped contents
+/// sf::Font font(stream.getData() + fontOffset, fontSize);
+/// \endcode
+///
+/// \see `InputStream`, `FileInputStream`, `MemoryInputStream`
+///
+////////////////////////////////////////////////////////////
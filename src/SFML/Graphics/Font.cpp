@@ -27,6 +27,9 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/SkylinePacker.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #ifdef SFML_SYSTEM_ANDROID
 #include <SFML/System/Android/ResourceStream.hpp>
@@ -43,7 +46,14 @@
 #include FT_BITMAP_H
 #include FT_STROKER_H
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <optional>
 #include <ostream>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 
 #include <cmath>
@@ -84,6 +94,340 @@ std::uint64_t combine(float outlineThickness, bool bold, std::uint32_t index)
 {
     return (std::uint64_t{reinterpret<std::uint32_t>(outlineThickness)} << 32) | (std::uint64_t{bold} << 31) | index;
 }
+
+// Graphics memory used by a texture of the given size
+std::size_t textureBytes(sf::Vector2u size)
+{
+    return std::size_t{size.x} * std::size_t{size.y} * 4;
+}
+
+// Number of code points whose glyphs and glyph indices are stored in arrays rather than hash tables
+constexpr char32_t denseCodePointCount = 256;
+
+// Leave a small padding around glyphs, so that filtering doesn't
+// pollute them with pixels from neighbors
+constexpr unsigned int glyphPadding = 2;
+
+// Minimum number of glyphs worth opening the font again on a worker thread
+constexpr std::size_t minGlyphsPerThread = 32;
+
+// Glyph rasterized by FreeType, not written to a page texture yet
+struct RasterizedGlyph
+{
+    sf::Glyph                 glyph;  // Metrics of the glyph, its texture rectangle is set once it's placed
+    sf::Vector2u              size;   // Size of the pixels, padding included, zero if the glyph is empty
+    std::vector<std::uint8_t> pixels; // White pixels whose alpha is the coverage of the glyph
+};
+
+// Rasterize a glyph at the current size of a face; only the given FreeType handles are
+// used, so that glyphs can be rasterized in parallel with one set of handles per thread
+bool rasterizeGlyph(FT_Library       library,
+                    FT_Face          face,
+                    FT_Stroker       stroker,
+                    char32_t         codePoint,
+                    bool             bold,
+                    float            outlineThickness,
+                    unsigned int     padding,
+                    RasterizedGlyph& result)
+{
+    sf::Glyph& glyph = result.glyph;
+    glyph            = sf::Glyph();
+    result.size      = sf::Vector2u();
+
+    // Load the glyph corresponding to the code point
+    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
+    if (outlineThickness != 0)
+        flags |= FT_LOAD_NO_BITMAP;
+    if (FT_Load_Char(face, codePoint, flags) != 0)
+        return false;
+
+    // Retrieve the glyph
+    FT_Glyph glyphDesc = nullptr;
+    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+        return false;
+
+    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
+    const FT_Pos weight  = 1 << 6;
+    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
+    if (outline)
+    {
+        if (bold)
+        {
+            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
+            FT_Outline_Embolden(&outlineGlyph->outline, weight);
+        }
+
+        if (outlineThickness != 0)
+        {
+            FT_Stroker_Set(stroker,
+                           static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
+                           FT_STROKER_LINECAP_ROUND,
+                           FT_STROKER_LINEJOIN_ROUND,
+                           0);
+            FT_Glyph_Stroke(&glyphDesc, stroker, true);
+        }
+    }
+
+    // Convert the glyph to a bitmap (i.e. rasterize it)
+    // Warning! After this line, do not read any data from glyphDesc directly, use
+    // bitmapGlyph.root to access the FT_Glyph data.
+    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
+    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+
+    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
+    if (!outline)
+    {
+        if (bold)
+            FT_Bitmap_Embolden(library, &bitmap, weight, weight);
+
+        if (outlineThickness != 0)
+            sf::err() << "Failed to outline glyph (no fallback available)" << std::endl;
+    }
+
+    // Compute the glyph's advance offset
+    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
+    if (bold)
+        glyph.advance += static_cast<float>(weight) / float{1 << 6};
+
+    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
+    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
+
+    sf::Vector2u size(bitmap.width, bitmap.rows);
+
+    if ((size.x > 0) && (size.y > 0))
+    {
+        size += 2u * sf::Vector2u(padding, padding);
+
+        // Compute the glyph's bounding box
+        glyph.bounds.position = sf::Vector2f(sf::Vector2i(bitmapGlyph->left, -bitmapGlyph->top));
+        glyph.bounds.size     = sf::Vector2f(sf::Vector2u(bitmap.width, bitmap.rows));
+
+        // Resize the pixel buffer to the new size and fill it with transparent white pixels
+        result.size = size;
+        result.pixels.resize(std::size_t{size.x} * std::size_t{size.y} * 4);
+
+        std::uint8_t* current = result.pixels.data();
+        std::uint8_t* end     = current + result.pixels.size();
+
+        while (current != end)
+        {
+            (*current++) = 255;
+            (*current++) = 255;
+            (*current++) = 255;
+            (*current++) = 0;
+        }
+
+        // Extract the glyph's pixels from the bitmap
+        const std::uint8_t* pixels = bitmap.buffer;
+        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        {
+            // Pixels are 1 bit monochrome values
+            for (unsigned int y = padding; y < size.y - padding; ++y)
+            {
+                for (unsigned int x = padding; x < size.x - padding; ++x)
+                {
+                    // The color channels remain white, just fill the alpha channel
+                    const std::size_t index = x + y * size.x;
+                    result.pixels[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
+                }
+                pixels += bitmap.pitch;
+            }
+        }
+        else
+        {
+            // Pixels are 8 bit gray levels
+            for (unsigned int y = padding; y < size.y - padding; ++y)
+            {
+                for (unsigned int x = padding; x < size.x - padding; ++x)
+                {
+                    // The color channels remain white, just fill the alpha channel
+                    const std::size_t index      = x + y * size.x;
+                    result.pixels[index * 4 + 3] = pixels[x - padding];
+                }
+                pixels += bitmap.pitch;
+            }
+        }
+    }
+
+    // Delete the FT glyph
+    FT_Done_Glyph(glyphDesc);
+
+    return true;
+}
+
+// Set the texture rectangle of a glyph from the padded rectangle allocated for it
+void setTextureRect(sf::Glyph& glyph, const sf::IntRect& rect, unsigned int padding)
+{
+    // Make sure the texture data is positioned in the center
+    // of the allocated texture rectangle
+    glyph.textureRect = rect;
+    glyph.textureRect.position += sf::Vector2i(sf::Vector2u(padding, padding));
+    glyph.textureRect.size -= 2 * sf::Vector2i(sf::Vector2u(padding, padding));
+}
+
+// One dimensional squared Euclidean distance transform (Felzenszwalb and Huttenlocher): every value
+// becomes the minimum of the values plus their squared distance, the buffers are working memory
+void squaredDistanceTransform(float*                    values,
+                              std::size_t               count,
+                              std::size_t               stride,
+                              std::vector<float>&       samples,
+                              std::vector<std::size_t>& parabolas,
+                              std::vector<float>&       boundaries)
+{
+    constexpr float infinity = std::numeric_limits<float>::infinity();
+
+    samples.resize(count);
+    parabolas.resize(count);
+    boundaries.resize(count + 1);
+
+    for (std::size_t i = 0; i < count; ++i)
+        samples[i] = values[i * stride];
+
+    // Compute the lower envelope of the parabolas rooted at each sample
+    const auto intersection = [&](std::size_t a, std::size_t b)
+    {
+        const auto fa = static_cast<float>(a);
+        const auto fb = static_cast<float>(b);
+        return ((samples[b] + fb * fb) - (samples[a] + fa * fa)) / (2 * fb - 2 * fa);
+    };
+
+    std::size_t k = 0;
+    parabolas[0]  = 0;
+    boundaries[0] = -infinity;
+    boundaries[1] = infinity;
+
+    for (std::size_t q = 1; q < count; ++q)
+    {
+        // Samples at infinity don't contribute to the envelope
+        if (samples[q] == infinity)
+            continue;
+
+        if (samples[parabolas[k]] == infinity)
+        {
+            parabolas[k] = q;
+            continue;
+        }
+
+        float position = intersection(parabolas[k], q);
+        while ((k > 0) && (position <= boundaries[k]))
+        {
+            --k;
+            position = intersection(parabolas[k], q);
+        }
+
+        ++k;
+        parabolas[k]      = q;
+        boundaries[k]     = position;
+        boundaries[k + 1] = infinity;
+    }
+
+    // Evaluate the envelope
+    k = 0;
+    for (std::size_t q = 0; q < count; ++q)
+    {
+        while (boundaries[k + 1] < static_cast<float>(q))
+            ++k;
+
+        const float distance = static_cast<float>(q) - static_cast<float>(parabolas[k]);
+        values[q * stride]   = distance * distance + samples[parabolas[k]];
+    }
+}
+
+// Two dimensional squared Euclidean distance transform, by transforming the columns then the rows
+void squaredDistanceTransform(std::vector<float>& values, sf::Vector2u size)
+{
+    std::vector<float>       samples;
+    std::vector<std::size_t> parabolas;
+    std::vector<float>       boundaries;
+
+    for (std::size_t x = 0; x < size.x; ++x)
+        squaredDistanceTransform(values.data() + x, size.y, size.x, samples, parabolas, boundaries);
+
+    for (std::size_t y = 0; y < size.y; ++y)
+        squaredDistanceTransform(values.data() + y * size.x, size.x, 1, samples, parabolas, boundaries);
+}
+
+// Replace the coverage of a rasterized glyph by its signed distance to the edge of the glyph,
+// mapped from [-spread, spread] to [0, 1]; partially covered pixels are on the edge, their
+// coverage gives the sub-pixel position of the edge
+void makeDistanceField(RasterizedGlyph& glyph, float spread)
+{
+    constexpr float     infinity = std::numeric_limits<float>::infinity();
+    const std::size_t   count    = std::size_t{glyph.size.x} * std::size_t{glyph.size.y};
+    std::uint8_t* const alpha    = glyph.pixels.data() + 3;
+
+    // Squared distances of the outside pixels to the inside, and of the inside pixels to the outside
+    std::vector<float> toInside(count);
+    std::vector<float> toOutside(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const bool inside = alpha[i * 4] >= 128;
+        toInside[i]       = inside ? 0.f : infinity;
+        toOutside[i]      = inside ? infinity : 0.f;
+    }
+
+    squaredDistanceTransform(toInside, glyph.size);
+    squaredDistanceTransform(toOutside, glyph.size);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::uint8_t coverage = alpha[i * 4];
+
+        float distance = 0.f;
+        if ((coverage > 0) && (coverage < 255))
+            distance = static_cast<float>(coverage) / 255.f - 0.5f;
+        else if (coverage >= 128)
+            distance = std::sqrt(toOutside[i]) - 0.5f;
+        else
+            distance = 0.5f - std::sqrt(toInside[i]);
+
+        const float value = std::clamp(0.5f + distance / (2 * spread), 0.f, 1.f);
+        alpha[i * 4]      = static_cast<std::uint8_t>(value * 255.f + 0.5f);
+    }
+}
+
+// Key of the page of a character size in the page table, distance field pages have their own keys
+std::uint64_t pageKey(unsigned int characterSize, bool distanceField)
+{
+    return (std::uint64_t{distanceField} << 32) | characterSize;
+}
+
+// Tell whether a key of the page table is the one of a distance field page
+bool isDistanceFieldPage(std::uint64_t key)
+{
+    return (key >> 32) != 0;
+}
+
+// Fragment shader rendering distance field glyphs, drawing the outline and glow of
+// the text around them; colors are composited with premultiplied alpha
+constexpr std::string_view distanceFieldShader = R"(
+#version 110
+
+uniform sampler2D sdfTexture;
+uniform vec4 outlineColor;
+uniform float outlineThickness;
+uniform vec4 glowColor;
+uniform float glowThickness;
+
+void main()
+{
+    // Antialias over the distance covered by a pixel, which adapts to the scale of the text
+    float distance  = texture2D(sdfTexture, gl_TexCoord[0].xy).a;
+    float smoothing = max(0.7 * fwidth(distance), 0.001);
+
+    float outlineEdge = 0.5 - outlineThickness;
+    float fill        = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+    float outline     = smoothstep(outlineEdge - smoothing, outlineEdge + smoothing, distance);
+    float glow        = smoothstep(outlineEdge - glowThickness - smoothing, outlineEdge, distance);
+
+    vec4 color = vec4(gl_Color.rgb * gl_Color.a, gl_Color.a) * fill;
+    color += vec4(outlineColor.rgb * outlineColor.a, outlineColor.a) * outline * (1.0 - color.a);
+    color += vec4(glowColor.rgb * glowColor.a, glowColor.a) * glow * (1.0 - color.a);
+
+    gl_FragColor = vec4(color.rgb / max(color.a, 0.001), color.a);
+}
+)";
 } // namespace
 
 
@@ -114,10 +458,22 @@ struct Font::FontHandles
     FontHandles& operator=(FontHandles&&) = delete;
     // clang-format on
 
-    FT_Library   library{};   //< Pointer to the internal library interface
-    FT_StreamRec streamRec{}; //< Stream rec object describing an input stream
-    FT_Face      face{};      //< Pointer to the internal font face
-    FT_Stroker   stroker{};   //< Pointer to the stroker
+    FT_Library            library{};   //< Pointer to the internal library interface
+    FT_StreamRec          streamRec{}; //< Stream rec object describing an input stream
+    FT_Face               face{};      //< Pointer to the internal font face
+    FT_Stroker            stroker{};   //< Pointer to the stroker
+    std::filesystem::path filename;    //< Font file, to open the face again on other threads
+    const void*           data{};      //< Font data in memory, to open the face again on other threads
+    std::size_t           dataSize{};  //< Size of the font data in memory
+};
+
+
+////////////////////////////////////////////////////////////
+struct Font::DistanceFieldShader
+{
+    Shader                            shader;   //!< Shader rendering the distance field glyphs
+    bool                              loaded{}; //!< Was the shader successfully compiled?
+    std::optional<DistanceFieldStyle> style;    //!< Style currently set in the uniforms of the shader
 };
 
 
@@ -171,7 +527,8 @@ bool Font::openFromFile(const std::filesystem::path& filename)
         err() << "Failed to load font (failed to create the font face)\n" << formatDebugPathInfo(filename) << std::endl;
         return false;
     }
-    fontHandles->face = face;
+    fontHandles->face     = face;
+    fontHandles->filename = filename;
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -233,7 +590,9 @@ bool Font::openFromMemory(const void* data, std::size_t sizeInBytes)
         err() << "Failed to load font from memory (failed to create the font face)" << std::endl;
         return false;
     }
-    fontHandles->face = face;
+    fontHandles->face     = face;
+    fontHandles->data     = data;
+    fontHandles->dataSize = sizeInBytes;
 
     // Load the stroker that will be used to outline the font
     if (FT_Stroker_New(fontHandles->library, &fontHandles->stroker) != 0)
@@ -339,70 +698,308 @@ const Font::Info& Font::getInfo() const
 
 ////////////////////////////////////////////////////////////
 const Glyph& Font::getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+{
+    return getGlyph(codePoint, characterSize, bold, outlineThickness, false);
+}
+
+
+////////////////////////////////////////////////////////////
+const Glyph& Font::getGlyph(char32_t     codePoint,
+                            unsigned int characterSize,
+                            bool         bold,
+                            float        outlineThickness,
+                            bool         distanceField) const
 {
     // Get the page corresponding to the character size
-    GlyphTable& glyphs = loadPage(characterSize).glyphs;
+    Page& page = loadPage(characterSize, distanceField);
+
+    // The most common glyphs are found without hashing
+    const Glyph** denseGlyph = nullptr;
+    if ((codePoint < denseCodePointCount) && (outlineThickness == 0))
+    {
+        denseGlyph = &page.denseGlyphs.glyphs[codePoint + (bold ? denseCodePointCount : 0)];
+        if (*denseGlyph)
+            return **denseGlyph;
+    }
 
     // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
-    const std::uint64_t key = combine(outlineThickness,
-                                      bold,
-                                      FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint));
+    const std::uint64_t key = combine(outlineThickness, bold, getGlyphIndex(codePoint));
 
-    // Search the glyph into the cache
-    if (const auto it = glyphs.find(key); it != glyphs.end())
+    // Search the glyph into the cache, or load it if not found
+    auto it = page.glyphs.find(key);
+    if (it == page.glyphs.end())
     {
-        // Found: just return it
-        return it->second;
+        const Glyph glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness, distanceField);
+        it                = page.glyphs.try_emplace(key, glyph).first;
+    }
+
+    // Loading the glyph may have emptied the page, the dense table is only set afterwards
+    if (denseGlyph)
+        *denseGlyph = &it->second;
+
+    return it->second;
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::preloadGlyphs(const std::u32string& characters,
+                         unsigned int          characterSize,
+                         bool                  bold,
+                         float                 outlineThickness) const
+{
+    // Stop if no font is loaded
+    if (!m_fontHandles || !m_fontHandles->face || !setCurrentSize(characterSize))
+        return;
+
+    FT_Face face = m_fontHandles->face;
+    Page&   page = loadPage(characterSize);
+
+    // Collect the glyphs that are not loaded yet, several code points may share the same glyph
+    std::vector<char32_t>             codePoints;
+    std::vector<std::uint64_t>        keys;
+    std::unordered_set<std::uint64_t> pendingKeys;
+    for (const char32_t codePoint : characters)
+    {
+        const std::uint64_t key = combine(outlineThickness, bold, getGlyphIndex(codePoint));
+        if ((page.glyphs.find(key) == page.glyphs.end()) && pendingKeys.insert(key).second)
+        {
+            codePoints.push_back(codePoint);
+            keys.push_back(key);
+        }
+    }
+
+    if (codePoints.empty())
+        return;
+
+    // Split the glyphs into slices: the first one is rasterized on the calling thread with the
+    // handles of the font, the others on worker threads that open the font again on their own.
+    // Stream fonts can't be opened again, and bitmap fonts are cheap to rasterize anyway
+    std::size_t sliceCount = 1;
+    if (FT_IS_SCALABLE(face) && (m_fontHandles->data || !m_fontHandles->filename.empty()))
+        sliceCount = std::clamp(std::size_t{std::thread::hardware_concurrency()},
+                                std::size_t{1},
+                                (codePoints.size() + minGlyphsPerThread - 1) / minGlyphsPerThread);
+
+    const std::size_t            sliceSize = (codePoints.size() + sliceCount - 1) / sliceCount;
+    std::vector<RasterizedGlyph> rasterized(codePoints.size());
+
+    const auto rasterizeSlice = [&](FT_Library library, FT_Face sliceFace, FT_Stroker stroker, std::size_t slice)
+    {
+        const std::size_t end = std::min((slice + 1) * sliceSize, codePoints.size());
+        for (std::size_t i = slice * sliceSize; i < end; ++i)
+            (void)rasterizeGlyph(library,
+                                 sliceFace,
+                                 stroker,
+                                 codePoints[i],
+                                 bold,
+                                 outlineThickness,
+                                 glyphPadding,
+                                 rasterized[i]);
+    };
+
+    std::vector<std::uint8_t> sliceDone(sliceCount, false);
+    std::vector<std::thread>  workers;
+    workers.reserve(sliceCount - 1);
+
+    for (std::size_t slice = 1; slice < sliceCount; ++slice)
+    {
+        workers.emplace_back(
+            [&, slice]
+            {
+                FontHandles handles;
+                if (FT_Init_FreeType(&handles.library) != 0)
+                    return;
+
+                const FT_Error error = m_fontHandles->data
+                                           ? FT_New_Memory_Face(handles.library,
+                                                                static_cast<const FT_Byte*>(m_fontHandles->data),
+                                                                static_cast<FT_Long>(m_fontHandles->dataSize),
+                                                                0,
+                                                                &handles.face)
+                                           : FT_New_Face(handles.library,
+                                                         m_fontHandles->filename.string().c_str(),
+                                                         0,
+                                                         &handles.face);
+
+                if ((error != 0) || (FT_Stroker_New(handles.library, &handles.stroker) != 0) ||
+                    (FT_Select_Charmap(handles.face, FT_ENCODING_UNICODE) != 0) ||
+                    (FT_Set_Pixel_Sizes(handles.face, 0, characterSize) != 0))
+                    return;
+
+                rasterizeSlice(handles.library, handles.face, handles.stroker, slice);
+                sliceDone[slice] = true;
+            });
+    }
+
+    rasterizeSlice(m_fontHandles->library, face, m_fontHandles->stroker, 0);
+    sliceDone[0] = true;
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    // Slices whose worker failed to open the font are rasterized here instead
+    for (std::size_t slice = 1; slice < sliceCount; ++slice)
+    {
+        if (!sliceDone[slice])
+            rasterizeSlice(m_fontHandles->library, face, m_fontHandles->stroker, slice);
+    }
+
+    // Place the tallest glyphs first, they pack better and glyphs of the same
+    // height tend to end up side by side, so that they are uploaded together
+    std::vector<std::size_t> order(codePoints.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&](std::size_t a, std::size_t b) { return rasterized[a].size.y > rasterized[b].size.y; });
+
+    // Glyphs placed contiguously on the same row, waiting to be written to the texture at once
+    std::vector<std::size_t> run;
+    Vector2u                 runPosition;
+    Vector2u                 runSize;
+
+    const auto writeRun = [&]
+    {
+        if (run.size() == 1)
+        {
+            page.texture.update(rasterized[run.front()].pixels.data(), runSize, runPosition);
+        }
+        else if (run.size() > 1)
+        {
+            m_pixelBuffer.resize(std::size_t{runSize.x} * std::size_t{runSize.y} * 4);
+
+            std::size_t offset = 0;
+            for (const std::size_t i : run)
+            {
+                const RasterizedGlyph& glyph = rasterized[i];
+                const std::size_t      pitch = std::size_t{glyph.size.x} * 4;
+                for (std::size_t y = 0; y < glyph.size.y; ++y)
+                    std::memcpy(m_pixelBuffer.data() + y * runSize.x * 4 + offset,
+                                glyph.pixels.data() + y * pitch,
+                                pitch);
+                offset += pitch;
+            }
+
+            page.texture.update(m_pixelBuffer.data(), runSize, runPosition);
+        }
+
+        run.clear();
+    };
+
+    for (const std::size_t i : order)
+    {
+        RasterizedGlyph& glyph = rasterized[i];
+
+        if ((glyph.size.x > 0) && (glyph.size.y > 0))
+        {
+            const std::size_t glyphCount = page.glyphs.size();
+            const IntRect     rect       = findGlyphRect(page, glyph.size);
+            setTextureRect(glyph.glyph, rect, glyphPadding);
+
+            // The memory budget may have emptied the page, the pending glyphs went away with it
+            if (page.glyphs.size() < glyphCount)
+                run.clear();
+
+            if (rect.size == Vector2i(glyph.size))
+            {
+                const auto position = Vector2u(rect.position);
+                if (!run.empty() && (position.y == runPosition.y) && (glyph.size.y == runSize.y) &&
+                    (position.x == runPosition.x + runSize.x))
+                {
+                    runSize.x += glyph.size.x;
+                }
+                else
+                {
+                    writeRun();
+                    runPosition = position;
+                    runSize     = glyph.size;
+                }
+
+                run.push_back(i);
+            }
+        }
+
+        page.glyphs.try_emplace(keys[i], glyph.glyph);
     }
 
-    // Not found: we have to load it
-    const Glyph glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
-    return glyphs.try_emplace(key, glyph).first->second;
+    writeRun();
+}
+
+
+////////////////////////////////////////////////////////////
+void Font::preloadGlyphs(char32_t first, char32_t last, unsigned int characterSize, bool bold, float outlineThickness)
+    const
+{
+    if (first > last)
+        return;
+
+    std::u32string characters(std::size_t{last - first} + 1, U'\0');
+    std::iota(characters.begin(), characters.end(), first);
+
+    preloadGlyphs(characters, characterSize, bold, outlineThickness);
 }
 
 
 ////////////////////////////////////////////////////////////
 bool Font::hasGlyph(char32_t codePoint) const
 {
-    return FT_Get_Char_Index(m_fontHandles ? m_fontHandles->face : nullptr, codePoint) != 0;
+    return getGlyphIndex(codePoint) != 0;
 }
 
 
 ////////////////////////////////////////////////////////////
 float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize, bool bold) const
+{
+    return getKerning(first, second, characterSize, bold, false);
+}
+
+
+////////////////////////////////////////////////////////////
+float Font::getKerning(std::uint32_t first,
+                       std::uint32_t second,
+                       unsigned int  characterSize,
+                       bool          bold,
+                       bool          distanceField) const
 {
     // Special case where first or second is 0 (null character)
     if (first == 0 || second == 0)
         return 0.f;
 
     FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+    if (!face)
+        return 0.f;
 
-    if (face && setCurrentSize(characterSize))
-    {
-        // Convert the characters to indices
-        const FT_UInt index1 = FT_Get_Char_Index(face, first);
-        const FT_UInt index2 = FT_Get_Char_Index(face, second);
-
-        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
-        const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold).rsbDelta);
-        const auto secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold).lsbDelta);
-
-        // Get the kerning vector if present
-        FT_Vector kerning{0, 0};
-        if (FT_HAS_KERNING(face))
-            FT_Get_Kerning(face, index1, index2, FT_KERNING_UNFITTED, &kerning);
+    // Convert the characters to indices
+    const std::uint32_t index1 = getGlyphIndex(first);
+    const std::uint32_t index2 = getGlyphIndex(second);
 
-        // X advance is already in pixels for bitmap fonts
-        if (!FT_IS_SCALABLE(face))
-            return static_cast<float>(kerning.x);
+    // Search the pair into the cache of the page, so that the size of the face is only set on a miss
+    Page&               page = loadPage(characterSize, distanceField);
+    const std::uint64_t key  = (std::uint64_t{index1} << 32) | (std::uint64_t{bold} << 31) | index2;
+    if (const auto it = page.kerning.find(key); it != page.kerning.end())
+        return it->second;
 
-        // Combine kerning with compensation deltas and return the X advance
-        // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
-        return std::floor((secondLsbDelta - firstRsbDelta + static_cast<float>(kerning.x) + 32) / float{1 << 6});
-    }
+    if (!setCurrentSize(characterSize))
+        return 0.f;
 
-    // Invalid font
-    return 0.f;
+    // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
+    const auto firstRsbDelta  = static_cast<float>(getGlyph(first, characterSize, bold, 0, distanceField).rsbDelta);
+    const auto secondLsbDelta = static_cast<float>(getGlyph(second, characterSize, bold, 0, distanceField).lsbDelta);
+
+    // Get the kerning vector if present
+    FT_Vector kerning{0, 0};
+    if (FT_HAS_KERNING(face))
+        FT_Get_Kerning(face, index1, index2, FT_KERNING_UNFITTED, &kerning);
+
+    // X advance is already in pixels for bitmap fonts
+    // Otherwise, combine kerning with compensation deltas and return the X advance
+    // Flooring is required as we use FT_KERNING_UNFITTED flag which is not quantized in 64 based grid
+    const float result = FT_IS_SCALABLE(face)
+                             ? std::floor((secondLsbDelta - firstRsbDelta + static_cast<float>(kerning.x) + 32) /
+                                          float{1 << 6})
+                             : static_cast<float>(kerning.x);
+
+    page.kerning.try_emplace(key, result);
+    return result;
 }
 
 
@@ -471,7 +1068,9 @@ void Font::setSmooth(bool smooth)
 
         for (auto& [key, page] : m_pages)
         {
-            page.texture.setSmooth(m_isSmooth);
+            // Distance fields must always be interpolated
+            if (!isDistanceFieldPage(key))
+                page.texture.setSmooth(m_isSmooth);
         }
     }
 }
@@ -484,259 +1083,324 @@ bool Font::isSmooth() const
 
 
 ////////////////////////////////////////////////////////////
-void Font::cleanup()
+void Font::setDistanceFieldEnabled(bool enabled)
 {
-    // Drop ownership of shared FreeType pointers
-    m_fontHandles.reset();
+    m_isDistanceFieldEnabled = enabled;
+}
 
-    // Reset members
-    m_pages.clear();
-    std::vector<std::uint8_t>().swap(m_pixelBuffer);
+
+////////////////////////////////////////////////////////////
+bool Font::isDistanceFieldEnabled() const
+{
+    return m_isDistanceFieldEnabled;
 }
 
 
 ////////////////////////////////////////////////////////////
-Font::Page& Font::loadPage(unsigned int characterSize) const
+const Glyph& Font::getDistanceFieldGlyph(char32_t codePoint, bool bold) const
 {
-    return m_pages.try_emplace(characterSize, m_isSmooth).first->second;
+    return getGlyph(codePoint, DistanceFieldCharacterSize, bold, 0, true);
 }
 
 
 ////////////////////////////////////////////////////////////
-Glyph Font::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
+float Font::getDistanceFieldKerning(std::uint32_t first, std::uint32_t second, bool bold) const
 {
-    // The glyph to return
-    Glyph glyph;
+    return getKerning(first, second, DistanceFieldCharacterSize, bold, true);
+}
 
-    // Stop if no font is loaded
-    if (!m_fontHandles)
-        return glyph;
 
-    // Get our FT_Face
-    FT_Face face = m_fontHandles->face;
-    if (!face)
-        return glyph;
+////////////////////////////////////////////////////////////
+const Texture& Font::getDistanceFieldTexture() const
+{
+    return loadPage(DistanceFieldCharacterSize, true).texture;
+}
 
-    // Set the character size
-    if (!setCurrentSize(characterSize))
-        return glyph;
 
-    // Load the glyph corresponding to the code point
-    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
-    if (outlineThickness != 0)
-        flags |= FT_LOAD_NO_BITMAP;
-    if (FT_Load_Char(face, codePoint, flags) != 0)
-        return glyph;
+////////////////////////////////////////////////////////////
+void Font::setMemoryBudget(std::size_t bytes)
+{
+    m_memoryBudget = bytes;
 
-    // Retrieve the glyph
-    FT_Glyph glyphDesc = nullptr;
-    if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
-        return glyph;
+    makeRoom(nullptr, 0);
+}
 
-    // Apply bold and outline (there is no fallback for outline) if necessary -- first technique using outline (highest quality)
-    const FT_Pos weight  = 1 << 6;
-    const bool   outline = (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE);
-    if (outline)
-    {
-        if (bold)
-        {
-            auto* outlineGlyph = reinterpret_cast<FT_OutlineGlyph>(glyphDesc);
-            FT_Outline_Embolden(&outlineGlyph->outline, weight);
-        }
 
-        if (outlineThickness != 0)
-        {
-            FT_Stroker stroker = m_fontHandles->stroker;
+////////////////////////////////////////////////////////////
+std::size_t Font::getMemoryBudget() const
+{
+    return m_memoryBudget;
+}
 
-            FT_Stroker_Set(stroker,
-                           static_cast<FT_Fixed>(outlineThickness * float{1 << 6}),
-                           FT_STROKER_LINECAP_ROUND,
-                           FT_STROKER_LINEJOIN_ROUND,
-                           0);
-            FT_Glyph_Stroke(&glyphDesc, stroker, true);
-        }
-    }
 
-    // Convert the glyph to a bitmap (i.e. rasterize it)
-    // Warning! After this line, do not read any data from glyphDesc directly, use
-    // bitmapGlyph.root to access the FT_Glyph data.
-    FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1);
-    auto*      bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
-    FT_Bitmap& bitmap      = bitmapGlyph->bitmap;
+////////////////////////////////////////////////////////////
+Font::AtlasStatistics Font::getAtlasStatistics() const
+{
+    AtlasStatistics statistics;
+    statistics.pageCount = m_pages.size();
+    statistics.evictions = m_evictions;
 
-    // Apply bold if necessary -- fallback technique using bitmap (lower quality)
-    if (!outline)
+    for (const auto& [key, page] : m_pages)
     {
-        if (bold)
-            FT_Bitmap_Embolden(m_fontHandles->library, &bitmap, weight, weight);
+        const Vector2u size = page.texture.getSize();
 
-        if (outlineThickness != 0)
-            err() << "Failed to outline glyph (no fallback available)" << std::endl;
+        statistics.glyphCount += page.glyphs.size();
+        statistics.textureBytes += textureBytes(size);
+        statistics.occupiedPixels += page.occupiedPixels;
+        statistics.totalPixels += std::size_t{size.x} * std::size_t{size.y};
     }
 
-    // Compute the glyph's advance offset
-    glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
-    if (bold)
-        glyph.advance += static_cast<float>(weight) / float{1 << 6};
+    return statistics;
+}
 
-    glyph.lsbDelta = static_cast<int>(face->glyph->lsb_delta);
-    glyph.rsbDelta = static_cast<int>(face->glyph->rsb_delta);
 
-    Vector2u size(bitmap.width, bitmap.rows);
+////////////////////////////////////////////////////////////
+void Font::cleanup()
+{
+    // Drop ownership of shared FreeType pointers
+    m_fontHandles.reset();
 
-    if ((size.x > 0) && (size.y > 0))
+    // Reset members
+    m_pages.clear();
+    std::vector<std::uint8_t>().swap(m_pixelBuffer);
+    m_evictions = 0;
+    m_glyphIndices.clear();
+    m_latin1GlyphIndices.fill(0);
+}
+
+
+////////////////////////////////////////////////////////////
+Shader* Font::getDistanceFieldShader() const
+{
+    // A shader that failed to compile is kept too, so that it isn't compiled again on every call
+    if (!m_distanceFieldShader && Shader::isAvailable())
     {
-        // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        const unsigned int padding = 2;
+        auto distanceField    = std::make_shared<DistanceFieldShader>();
+        distanceField->loaded = distanceField->shader.loadFromMemory(distanceFieldShader, Shader::Type::Fragment);
+        if (distanceField->loaded)
+            distanceField->shader.setUniform("sdfTexture", Shader::CurrentTexture);
+        else
+            err() << "Failed to load the distance field font shader, falling back to rasterized glyphs" << std::endl;
 
-        size += 2u * Vector2u(padding, padding);
+        m_distanceFieldShader = std::move(distanceField);
+    }
 
-        // Get the glyphs page corresponding to the character size
-        Page& page = loadPage(characterSize);
+    return (m_distanceFieldShader && m_distanceFieldShader->loaded) ? &m_distanceFieldShader->shader : nullptr;
+}
 
-        // Find a good position for the new glyph into the texture
-        glyph.textureRect = findGlyphRect(page, size);
 
-        // Make sure the texture data is positioned in the center
-        // of the allocated texture rectangle
-        glyph.textureRect.position += Vector2i(padding, padding);
-        glyph.textureRect.size -= 2 * Vector2i(padding, padding);
+////////////////////////////////////////////////////////////
+Shader* Font::getDistanceFieldShader(RenderTarget& target, const DistanceFieldStyle& style) const
+{
+    Shader* shader = getDistanceFieldShader();
+    if (!shader)
+        return nullptr;
+
+    // Texts sharing a style can still be batched together
+    std::optional<DistanceFieldStyle>& current = m_distanceFieldShader->style;
+    if (current && (current->outlineColor == style.outlineColor) &&
+        (current->outlineThickness == style.outlineThickness) && (current->glowColor == style.glowColor) &&
+        (current->glowThickness == style.glowThickness))
+        return shader;
+
+    // The pending geometry must be drawn with the previous style
+    target.flush();
+
+    shader->setUniform("outlineColor", Glsl::Vec4(style.outlineColor));
+    shader->setUniform("outlineThickness", style.outlineThickness);
+    shader->setUniform("glowColor", Glsl::Vec4(style.glowColor));
+    shader->setUniform("glowThickness", style.glowThickness);
+    current = style;
+
+    return shader;
+}
 
-        // Compute the glyph's bounding box
-        glyph.bounds.position = Vector2f(Vector2i(bitmapGlyph->left, -bitmapGlyph->top));
-        glyph.bounds.size     = Vector2f(Vector2u(bitmap.width, bitmap.rows));
 
-        // Resize the pixel buffer to the new size and fill it with transparent white pixels
-        m_pixelBuffer.resize(std::size_t{size.x} * std::size_t{size.y} * 4);
+////////////////////////////////////////////////////////////
+Font::Page& Font::loadPage(unsigned int characterSize, bool distanceField) const
+{
+    const auto [it, inserted] = m_pages.try_emplace(pageKey(characterSize, distanceField), distanceField || m_isSmooth);
+    Page& page                = it->second;
+    page.lastUse              = ++m_useCounter;
 
-        std::uint8_t* current = m_pixelBuffer.data();
-        std::uint8_t* end     = current + size.x * size.y * 4;
+    if (inserted)
+        makeRoom(&page, 0);
 
-        while (current != end)
-        {
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 0;
-        }
+    return page;
+}
 
-        // Extract the glyph's pixels from the bitmap
-        const std::uint8_t* pixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
-        {
-            // Pixels are 1 bit monochrome values
-            for (unsigned int y = padding; y < size.y - padding; ++y)
-            {
-                for (unsigned int x = padding; x < size.x - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = x + y * size.x;
-                    m_pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? 255 : 0;
-                }
-                pixels += bitmap.pitch;
-            }
-        }
-        else
-        {
-            // Pixels are 8 bit gray levels
-            for (unsigned int y = padding; y < size.y - padding; ++y)
-            {
-                for (unsigned int x = padding; x < size.x - padding; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index      = x + y * size.x;
-                    m_pixelBuffer[index * 4 + 3] = pixels[x - padding];
-                }
-                pixels += bitmap.pitch;
-            }
-        }
+
+////////////////////////////////////////////////////////////
+Glyph Font::loadGlyph(char32_t     codePoint,
+                      unsigned int characterSize,
+                      bool         bold,
+                      float        outlineThickness,
+                      bool         distanceField) const
+{
+    // Stop if no font is loaded
+    if (!m_fontHandles || !m_fontHandles->face)
+        return {};
+
+    // Set the character size
+    if (!setCurrentSize(characterSize))
+        return {};
+
+    // Rasterize the glyph into the reusable pixel buffer, distance fields need room for the distance outside the glyph
+    const unsigned int padding = distanceField ? DistanceFieldSpread : glyphPadding;
+    RasterizedGlyph    rasterized;
+    rasterized.pixels.swap(m_pixelBuffer);
+
+    if (rasterizeGlyph(m_fontHandles->library,
+                       m_fontHandles->face,
+                       m_fontHandles->stroker,
+                       codePoint,
+                       bold,
+                       outlineThickness,
+                       padding,
+                       rasterized) &&
+        (rasterized.size.x > 0) && (rasterized.size.y > 0))
+    {
+        if (distanceField)
+            makeDistanceField(rasterized, static_cast<float>(DistanceFieldSpread));
+
+        // Get the glyphs page corresponding to the character size
+        Page& page = loadPage(characterSize, distanceField);
+
+        // Find a good position for the new glyph into the texture
+        const IntRect rect = findGlyphRect(page, rasterized.size);
+        setTextureRect(rasterized.glyph, rect, padding);
 
         // Write the pixels to the texture
-        const auto dest       = Vector2u(glyph.textureRect.position) - Vector2u(padding, padding);
-        const auto updateSize = Vector2u(glyph.textureRect.size) + 2u * Vector2u(padding, padding);
-        page.texture.update(m_pixelBuffer.data(), updateSize, dest);
+        if (rect.size == Vector2i(rasterized.size))
+            page.texture.update(rasterized.pixels.data(), rasterized.size, Vector2u(rect.position));
     }
 
-    // Delete the FT glyph
-    FT_Done_Glyph(glyphDesc);
+    rasterized.pixels.swap(m_pixelBuffer);
 
-    // Done :)
-    return glyph;
+    return rasterized.glyph;
 }
 
 
 ////////////////////////////////////////////////////////////
-IntRect Font::findGlyphRect(Page& page, Vector2u size) const
+std::uint32_t Font::getGlyphIndex(char32_t codePoint) const
 {
-    // Find the line that fits well the glyph
-    Row*  row       = nullptr;
-    float bestRatio = 0;
-    for (auto it = page.rows.begin(); it != page.rows.end() && !row; ++it)
+    FT_Face face = m_fontHandles ? m_fontHandles->face : nullptr;
+    if (!face)
+        return 0;
+
+    if (codePoint < denseCodePointCount)
     {
-        const float ratio = static_cast<float>(size.y) / static_cast<float>(it->height);
+        std::uint32_t& index = m_latin1GlyphIndices[codePoint];
+        if (index == 0)
+            index = FT_Get_Char_Index(face, codePoint) + 1;
 
-        // Ignore rows that are either too small or too high
-        if ((ratio < 0.7f) || (ratio > 1.f))
-            continue;
+        return index - 1;
+    }
 
-        // Check if there's enough horizontal space left in the row
-        if (size.x > page.texture.getSize().x - it->width)
-            continue;
+    const auto [it, inserted] = m_glyphIndices.try_emplace(codePoint);
+    if (inserted)
+        it->second = FT_Get_Char_Index(face, codePoint);
 
-        // Make sure that this new row is the best found so far
-        if (ratio < bestRatio)
-            continue;
+    return it->second;
+}
 
-        // The current row passed all the tests: we can select it
-        row       = &*it;
-        bestRatio = ratio;
-    }
 
-    // If we didn't find a matching row, create a new one (10% taller than the glyph)
-    if (!row)
+////////////////////////////////////////////////////////////
+IntRect Font::findGlyphRect(Page& page, Vector2u size) const
+{
+    // Copies of the font share the packer until one of them adds a glyph
+    if (page.packer.use_count() > 1)
+        page.packer = std::make_shared<priv::SkylinePacker>(*page.packer);
+
+    std::optional<Vector2u> position = page.packer->insert(size);
+
+    while (!position)
     {
-        const unsigned int rowHeight = size.y + size.y / 10;
-        while ((page.nextRow + rowHeight >= page.texture.getSize().y) || (size.x >= page.texture.getSize().x))
+        // Not enough space: make the texture 2 times bigger along its smallest side if possible
+        const Vector2u     textureSize = page.texture.getSize();
+        const unsigned int maximumSize = Texture::getMaximumSize();
+        Vector2u           newSize     = textureSize;
+
+        if ((textureSize.x <= textureSize.y) && (textureSize.x * 2 <= maximumSize))
+            newSize.x *= 2;
+        else if (textureSize.y * 2 <= maximumSize)
+            newSize.y *= 2;
+        else if (textureSize.x * 2 <= maximumSize)
+            newSize.x *= 2;
+
+        if (newSize == textureSize)
         {
-            // Not enough space: resize the texture if possible
-            const Vector2u textureSize = page.texture.getSize();
-            if ((textureSize.x * 2 <= Texture::getMaximumSize()) && (textureSize.y * 2 <= Texture::getMaximumSize()))
+            // Oops, we've reached the maximum texture size...
+            if ((m_memoryBudget == 0) || page.glyphs.empty())
             {
-                // Make the texture 2 times bigger
-                Texture newTexture;
-                if (!newTexture.resize(textureSize * 2u))
-                {
-                    err() << "Failed to create new page texture" << std::endl;
-                    return {{0, 0}, {2, 2}};
-                }
-
-                newTexture.setSmooth(m_isSmooth);
-                newTexture.update(page.texture);
-                page.texture.swap(newTexture);
-            }
-            else
-            {
-                // Oops, we've reached the maximum texture size...
                 err() << "Failed to add a new character to the font: the maximum texture size has been reached"
                       << std::endl;
                 return {{0, 0}, {2, 2}};
             }
         }
+        else if (makeRoom(&page, textureBytes(newSize) - textureBytes(textureSize)) || page.glyphs.empty())
+        {
+            Texture newTexture;
+            if (!newTexture.resize(newSize))
+            {
+                err() << "Failed to create new page texture" << std::endl;
+                return {{0, 0}, {2, 2}};
+            }
+
+            newTexture.setSmooth(page.texture.isSmooth());
+            newTexture.update(page.texture);
+            page.texture.swap(newTexture);
+            page.packer->grow(newSize);
+
+            position = page.packer->insert(size);
+            continue;
+        }
 
-        // We can now create the new row
-        page.rows.emplace_back(page.nextRow, rowHeight);
-        page.nextRow += rowHeight;
-        row = &page.rows.back();
+        // Growing is not possible or would exceed the memory budget: evict all the glyphs of the page
+        // instead, its new texture lets sf::Text know that its geometry must be updated
+        page         = Page(page.texture.isSmooth());
+        page.lastUse = ++m_useCounter;
+        ++m_evictions;
+
+        position = page.packer->insert(size);
     }
 
-    // Find the glyph's rectangle on the selected row
-    IntRect rect(Rect<unsigned int>({row->width, row->top}, size));
+    page.occupiedPixels += std::size_t{size.x} * std::size_t{size.y};
+
+    return {Vector2i(*position), Vector2i(size)};
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::makeRoom(const Page* keep, std::size_t extraBytes) const
+{
+    if (m_memoryBudget == 0)
+        return true;
+
+    std::size_t totalBytes = extraBytes;
+    for (const auto& [key, page] : m_pages)
+        totalBytes += textureBytes(page.texture.getSize());
+
+    while (totalBytes > m_memoryBudget)
+    {
+        // Find the least recently used page
+        auto leastRecentlyUsed = m_pages.end();
+        for (auto it = m_pages.begin(); it != m_pages.end(); ++it)
+        {
+            if ((&it->second != keep) &&
+                ((leastRecentlyUsed == m_pages.end()) || (it->second.lastUse < leastRecentlyUsed->second.lastUse)))
+                leastRecentlyUsed = it;
+        }
+
+        if (leastRecentlyUsed == m_pages.end())
+            return false;
 
-    // Update the row information
-    row->width += size.x;
+        totalBytes -= textureBytes(leastRecentlyUsed->second.texture.getSize());
+        m_pages.erase(leastRecentlyUsed);
+        ++m_evictions;
+    }
 
-    return rect;
+    return true;
 }
 
 
@@ -781,6 +1445,20 @@ bool Font::setCurrentSize(unsigned int characterSize) const
 }
 
 
+////////////////////////////////////////////////////////////
+Font::DenseGlyphTable::DenseGlyphTable(const DenseGlyphTable&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Font::DenseGlyphTable& Font::DenseGlyphTable::operator=(const DenseGlyphTable&)
+{
+    glyphs.fill(nullptr);
+    return *this;
+}
+
+
 ////////////////////////////////////////////////////////////
 Font::Page::Page(bool smooth)
 {
@@ -799,6 +1477,10 @@ Font::Page::Page(bool smooth)
     }
 
     texture.setSmooth(smooth);
+
+    // Reserve the rows of the white square, glyphs are packed below them
+    packer = std::make_shared<priv::SkylinePacker>(image.getSize());
+    [[maybe_unused]] const std::optional<Vector2u> whiteSquare = packer->insert({image.getSize().x, 3});
 }
 
 } // namespace sf
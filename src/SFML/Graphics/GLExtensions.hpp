@@ -65,20 +65,24 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 // Core since 1.1
 // 1.1 does not support GL_STREAM_DRAW so we just define it to GL_DYNAMIC_DRAW
-#define GLEXT_vertex_buffer_object ::sf::priv::SF_GL_OES_vertex_buffer_object
-#define GLEXT_glBindBuffer         glBindBuffer
-#define GLEXT_glBufferData         glBufferData
-#define GLEXT_glBufferSubData      glBufferSubData
-#define GLEXT_glDeleteBuffers      glDeleteBuffers
-#define GLEXT_glGenBuffers         glGenBuffers
-#define GLEXT_GL_ARRAY_BUFFER      GL_ARRAY_BUFFER
-#define GLEXT_GL_DYNAMIC_DRAW      GL_DYNAMIC_DRAW
-#define GLEXT_GL_STATIC_DRAW       GL_STATIC_DRAW
-#define GLEXT_GL_STREAM_DRAW       GL_DYNAMIC_DRAW
+#define GLEXT_vertex_buffer_object    ::sf::priv::SF_GL_OES_vertex_buffer_object
+#define GLEXT_glBindBuffer            glBindBuffer
+#define GLEXT_glBufferData            glBufferData
+#define GLEXT_glBufferSubData         glBufferSubData
+#define GLEXT_glDeleteBuffers         glDeleteBuffers
+#define GLEXT_glGenBuffers            glGenBuffers
+#define GLEXT_GL_ARRAY_BUFFER         GL_ARRAY_BUFFER
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER GL_ELEMENT_ARRAY_BUFFER
+#define GLEXT_GL_DYNAMIC_DRAW         GL_DYNAMIC_DRAW
+#define GLEXT_GL_STATIC_DRAW          GL_STATIC_DRAW
+#define GLEXT_GL_STREAM_DRAW          GL_DYNAMIC_DRAW
 
 #define GLEXT_vertex_buffer_object_dependencies \
     ::sf::priv::SF_GL_OES_vertex_buffer_object, glBindBuffer, glBufferData, glBufferSubData, glDeleteBuffers, glGenBuffers
 
+// OES_element_index_uint is not loaded, only 16-bit indices are supported
+#define GLEXT_element_index_uint false
+
 // The following extensions are listed chronologically
 // Extension macro first, followed by tokens then
 // functions according to the corresponding specification
@@ -168,6 +172,62 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_glCopyBufferSubData \
     glCopyBufferSubData // Placeholder to satisfy the compiler, entry point is not loaded in GLES
 
+// Core since 3.0 - EXT_map_buffer_range
+#define GLEXT_map_buffer_range            false
+#define GLEXT_GL_MAP_READ_BIT             0
+#define GLEXT_GL_MAP_WRITE_BIT            0
+#define GLEXT_GL_MAP_INVALIDATE_RANGE_BIT 0
+#define GLEXT_GL_MAP_UNSYNCHRONIZED_BIT   0
+#define GLEXT_glMapBufferRange \
+    glMapBufferRange // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glUnmapBuffer \
+    glUnmapBuffer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - APPLE_sync
+// The wait results keep distinct values, so that testing for either one isn't a comparison of equal expressions
+#define GLEXT_sync                          false
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE 0
+#define GLEXT_GL_ALREADY_SIGNALED           GL_ALREADY_SIGNALED
+#define GLEXT_GL_CONDITION_SATISFIED        GL_CONDITION_SATISFIED
+#define GLEXT_glFenceSync \
+    glFenceSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glClientWaitSync \
+    glClientWaitSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteSync \
+    glDeleteSync // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - NV_pixel_buffer_object
+#define GLEXT_pixel_buffer_object    false
+#define GLEXT_GL_PIXEL_PACK_BUFFER   0
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER 0
+#define GLEXT_GL_STREAM_READ         0
+
+// Core since 3.3 - ARB_instanced_arrays
+#define GLEXT_instanced_arrays false
+#define GLEXT_glGetAttribLocation \
+    glGetAttribLocation // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glVertexAttribPointer \
+    glVertexAttribPointer // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glEnableVertexAttribArray \
+    glEnableVertexAttribArray // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDisableVertexAttribArray \
+    glDisableVertexAttribArray // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glVertexAttribDivisor \
+    glVertexAttribDivisor // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDrawArraysInstanced \
+    glDrawArraysInstanced // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0
+#define GLEXT_uniform_buffer_object false
+#define GLEXT_GL_UNIFORM_BUFFER     0
+#define GLEXT_GL_INVALID_INDEX      0
+#define GLEXT_glGetUniformBlockIndex \
+    glGetUniformBlockIndex // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glUniformBlockBinding \
+    glUniformBlockBinding // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glBindBufferBase \
+    glBindBufferBase // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
 // Core since 3.0 - EXT_sRGB
 #define GLEXT_texture_sRGB    false
 #define GLEXT_GL_SRGB8_ALPHA8 0
@@ -180,6 +240,38 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 #define GLEXT_EXT_blend_minmax_dependencies SF_GLAD_GL_EXT_blend_minmax, glBlendEquationEXT
 
+// Core since 3.0 - OES_get_program_binary
+#define GLEXT_get_program_binary                 false
+#define GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0
+#define GLEXT_GL_PROGRAM_BINARY_LENGTH           0
+#define GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS      0
+#define GLEXT_glGetProgramBinary \
+    glGetProgramBinary // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glProgramBinary \
+    glProgramBinary // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glProgramParameteri \
+    glProgramParameteri // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetProgramiv \
+    glGetProgramiv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
+// Core since 3.0 - EXT_disjoint_timer_query
+#define GLEXT_timer_query               false
+#define GLEXT_GL_TIME_ELAPSED           0
+#define GLEXT_GL_QUERY_RESULT           0
+#define GLEXT_GL_QUERY_RESULT_AVAILABLE 0
+#define GLEXT_glGenQueries \
+    glGenQueries // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glDeleteQueries \
+    glDeleteQueries // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glBeginQuery \
+    glBeginQuery // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glEndQuery \
+    glEndQuery // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetQueryObjectiv \
+    glGetQueryObjectiv // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+#define GLEXT_glGetQueryObjectui64v \
+    glGetQueryObjectui64v // Placeholder to satisfy the compiler, entry point is not loaded in GLES
+
 #else
 
 // SFML requires at a bare minimum OpenGL 1.1 capability
@@ -189,6 +281,7 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 // Core since 1.1
 #define GLEXT_GL_DEPTH_COMPONENT GL_DEPTH_COMPONENT
 #define GLEXT_GL_CLAMP           GL_CLAMP
+#define GLEXT_element_index_uint true
 
 // The following extensions are listed chronologically
 // Extension macro first, followed by tokens then
@@ -231,6 +324,7 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 // Core since 1.5 - ARB_vertex_buffer_object
 #define GLEXT_vertex_buffer_object             SF_GLAD_GL_ARB_vertex_buffer_object
 #define GLEXT_GL_ARRAY_BUFFER                  GL_ARRAY_BUFFER_ARB
+#define GLEXT_GL_ELEMENT_ARRAY_BUFFER          GL_ELEMENT_ARRAY_BUFFER_ARB
 #define GLEXT_GL_DYNAMIC_DRAW                  GL_DYNAMIC_DRAW_ARB
 #define GLEXT_GL_READ_ONLY                     GL_READ_ONLY_ARB
 #define GLEXT_GL_STATIC_DRAW                   GL_STATIC_DRAW_ARB
@@ -296,6 +390,14 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 #define GLEXT_vertex_shader                       SF_GLAD_GL_ARB_vertex_shader
 #define GLEXT_GL_VERTEX_SHADER                    GL_VERTEX_SHADER_ARB
 #define GLEXT_GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS_ARB
+#define GLEXT_glGetAttribLocation                 glGetAttribLocationARB
+#define GLEXT_glVertexAttribPointer               glVertexAttribPointerARB
+#define GLEXT_glEnableVertexAttribArray           glEnableVertexAttribArrayARB
+#define GLEXT_glDisableVertexAttribArray          glDisableVertexAttribArrayARB
+
+#define GLEXT_vertex_shader_dependencies                                                                          \
+    SF_GLAD_GL_ARB_vertex_shader, glGetAttribLocationARB, glVertexAttribPointerARB, glEnableVertexAttribArrayARB, \
+        glDisableVertexAttribArrayARB
 
 // Core since 2.0 - ARB_fragment_shader
 #define GLEXT_fragment_shader                     SF_GLAD_GL_ARB_fragment_shader
@@ -372,10 +474,84 @@ inline int SF_GL_OES_vertex_buffer_object = 1;
 
 #define GLEXT_copy_buffer_dependencies SF_GLAD_GL_ARB_copy_buffer, glCopyBufferSubData
 
+// Core since 3.0 - ARB_map_buffer_range
+#define GLEXT_map_buffer_range            SF_GLAD_GL_ARB_map_buffer_range
+#define GLEXT_GL_MAP_READ_BIT             GL_MAP_READ_BIT
+#define GLEXT_GL_MAP_WRITE_BIT            GL_MAP_WRITE_BIT
+#define GLEXT_GL_MAP_INVALIDATE_RANGE_BIT GL_MAP_INVALIDATE_RANGE_BIT
+#define GLEXT_GL_MAP_UNSYNCHRONIZED_BIT   GL_MAP_UNSYNCHRONIZED_BIT
+#define GLEXT_glMapBufferRange            glMapBufferRange
+
+#define GLEXT_map_buffer_range_dependencies SF_GLAD_GL_ARB_map_buffer_range, glMapBufferRange, glUnmapBufferARB
+
+// Core since 3.2 - ARB_sync
+#define GLEXT_sync                          SF_GLAD_GL_ARB_sync
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GLEXT_GL_ALREADY_SIGNALED           GL_ALREADY_SIGNALED
+#define GLEXT_GL_CONDITION_SATISFIED        GL_CONDITION_SATISFIED
+#define GLEXT_glFenceSync                   glFenceSync
+#define GLEXT_glClientWaitSync              glClientWaitSync
+#define GLEXT_glDeleteSync                  glDeleteSync
+
+#define GLEXT_sync_dependencies SF_GLAD_GL_ARB_sync, glFenceSync, glClientWaitSync, glDeleteSync
+
+// Core since 2.1 - ARB_pixel_buffer_object
+#define GLEXT_pixel_buffer_object    SF_GLAD_GL_VERSION_2_1
+#define GLEXT_GL_PIXEL_PACK_BUFFER   GL_PIXEL_PACK_BUFFER
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER GL_PIXEL_UNPACK_BUFFER
+#define GLEXT_GL_STREAM_READ         GL_STREAM_READ
+
+// Core since 3.3 - ARB_instanced_arrays, glDrawArraysInstanced is core since 3.1
+#define GLEXT_instanced_arrays      SF_GLAD_GL_VERSION_3_3
+#define GLEXT_glVertexAttribDivisor glVertexAttribDivisor
+#define GLEXT_glDrawArraysInstanced glDrawArraysInstanced
+
+#define GLEXT_instanced_arrays_dependencies SF_GLAD_GL_VERSION_3_3, glVertexAttribDivisor, glDrawArraysInstanced
+
+// Core since 3.1 - ARB_uniform_buffer_object
+#define GLEXT_uniform_buffer_object  SF_GLAD_GL_ARB_uniform_buffer_object
+#define GLEXT_GL_UNIFORM_BUFFER      GL_UNIFORM_BUFFER
+#define GLEXT_GL_INVALID_INDEX       GL_INVALID_INDEX
+#define GLEXT_glGetUniformBlockIndex glGetUniformBlockIndex
+#define GLEXT_glUniformBlockBinding  glUniformBlockBinding
+#define GLEXT_glBindBufferBase       glBindBufferBase
+
+#define GLEXT_uniform_buffer_object_dependencies \
+    SF_GLAD_GL_ARB_uniform_buffer_object, glGetUniformBlockIndex, glUniformBlockBinding, glBindBufferBase
+
 // Core since 3.2 - ARB_geometry_shader4
 #define GLEXT_geometry_shader4         SF_GLAD_GL_ARB_geometry_shader4
 #define GLEXT_GL_GEOMETRY_SHADER       GL_GEOMETRY_SHADER_ARB
 
+// Core since 3.3 - ARB_timer_query
+#define GLEXT_timer_query               SF_GLAD_GL_ARB_timer_query
+#define GLEXT_GL_TIME_ELAPSED           GL_TIME_ELAPSED
+#define GLEXT_GL_QUERY_RESULT           GL_QUERY_RESULT
+#define GLEXT_GL_QUERY_RESULT_AVAILABLE GL_QUERY_RESULT_AVAILABLE
+#define GLEXT_glGenQueries              glGenQueries
+#define GLEXT_glDeleteQueries           glDeleteQueries
+#define GLEXT_glBeginQuery              glBeginQuery
+#define GLEXT_glEndQuery                glEndQuery
+#define GLEXT_glGetQueryObjectiv        glGetQueryObjectiv
+#define GLEXT_glGetQueryObjectui64v     glGetQueryObjectui64v
+
+#define GLEXT_timer_query_dependencies                                                                       \
+    SF_GLAD_GL_ARB_timer_query, glGenQueries, glDeleteQueries, glBeginQuery, glEndQuery, glGetQueryObjectiv, \
+        glGetQueryObjectui64v
+
+// Core since 4.1 - ARB_get_program_binary
+#define GLEXT_get_program_binary                 SF_GLAD_GL_ARB_get_program_binary
+#define GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GLEXT_GL_PROGRAM_BINARY_LENGTH           GL_PROGRAM_BINARY_LENGTH
+#define GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS      GL_NUM_PROGRAM_BINARY_FORMATS
+#define GLEXT_glGetProgramBinary                 glGetProgramBinary
+#define GLEXT_glProgramBinary                    glProgramBinary
+#define GLEXT_glProgramParameteri                glProgramParameteri
+#define GLEXT_glGetProgramiv                     glGetProgramiv
+
+#define GLEXT_get_program_binary_dependencies \
+    SF_GLAD_GL_ARB_get_program_binary, glGetProgramBinary, glProgramBinary, glProgramParameteri, glGetProgramiv
+
 #endif
 
 // OpenGL Versions
@@ -42,13 +42,16 @@
 #include <stb_image_write.h>
 
 #include <algorithm>
+#include <array>
 #include <iomanip>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <utility>
 
 #include <cassert>
+#include <cstdint>
 #include <cstring>
 
 
@@ -92,6 +95,149 @@ struct StbDeleter
     }
 };
 using StbPtr = std::unique_ptr<stbi_uc, StbDeleter>;
+
+// Divide by 255, rounding down; exact below 65535, which covers the sums of products of two components
+constexpr std::uint32_t divideBy255(std::uint32_t value)
+{
+    return (value + 1 + (value >> 8)) >> 8;
+}
+
+// Divide by 255, rounding to the nearest value; exact up to 255 * 255
+constexpr std::uint32_t roundDivideBy255(std::uint32_t value)
+{
+    value += 128;
+    return (value + (value >> 8)) >> 8;
+}
+
+// 16.16 fixed point reciprocals of the alpha values, scaled by 255 and rounded up so that unpremultiplying is exact
+constexpr auto alphaReciprocals = []
+{
+    std::array<std::uint32_t, 256> reciprocals{};
+    for (std::uint32_t alpha = 1; alpha < 256; ++alpha)
+        reciprocals[alpha] = ((255u << 16) + alpha - 1) / alpha;
+    return reciprocals;
+}();
+
+// Pixels are loaded and stored as 32-bit words, whatever the byte order, so that compilers can vectorize the loops
+std::uint32_t loadPixel(const std::uint8_t* pixel)
+{
+    std::uint32_t value = 0;
+    std::memcpy(&value, pixel, sizeof(value));
+    return value;
+}
+
+void storePixel(std::uint8_t* pixel, std::uint32_t value)
+{
+    std::memcpy(pixel, &value, sizeof(value));
+}
+
+std::uint32_t packPixel(sf::Color color)
+{
+    const std::array<std::uint8_t, 4> components = {color.r, color.g, color.b, color.a};
+    return loadPixel(components.data());
+}
+
+// Check that a sub-rectangle of an image is within its bounds, an empty rectangle meaning the whole image
+std::optional<sf::Rect<unsigned int>> findSourceRect(const sf::Image& source, const sf::IntRect& sourceRect)
+{
+    // Make sure the sourceRect components are non-negative before casting them to unsigned values
+    if (sourceRect.position.x < 0 || sourceRect.position.y < 0 || sourceRect.size.x < 0 || sourceRect.size.y < 0)
+        return std::nullopt;
+
+    const sf::Rect<unsigned int> srcRect(sourceRect);
+
+    // Use the whole source image as srcRect if the provided source rectangle is empty
+    if (srcRect.size.x == 0 || srcRect.size.y == 0)
+        return sf::Rect<unsigned int>({0, 0}, source.getSize());
+
+    // Otherwise make sure the provided source rectangle fits into the source image
+    // Checking the bottom right corner is enough because
+    // left and top are non-negative and width and height are positive.
+    const sf::Vector2u size = source.getSize();
+    if (size.x < srcRect.position.x + srcRect.size.x || size.y < srcRect.position.y + srcRect.size.y)
+        return std::nullopt;
+
+    return srcRect;
+}
+
+// Check whether all the pixels of a row are opaque
+bool isOpaque(const std::uint8_t* pixels, std::size_t count)
+{
+    std::uint8_t minAlpha = 255;
+    for (std::size_t i = 0; i < count; ++i)
+        minAlpha = std::min(minAlpha, pixels[i * 4 + 3]);
+    return minAlpha == 255;
+}
+
+// Blend a row of pixels over a row of opaque pixels, which stay opaque
+void blendOverOpaque(const std::uint8_t* src, std::uint8_t* dst, std::size_t count)
+{
+    for (std::size_t i = 0; i < count * 4; i += 4)
+    {
+        const std::uint32_t srcAlpha = src[i + 3];
+        for (std::size_t k = 0; k < 3; ++k)
+            dst[i + k] = static_cast<std::uint8_t>(divideBy255(src[i + k] * srcAlpha + dst[i + k] * (255 - srcAlpha)));
+    }
+}
+
+// Blend a row of pixels over another one using the over operator
+void blendOver(const std::uint8_t* src, std::uint8_t* dst, std::size_t count)
+{
+    for (std::size_t i = 0; i < count * 4; i += 4)
+    {
+        const std::uint32_t srcAlpha = src[i + 3];
+        const std::uint32_t dstAlpha = dst[i + 3];
+
+        // Opaque source pixels replace the destination ones, transparent ones leave the visible ones unchanged
+        if (srcAlpha == 255)
+        {
+            std::memcpy(dst + i, src + i, 4);
+            continue;
+        }
+        if ((srcAlpha == 0) && (dstAlpha != 0))
+            continue;
+
+        // Interpolate RGBA components using the alpha values of the destination and source pixels
+        const std::uint32_t outAlpha = srcAlpha + dstAlpha - divideBy255(srcAlpha * dstAlpha);
+
+        dst[i + 3] = static_cast<std::uint8_t>(outAlpha);
+
+        if (outAlpha)
+            for (std::size_t k = 0; k < 3; ++k)
+                dst[i + k] = static_cast<std::uint8_t>(
+                    (src[i + k] * srcAlpha + dst[i + k] * (outAlpha - srcAlpha)) / outAlpha);
+        else
+            for (std::size_t k = 0; k < 3; ++k)
+                dst[i + k] = src[i + k];
+    }
+}
+
+// Source pixels sampled for a destination pixel of a scaled copy
+struct Sample
+{
+    std::size_t   first{};  //!< Index of the first source pixel
+    std::size_t   second{}; //!< Index of the second source pixel, interpolated with the first one
+    std::uint32_t weight{}; //!< Weight of the second source pixel, out of 256
+};
+
+// Find the source pixels sampled for a destination pixel, matching the centers of the pixels
+Sample findSample(std::size_t destIndex, std::size_t destSize, std::size_t sourceSize, sf::Image::Filter filter)
+{
+    // Center of the destination pixel in the source, in 16.16 fixed point
+    const std::uint64_t center = (((2 * std::uint64_t{destIndex} + 1) * sourceSize) << 16) / (2 * destSize);
+
+    if (filter == sf::Image::Filter::Nearest)
+    {
+        const std::size_t index = std::min(static_cast<std::size_t>(center >> 16), sourceSize - 1);
+        return {index, index, 0};
+    }
+
+    // Interpolate between the two source pixels whose centers surround the destination pixel center
+    const std::uint64_t halfPixel = std::uint64_t{1} << 15;
+    const std::uint64_t position  = std::min(center - std::min(center, halfPixel), std::uint64_t{sourceSize - 1} << 16);
+    const auto          first     = static_cast<std::size_t>(position >> 16);
+    return {first, std::min(first + 1, sourceSize - 1), static_cast<std::uint32_t>(position >> 8) & 255};
+}
 } // namespace
 
 
@@ -412,18 +558,18 @@ Vector2u Image::getSize() const
 ////////////////////////////////////////////////////////////
 void Image::createMaskFromColor(Color color, std::uint8_t alpha)
 {
-    // Make sure that the image is not empty
-    if (!m_pixels.empty())
+    // Replace the alpha of the pixels that match the transparent color, comparing whole pixels at once
+    const std::uint32_t key       = packPixel(color);
+    const std::uint32_t alphaMask = packPixel(Color(0, 0, 0, 255));
+    const std::uint32_t alphaBits = packPixel(Color(0, 0, 0, alpha));
+
+    // The size is read once, the compiler can't tell that writing the pixels doesn't change it
+    std::uint8_t* const pixels    = m_pixels.data();
+    const std::size_t   byteCount = m_pixels.size();
+    for (std::size_t i = 0; i < byteCount; i += 4)
     {
-        // Replace the alpha of the pixels that match the transparent color
-        std::uint8_t* ptr = m_pixels.data();
-        std::uint8_t* end = ptr + m_pixels.size();
-        while (ptr != end)
-        {
-            if ((ptr[0] == color.r) && (ptr[1] == color.g) && (ptr[2] == color.b) && (ptr[3] == color.a))
-                ptr[3] = alpha;
-            ptr += 4;
-        }
+        const std::uint32_t pixel = loadPixel(pixels + i);
+        storePixel(pixels + i, (pixel == key) ? ((pixel & ~alphaMask) | alphaBits) : pixel);
     }
 }
 
@@ -435,67 +581,36 @@ bool Image::copy(const Image& source, Vector2u dest, const IntRect& sourceRect,
     if (source.m_size.x == 0 || source.m_size.y == 0 || m_size.x == 0 || m_size.y == 0)
         return false;
 
-    // Make sure the sourceRect components are non-negative before casting them to unsigned values
-    if (sourceRect.position.x < 0 || sourceRect.position.y < 0 || sourceRect.size.x < 0 || sourceRect.size.y < 0)
+    // Make sure the source rectangle is within the source image bounds
+    const std::optional<Rect<unsigned int>> srcRect = findSourceRect(source, sourceRect);
+    if (!srcRect)
         return false;
 
-    Rect<unsigned int> srcRect(sourceRect);
-
-    // Use the whole source image as srcRect if the provided source rectangle is empty
-    if (srcRect.size.x == 0 || srcRect.size.y == 0)
-    {
-        srcRect = Rect<unsigned int>({0, 0}, source.m_size);
-    }
-    // Otherwise make sure the provided source rectangle fits into the source image
-    else
-    {
-        // Checking the bottom right corner is enough because
-        // left and top are non-negative and width and height are positive.
-        if (source.m_size.x < srcRect.position.x + srcRect.size.x || source.m_size.y < srcRect.position.y + srcRect.size.y)
-            return false;
-    }
-
     // Make sure the destination position is within this image bounds
     if (m_size.x <= dest.x || m_size.y <= dest.y)
         return false;
 
     // Then find the valid size of the destination rectangle
-    const Vector2u dstSize(std::min(m_size.x - dest.x, srcRect.size.x), std::min(m_size.y - dest.y, srcRect.size.y));
+    const Vector2u dstSize(std::min(m_size.x - dest.x, srcRect->size.x), std::min(m_size.y - dest.y, srcRect->size.y));
 
     // Precompute as much as possible
     const std::size_t  pitch     = static_cast<std::size_t>(dstSize.x) * 4;
     const unsigned int srcStride = source.m_size.x * 4;
     const unsigned int dstStride = m_size.x * 4;
 
-    const std::uint8_t* srcPixels = source.m_pixels.data() + (srcRect.position.x + srcRect.position.y * source.m_size.x) * 4;
+    const std::uint8_t* srcPixels = source.m_pixels.data() + (srcRect->position.x + srcRect->position.y * source.m_size.x) * 4;
     std::uint8_t* dstPixels = m_pixels.data() + (dest.x + dest.y * m_size.x) * 4;
 
     // Copy the pixels
     if (applyAlpha)
     {
-        // Interpolation using alpha values, pixel by pixel (slower)
+        // Blend row by row, rows over opaque pixels take a faster path without divisions
         for (unsigned int i = 0; i < dstSize.y; ++i)
         {
-            for (unsigned int j = 0; j < dstSize.x; ++j)
-            {
-                // Get a direct pointer to the components of the current pixel
-                const std::uint8_t* src = srcPixels + j * 4;
-                std::uint8_t*       dst = dstPixels + j * 4;
-
-                // Interpolate RGBA components using the alpha values of the destination and source pixels
-                const std::uint8_t srcAlpha = src[3];
-                const std::uint8_t dstAlpha = dst[3];
-                const auto outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
-
-                dst[3] = outAlpha;
-
-                if (outAlpha)
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = static_cast<std::uint8_t>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
-                else
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = src[k];
-            }
+            if (isOpaque(dstPixels, dstSize.x))
+                blendOverOpaque(srcPixels, dstPixels, dstSize.x);
+            else
+                blendOver(srcPixels, dstPixels, dstSize.x);
 
             srcPixels += srcStride;
             dstPixels += dstStride;
@@ -559,23 +674,17 @@ const std::uint8_t* Image::getPixelsPtr() const
 ////////////////////////////////////////////////////////////
 void Image::flipHorizontally()
 {
-    if (!m_pixels.empty())
-    {
-        const std::size_t rowSize = m_size.x * 4;
+    const std::size_t rowSize = std::size_t{m_size.x} * 4;
 
-        for (std::size_t y = 0; y < m_size.y; ++y)
+    for (std::size_t y = 0; y < m_size.y; ++y)
+    {
+        // Swap whole pixels from both ends of the row
+        std::uint8_t* const row = m_pixels.data() + y * rowSize;
+        for (std::size_t left = 0, right = rowSize - 4; left < right; left += 4, right -= 4)
         {
-            auto left = m_pixels.begin() + static_cast<std::vector<std::uint8_t>::iterator::difference_type>(y * rowSize);
-            auto right = m_pixels.begin() +
-                         static_cast<std::vector<std::uint8_t>::iterator::difference_type>((y + 1) * rowSize - 4);
-
-            for (std::size_t x = 0; x < m_size.x / 2; ++x)
-            {
-                std::swap_ranges(left, left + 4, right);
-
-                left += 4;
-                right -= 4;
-            }
+            const std::uint32_t pixel = loadPixel(row + left);
+            storePixel(row + left, loadPixel(row + right));
+            storePixel(row + right, pixel);
         }
     }
 }
@@ -601,4 +710,142 @@ void Image::flipVertically()
     }
 }
 
+
+////////////////////////////////////////////////////////////
+bool Image::copyScaled(const Image& source, const IntRect& destRect, const IntRect& sourceRect, Filter filter)
+{
+    // Make sure that both images are valid
+    if (source.m_size.x == 0 || source.m_size.y == 0 || m_size.x == 0 || m_size.y == 0)
+        return false;
+
+    // Make sure the source rectangle is within the source image bounds
+    const std::optional<Rect<unsigned int>> srcRect = findSourceRect(source, sourceRect);
+    if (!srcRect)
+        return false;
+
+    // Make sure the destination rectangle is valid, and find the part of it within this image bounds
+    if (destRect.size.x <= 0 || destRect.size.y <= 0)
+        return false;
+
+    const std::optional<IntRect> clipped = destRect.findIntersection(IntRect({0, 0}, Vector2i(m_size)));
+    if (!clipped)
+        return false;
+
+    // Precompute the source pixels sampled for each column of the destination
+    const auto          fullSize  = Vector2u(destRect.size);
+    const auto          dstOffset = Vector2u(clipped->position - destRect.position);
+    const auto          dstSize   = Vector2u(clipped->size);
+    const auto          dstStart  = Vector2u(clipped->position);
+    std::vector<Sample> columns(dstSize.x);
+    for (std::size_t x = 0; x < dstSize.x; ++x)
+        columns[x] = findSample(dstOffset.x + x, fullSize.x, srcRect->size.x, filter);
+
+    const std::size_t srcStride = std::size_t{source.m_size.x} * 4;
+    const std::size_t dstStride = std::size_t{m_size.x} * 4;
+
+    const std::uint8_t* srcPixels = source.m_pixels.data() + srcRect->position.y * srcStride + srcRect->position.x * 4;
+    std::uint8_t*       dstPixels = m_pixels.data() + dstStart.y * dstStride + dstStart.x * 4;
+
+    for (std::size_t y = 0; y < dstSize.y; ++y)
+    {
+        const Sample              row    = findSample(dstOffset.y + y, fullSize.y, srcRect->size.y, filter);
+        const std::uint8_t* const top    = srcPixels + row.first * srcStride;
+        const std::uint8_t* const bottom = srcPixels + row.second * srcStride;
+        std::uint8_t* const       dst    = dstPixels + y * dstStride;
+
+        if (filter == Filter::Nearest)
+        {
+            for (std::size_t x = 0; x < dstSize.x; ++x)
+                std::memcpy(dst + x * 4, top + columns[x].first * 4, 4);
+            continue;
+        }
+
+        // Interpolate horizontally in both source rows, then vertically between them, in 8-bit fixed point
+        for (std::size_t x = 0; x < dstSize.x; ++x)
+        {
+            const std::size_t   first  = columns[x].first * 4;
+            const std::size_t   second = columns[x].second * 4;
+            const std::uint32_t weight = columns[x].weight;
+            for (std::size_t k = 0; k < 4; ++k)
+            {
+                const std::uint32_t upper = top[first + k] * (256 - weight) + top[second + k] * weight;
+                const std::uint32_t lower = bottom[first + k] * (256 - weight) + bottom[second + k] * weight;
+                const std::uint32_t value = upper * (256 - row.weight) + lower * row.weight;
+                dst[x * 4 + k]            = static_cast<std::uint8_t>((value + 32768) >> 16);
+            }
+        }
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Image::fillRect(const IntRect& rect, Color color)
+{
+    // Only fill the part of the rectangle within the image bounds
+    const std::optional<IntRect> clipped = rect.findIntersection(IntRect({0, 0}, Vector2i(m_size)));
+    if (!clipped)
+        return;
+
+    const auto          position = Vector2u(clipped->position);
+    const auto          size     = Vector2u(clipped->size);
+    const std::size_t   stride   = std::size_t{m_size.x} * 4;
+    const std::uint32_t pixel    = packPixel(color);
+
+    // Fill the first row pixel by pixel, then copy it to the other rows
+    std::uint8_t* const first = m_pixels.data() + (std::size_t{position.x} + std::size_t{position.y} * m_size.x) * 4;
+    for (std::size_t x = 0; x < size.x; ++x)
+        storePixel(first + x * 4, pixel);
+
+    for (std::size_t y = 1; y < size.y; ++y)
+        std::memcpy(first + y * stride, first, std::size_t{size.x} * 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void Image::premultiplyAlpha()
+{
+    std::uint8_t* const pixels    = m_pixels.data();
+    const std::size_t   byteCount = m_pixels.size();
+    for (std::size_t i = 0; i < byteCount; i += 4)
+    {
+        const std::uint32_t alpha = pixels[i + 3];
+        for (std::size_t k = 0; k < 3; ++k)
+            pixels[i + k] = static_cast<std::uint8_t>(roundDivideBy255(pixels[i + k] * alpha));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Image::unpremultiplyAlpha()
+{
+    // Multiply by the reciprocal of the alpha instead of dividing, the reciprocal of 0 being 0
+    std::uint8_t* const pixels    = m_pixels.data();
+    const std::size_t   byteCount = m_pixels.size();
+    for (std::size_t i = 0; i < byteCount; i += 4)
+    {
+        const std::uint32_t reciprocal = alphaReciprocals[pixels[i + 3]];
+        for (std::size_t k = 0; k < 3; ++k)
+            pixels[i + k] = static_cast<std::uint8_t>(std::min((pixels[i + k] * reciprocal + 32768) >> 16, 255u));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Image::transformColors(Color multiplier, Color offset)
+{
+    const std::array<std::uint32_t, 4> multipliers = {multiplier.r, multiplier.g, multiplier.b, multiplier.a};
+    const std::array<std::uint32_t, 4> offsets     = {offset.r, offset.g, offset.b, offset.a};
+
+    std::uint8_t* const pixels    = m_pixels.data();
+    const std::size_t   byteCount = m_pixels.size();
+    for (std::size_t i = 0; i < byteCount; i += 4)
+    {
+        for (std::size_t k = 0; k < 4; ++k)
+            pixels[i + k] = static_cast<std::uint8_t>(
+                std::min(divideBy255(pixels[i + k] * multipliers[k]) + offsets[k], 255u));
+    }
+}
+
 } // namespace sf
@@ -0,0 +1,283 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ImageLoader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Exception.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct ImageLoader::Impl
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Image waiting for its upload to a texture
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Upload
+    {
+        std::string           name;       //!< Name of the image in the statistics
+        std::future<Image>    image;      //!< Image being decoded
+        std::shared_ptr<Time> decodeTime; //!< Time spent decoding the image, set before the image is ready
+        Texture*              texture{};  //!< Texture to load the image into
+        bool                  sRgb{};     //!< Enable sRGB conversion in the texture?
+        std::promise<void>    done;       //!< Promise fulfilled once the texture is loaded
+    };
+
+    explicit Impl(unsigned int threadCount)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+        workers.reserve(threadCount);
+        for (unsigned int i = 0; i < threadCount; ++i)
+            workers.emplace_back([this] { run(); });
+    }
+
+    ~Impl()
+    {
+        {
+            const std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    Impl(const Impl&)            = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    // Run decoding tasks until the loader is destroyed
+    void run()
+    {
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex);
+                condition.wait(lock, [this] { return stopping || !tasks.empty(); });
+
+                // Pending tasks are dropped, which breaks their promises
+                if (stopping)
+                    return;
+
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    // Decode an image on a worker thread; when decodeTime is null, the decoding is
+    // recorded in the statistics, otherwise its time is reported to the upload
+    std::future<Image> decode(std::string name, std::function<Image()> decoder, std::shared_ptr<Time> decodeTime = {})
+    {
+        auto               promise = std::make_shared<std::promise<Image>>();
+        std::future<Image> future  = promise->get_future();
+
+        {
+            const std::lock_guard lock(mutex);
+            tasks.emplace_back(
+                [this, promise, name = std::move(name), decoder = std::move(decoder), decodeTime]
+                {
+                    const Clock clock;
+                    try
+                    {
+                        Image image = decoder();
+                        report(name, clock.getElapsedTime(), false, decodeTime.get());
+                        promise->set_value(std::move(image));
+                    }
+                    catch (...)
+                    {
+                        report(name, clock.getElapsedTime(), true, decodeTime.get());
+                        promise->set_exception(std::current_exception());
+                    }
+                });
+        }
+        condition.notify_one();
+
+        return future;
+    }
+
+    // Report the time spent decoding an image
+    void report(const std::string& name, Time time, bool failed, Time* decodeTime)
+    {
+        if (decodeTime)
+            *decodeTime = time;
+        else
+            addStatistics({name, time, Time::Zero, failed});
+    }
+
+    void addStatistics(Statistics entry)
+    {
+        const std::lock_guard lock(statisticsMutex);
+        statistics.push_back(std::move(entry));
+    }
+
+    std::vector<std::thread>          workers;         //!< Threads decoding the images
+    std::deque<std::function<void()>> tasks;           //!< Decoding tasks waiting for a worker
+    std::mutex                        mutex;           //!< Mutex protecting the tasks
+    std::condition_variable           condition;       //!< Signals new tasks and the destruction to the workers
+    bool                              stopping{};      //!< Is the loader being destroyed?
+    std::deque<Upload>                uploads;         //!< Images waiting for their upload, in request order
+    mutable std::mutex                statisticsMutex; //!< Mutex protecting the statistics
+    std::vector<Statistics>           statistics;      //!< Timings of the loaded images
+};
+
+
+////////////////////////////////////////////////////////////
+ImageLoader::ImageLoader(unsigned int threadCount) : m_impl(std::make_unique<Impl>(threadCount))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ImageLoader::~ImageLoader() = default;
+
+
+////////////////////////////////////////////////////////////
+ImageLoader::ImageLoader(ImageLoader&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+ImageLoader& ImageLoader::operator=(ImageLoader&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::future<Image> ImageLoader::loadFromFile(const std::filesystem::path& filename)
+{
+    return m_impl->decode(filename.string(), [filename] { return Image(filename); });
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<Image> ImageLoader::loadFromMemory(std::vector<std::uint8_t> data, std::string name)
+{
+    return m_impl->decode(std::move(name), [data = std::move(data)] { return Image(data.data(), data.size()); });
+}
+
+
+////////////////////////////////////////////////////////////
+std::future<void> ImageLoader::loadToTexture(const std::filesystem::path& filename, Texture& texture, bool sRgb)
+{
+    Impl::Upload upload;
+    upload.name       = filename.string();
+    upload.decodeTime = std::make_shared<Time>();
+    upload.image      = m_impl->decode(upload.name, [filename] { return Image(filename); }, upload.decodeTime);
+    upload.texture    = &texture;
+    upload.sRgb       = sRgb;
+
+    std::future<void> future = upload.done.get_future();
+    m_impl->uploads.push_back(std::move(upload));
+    return future;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ImageLoader::processUploads(Time budget)
+{
+    const Clock clock;
+    std::size_t count = 0;
+
+    for (auto it = m_impl->uploads.begin(); it != m_impl->uploads.end();)
+    {
+        // Always upload one image, so that the queue makes progress even when uploads take longer than the budget
+        if ((count > 0) && (clock.getElapsedTime() >= budget))
+            break;
+
+        // Skip the images that are still being decoded
+        if (it->image.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            ++it;
+            continue;
+        }
+
+        Statistics  entry{it->name, *it->decodeTime, Time::Zero, false};
+        const Clock uploadClock;
+        try
+        {
+            const Image image = it->image.get();
+            if (!it->texture->loadFromImage(image, it->sRgb))
+                throw Exception("Failed to upload image to texture");
+
+            entry.uploadTime = uploadClock.getElapsedTime();
+            it->done.set_value();
+        }
+        catch (...)
+        {
+            entry.failed = true;
+            it->done.set_exception(std::current_exception());
+        }
+
+        m_impl->addStatistics(std::move(entry));
+        it = m_impl->uploads.erase(it);
+        ++count;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ImageLoader::getPendingUploadCount() const
+{
+    return m_impl->uploads.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<ImageLoader::Statistics> ImageLoader::getStatistics() const
+{
+    const std::lock_guard lock(m_impl->statisticsMutex);
+    return m_impl->statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageLoader::clearStatistics()
+{
+    const std::lock_guard lock(m_impl->statisticsMutex);
+    m_impl->statistics.clear();
+}
+
+} // namespace sf
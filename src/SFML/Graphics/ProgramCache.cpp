@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ProgramCache.hpp>
+
+#include <SFML/System/Err.hpp>
+#include <SFML/System/Utils.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <system_error>
+
+
+namespace
+{
+// Directory of the cache, shared by all threads
+struct CacheState
+{
+    std::mutex            mutex;     //!< Mutex protecting the directory
+    std::filesystem::path directory; //!< Directory of the cache, empty if disabled
+};
+
+CacheState& getCacheState()
+{
+    static CacheState state;
+    return state;
+}
+
+// Header of a cache entry; entries never leave the machine that wrote them, so the native byte order is used
+struct EntryHeader
+{
+    std::uint32_t magic{};    //!< Signature of the file
+    std::uint32_t version{};  //!< Version of the file layout
+    std::uint64_t key{};      //!< Key of the program, to detect renamed files
+    std::uint32_t format{};   //!< Driver-specific format of the binary
+    std::uint32_t padding{};  //!< Unused, keeps the layout free of implicit padding
+    std::uint64_t dataSize{}; //!< Size of the binary following the header, in bytes
+};
+
+constexpr std::uint32_t entryMagic   = 0x42504653; // "SFPB"
+constexpr std::uint32_t entryVersion = 1;
+
+// Path of the cache entry of a program
+std::filesystem::path getEntryPath(const std::filesystem::path& directory, std::uint64_t key)
+{
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+    return directory / name.str();
+}
+
+// Append a string to a 64-bit FNV-1a hash, prefixed by its size so that boundaries count
+std::uint64_t hashString(std::uint64_t hash, std::string_view string)
+{
+    const auto hashByte = [&hash](unsigned char byte) { hash = (hash ^ byte) * 0x100000001b3u; };
+
+    for (std::size_t size = string.size(), i = 0; i < sizeof(size); ++i)
+        hashByte(static_cast<unsigned char>(size >> (i * 8)));
+
+    for (const char character : string)
+        hashByte(static_cast<unsigned char>(character));
+
+    return hash;
+}
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void setProgramCacheDirectory(const std::filesystem::path& directory)
+{
+    CacheState&            state = getCacheState();
+    const std::scoped_lock lock(state.mutex);
+    state.directory = directory;
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path getProgramCacheDirectory()
+{
+    CacheState&            state = getCacheState();
+    const std::scoped_lock lock(state.mutex);
+    return state.directory;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t getProgramCacheKey(std::initializer_list<std::string_view> strings)
+{
+    std::uint64_t hash = 0xcbf29ce484222325u; // FNV-1a offset basis
+    for (const std::string_view string : strings)
+        hash = hashString(hash, string);
+
+    return hash;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<ProgramBinary> loadProgramBinary(std::uint64_t key)
+{
+    const std::filesystem::path directory = getProgramCacheDirectory();
+    if (directory.empty())
+        return std::nullopt;
+
+    const std::filesystem::path path = getEntryPath(directory, key);
+    std::ifstream               file(path, std::ios_base::binary);
+    if (!file)
+        return std::nullopt;
+
+    // Check the header against the size of the file, so that a truncated or foreign file is never trusted
+    std::error_code      error;
+    const std::uintmax_t fileSize = std::filesystem::file_size(path, error);
+    EntryHeader          header;
+    if (error || !file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != entryMagic ||
+        header.version != entryVersion || header.key != key || header.dataSize == 0 ||
+        header.dataSize != fileSize - sizeof(header))
+        return std::nullopt;
+
+    ProgramBinary binary;
+    binary.format = header.format;
+    binary.data.resize(static_cast<std::size_t>(header.dataSize));
+    if (!file.read(reinterpret_cast<char*>(binary.data.data()), static_cast<std::streamsize>(binary.data.size())))
+        return std::nullopt;
+
+    return binary;
+}
+
+
+////////////////////////////////////////////////////////////
+void saveProgramBinary(std::uint64_t key, const ProgramBinary& binary)
+{
+    const std::filesystem::path directory = getProgramCacheDirectory();
+    if (directory.empty() || binary.data.empty())
+        return;
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    // Write to a temporary file first, so that other processes never read a partial entry
+    const std::filesystem::path path          = getEntryPath(directory, key);
+    std::filesystem::path       temporaryPath = path;
+    temporaryPath += ".tmp";
+
+    EntryHeader header;
+    header.magic    = entryMagic;
+    header.version  = entryVersion;
+    header.key      = key;
+    header.format   = binary.format;
+    header.dataSize = binary.data.size();
+
+    bool written = false;
+    if (std::ofstream file(temporaryPath, std::ios_base::binary | std::ios_base::trunc); file)
+    {
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(binary.data.data()), static_cast<std::streamsize>(binary.data.size()));
+        written = static_cast<bool>(file.flush());
+    }
+
+    if (written)
+        std::filesystem::rename(temporaryPath, path, error);
+
+    if (!written || error)
+    {
+        std::filesystem::remove(temporaryPath, error);
+        err() << "Failed to write shader program to cache\n" << formatDebugPathInfo(path) << std::endl;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void removeProgramBinary(std::uint64_t key)
+{
+    const std::filesystem::path directory = getProgramCacheDirectory();
+    if (directory.empty())
+        return;
+
+    std::error_code error;
+    std::filesystem::remove(getEntryPath(directory, key), error);
+}
+
+} // namespace sf::priv
@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <filesystem>
+#include <initializer_list>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Linked shader program, as returned by the driver
+///
+////////////////////////////////////////////////////////////
+struct ProgramBinary
+{
+    std::uint32_t             format{}; //!< Driver-specific format of the binary
+    std::vector<std::uint8_t> data;     //!< Contents of the binary
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Set the directory where program binaries are cached
+///
+/// \param directory Directory of the cache, empty to disable it
+///
+////////////////////////////////////////////////////////////
+void setProgramCacheDirectory(const std::filesystem::path& directory);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the directory where program binaries are cached
+///
+/// \return Directory of the cache, empty if it is disabled
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::filesystem::path getProgramCacheDirectory();
+
+////////////////////////////////////////////////////////////
+/// \brief Compute the key identifying a program in the cache
+///
+/// The strings are typically the driver identification
+/// followed by the source code of each stage; their
+/// boundaries are part of the key.
+///
+/// \param strings Strings identifying the program
+///
+/// \return 64-bit hash of the strings
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint64_t getProgramCacheKey(std::initializer_list<std::string_view> strings);
+
+////////////////////////////////////////////////////////////
+/// \brief Read a program binary from the cache
+///
+/// \param key Key of the program
+///
+/// \return Program binary, or `std::nullopt` if the cache is disabled or doesn't contain a valid entry for the key
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::optional<ProgramBinary> loadProgramBinary(std::uint64_t key);
+
+////////////////////////////////////////////////////////////
+/// \brief Write a program binary to the cache
+///
+/// Does nothing if the cache is disabled. Failures are
+/// reported but otherwise ignored, the cache is only an
+/// optimization.
+///
+/// \param key    Key of the program
+/// \param binary Program binary to store
+///
+////////////////////////////////////////////////////////////
+void saveProgramBinary(std::uint64_t key, const ProgramBinary& binary);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove a program binary from the cache
+///
+/// Used when the driver rejects a cached binary, for
+/// example after it was updated.
+///
+/// \param key Key of the program
+///
+////////////////////////////////////////////////////////////
+void removeProgramBinary(std::uint64_t key);
+
+} // namespace sf::priv
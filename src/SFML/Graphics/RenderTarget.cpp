@@ -29,8 +29,12 @@
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderTimers.hpp>
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
+#include <SFML/Graphics/StreamBuffer.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TransformPoints.hpp>
 #include <SFML/Graphics/VertexBuffer.hpp>
 
 #include <SFML/Window/Context.hpp>
@@ -40,6 +44,7 @@
 
 #include <algorithm>
 #include <mutex>
+#include <optional>
 #include <ostream>
 #include <unordered_map>
 
@@ -191,15 +196,75 @@ std::uint32_t stencilFunctionToGlConstant(sf::StencilComparison comparison)
     assert(false);
     return GL_ALWAYS;
 }
+
+
+// OpenGL primitive modes, indexed by primitive type
+constexpr sf::priv::EnumArray<sf::PrimitiveType, GLenum, 6> primitiveModes =
+    {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+
+
+// Get the list primitive type that a primitive type is converted to when batched.
+sf::PrimitiveType batchPrimitiveType(sf::PrimitiveType type)
+{
+    switch (type)
+    {
+        case sf::PrimitiveType::Points:
+            return sf::PrimitiveType::Points;
+        case sf::PrimitiveType::Lines:
+        case sf::PrimitiveType::LineStrip:
+            return sf::PrimitiveType::Lines;
+        case sf::PrimitiveType::Triangles:
+        case sf::PrimitiveType::TriangleStrip:
+        case sf::PrimitiveType::TriangleFan:
+            return sf::PrimitiveType::Triangles;
+    }
+
+    assert(false);
+    return sf::PrimitiveType::Triangles;
+}
+
+// Check that indices only refer to existing vertices, which is required to expand them on the CPU
+bool areIndicesInRange(const void* indices, std::size_t indexCount, sf::IndexBuffer::Type type, std::size_t vertexCount)
+{
+    const auto isInRange = [vertexCount](std::size_t index) { return index < vertexCount; };
+
+    if (type == sf::IndexBuffer::Type::UInt16)
+    {
+        const auto* begin = static_cast<const std::uint16_t*>(indices);
+        return std::all_of(begin, begin + indexCount, isInRange);
+    }
+
+    const auto* begin = static_cast<const std::uint32_t*>(indices);
+    return std::all_of(begin, begin + indexCount, isInRange);
+}
 } // namespace RenderTargetImpl
 } // namespace
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+RenderTarget::RenderTarget() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::~RenderTarget() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget::RenderTarget(RenderTarget&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTarget& RenderTarget::operator=(RenderTarget&&) noexcept = default;
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color)
 {
+    // Pending geometry must be rendered before the target is cleared
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -218,6 +283,9 @@ void RenderTarget::clear(Color color)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clearStencil(StencilValue stencilValue)
 {
+    // Pending geometry must be rendered before the target is cleared
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -236,6 +304,9 @@ void RenderTarget::clearStencil(StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::clear(Color color, StencilValue stencilValue)
 {
+    // Pending geometry must be rendered before the target is cleared
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         // Unbind texture to fix RenderTexture preventing clear
@@ -255,6 +326,9 @@ void RenderTarget::clear(Color color, StencilValue stencilValue)
 ////////////////////////////////////////////////////////////
 void RenderTarget::setView(const View& view)
 {
+    // Pending geometry must be rendered with the view it was drawn with
+    flush();
+
     m_view              = view;
     m_cache.viewChanged = true;
 }
@@ -348,69 +422,45 @@ void RenderTarget::draw(const Drawable& drawable, const RenderStates& states)
 ////////////////////////////////////////////////////////////
 void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
 {
-    // Nothing to draw?
-    if (!vertices || (vertexCount == 0))
-        return;
-
-    if (RenderTargetImpl::isActive(m_id) || setActive(true))
-    {
-        // Check if the vertex count is low enough so that we can pre-transform them
-        const bool useVertexCache = (vertexCount <= m_cache.vertexCache.size());
-
-        if (useVertexCache)
-        {
-            // Pre-transform the vertices and store them into the vertex cache
-            for (std::size_t i = 0; i < vertexCount; ++i)
-            {
-                Vertex& vertex   = m_cache.vertexCache[i];
-                vertex.position  = states.transform * vertices[i].position;
-                vertex.color     = vertices[i].color;
-                vertex.texCoords = vertices[i].texCoords;
-            }
-        }
-
-        setupDraw(useVertexCache, states);
-
-        // Check if texture coordinates array is needed, and update client state accordingly
-        const bool enableTexCoordsArray = (states.texture || states.shader);
-        if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
-        {
-            if (enableTexCoordsArray)
-                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
-            else
-                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
-        }
+    submitVertices(vertices, vertexCount, type, states, {});
+}
 
-        // If we switch between non-cache and cache mode or enable texture
-        // coordinates we need to set up the pointers to the vertices' components
-        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
-        {
-            const auto* data = reinterpret_cast<const std::byte*>(vertices);
 
-            // If we pre-transform the vertices, we must use our internal vertex cache
-            if (useVertexCache)
-                data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        const std::uint16_t* indices,
+                        std::size_t          indexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
+{
+    // Nothing to draw?
+    if (!indices || (indexCount == 0))
+        return;
 
-            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
-            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
-            if (enableTexCoordsArray)
-                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
-        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
-        {
-            // If we enter this block, we are already using our internal vertex cache
-            const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+    submitVertices(vertices, vertexCount, type, states, {indices, indexCount, IndexBuffer::Type::UInt16});
+}
 
-            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
-        }
 
-        drawPrimitives(type, 0, vertexCount);
-        cleanupDraw(states);
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const Vertex*        vertices,
+                        std::size_t          vertexCount,
+                        const std::uint32_t* indices,
+                        std::size_t          indexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
+{
+    // Nothing to draw?
+    if (!indices || (indexCount == 0))
+        return;
 
-        // Update the cache
-        m_cache.useVertexCache        = useVertexCache;
-        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
+    if (!IndexBuffer::isUInt32Available())
+    {
+        err() << "32-bit indices are not available, drawing skipped" << std::endl;
+        return;
     }
+
+    submitVertices(vertices, vertexCount, type, states, {indices, indexCount, IndexBuffer::Type::UInt32});
 }
 
 
@@ -442,25 +492,80 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
     if (!vertexCount || !vertexBuffer.getNativeHandle())
         return;
 
+    ++m_statistics.drawsSubmitted;
+    ++m_statistics.matrixTransformedDraws;
+    m_statistics.matrixTransformedVertices += vertexCount;
+
+    drawVertexBuffer(vertexBuffer, nullptr, firstVertex, vertexCount, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer, const IndexBuffer& indexBuffer, const RenderStates& states)
+{
+    draw(vertexBuffer, indexBuffer, 0, indexBuffer.getIndexCount(), states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable())
+    {
+        err() << "sf::VertexBuffer is not available, drawing skipped" << std::endl;
+        return;
+    }
+
+    // Sanity check
+    if (firstIndex > indexBuffer.getIndexCount())
+        return;
+
+    // Clamp indexCount to something that makes sense
+    indexCount = std::min(indexCount, indexBuffer.getIndexCount() - firstIndex);
+
+    // Nothing to draw?
+    if (!indexCount || !vertexBuffer.getNativeHandle() || !indexBuffer.getNativeHandle())
+        return;
+
+    ++m_statistics.drawsSubmitted;
+    ++m_statistics.matrixTransformedDraws;
+    m_statistics.matrixTransformedVertices += indexCount;
+
+    drawVertexBuffer(vertexBuffer, &indexBuffer, firstIndex, indexCount, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawInstances(const SpriteBatch& spriteBatch, const RenderStates& states)
+{
+    const std::size_t instanceCount = spriteBatch.getInstanceCount();
+
+    ++m_statistics.drawsSubmitted;
+    ++m_statistics.matrixTransformedDraws;
+    m_statistics.matrixTransformedVertices += instanceCount * 4;
+
+    // Pending geometry must be rendered first to preserve the drawing order
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
         setupDraw(false, states);
 
-        // Bind vertex buffer
-        VertexBuffer::bind(&vertexBuffer);
-
         // Always enable texture coordinates
         if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
             glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
 
-        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
-        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
-        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+        spriteBatch.setupInstanceArrays();
 
-        drawPrimitives(vertexBuffer.getPrimitiveType(), firstVertex, vertexCount);
+        glCheck(GLEXT_glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(instanceCount)));
+        ++m_statistics.drawCallsIssued;
 
-        // Unbind vertex buffer
-        VertexBuffer::bind(nullptr);
+        spriteBatch.cleanupInstanceArrays();
 
         cleanupDraw(states);
 
@@ -471,6 +576,117 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::setBatchingEnabled(bool enabled)
+{
+    if (!enabled)
+        flush();
+
+    m_batch.enabled = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isBatchingEnabled() const
+{
+    return m_batch.enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::setVertexCacheThreshold(std::size_t vertexCount)
+{
+    m_cache.vertexCacheThreshold = vertexCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTarget::getVertexCacheThreshold() const
+{
+    return m_cache.vertexCacheThreshold;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::flush()
+{
+    // Nothing to draw?
+    if (m_batch.vertices.empty())
+        return;
+
+    // Take the pending vertices out of the batch, so that the state
+    // changes triggered while drawing cannot flush them a second time
+    std::vector<Vertex> vertices;
+    vertices.swap(m_batch.vertices);
+
+    drawVertices(vertices.data(), vertices.size(), m_batch.type, m_batch.states, {});
+
+    // Give the storage back to the batch to avoid reallocating it every frame
+    vertices.clear();
+    m_batch.vertices.swap(vertices);
+}
+
+
+////////////////////////////////////////////////////////////
+const RenderTarget::DrawStatistics& RenderTarget::getDrawStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::resetDrawStatistics()
+{
+    m_statistics = {};
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::beginTimer(const std::string& name)
+{
+    // Pending geometry belongs to the previous region
+    flush();
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        if (!m_timers)
+            m_timers = std::make_unique<priv::RenderTimers>();
+
+        m_timers->begin(name);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::endTimer()
+{
+    if (!m_timers)
+        return;
+
+    // Pending geometry belongs to the region
+    flush();
+
+    m_timers->end();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<RenderTarget::TimerResults> RenderTarget::getTimerResults(const std::string& name) const
+{
+    if (!m_timers)
+        return std::nullopt;
+
+    return m_timers->getResults(name);
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isGpuTimerAvailable()
+{
+    return priv::RenderTimers::isAvailable();
+}
+
+
 ////////////////////////////////////////////////////////////
 bool RenderTarget::isSrgb() const
 {
@@ -522,6 +738,9 @@ bool RenderTarget::setActive(bool active)
 ////////////////////////////////////////////////////////////
 void RenderTarget::pushGLStates()
 {
+    // Pending geometry must be rendered before OpenGL is used directly
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
 #ifdef SFML_DEBUG
@@ -553,8 +772,15 @@ void RenderTarget::pushGLStates()
 ////////////////////////////////////////////////////////////
 void RenderTarget::popGLStates()
 {
+    // Pending geometry must be rendered with the states it was drawn with
+    flush();
+
     if (RenderTargetImpl::isActive(m_id) || setActive(true))
     {
+        // Unbind the shader of the last draw, it isn't part of the saved attributes
+        if (m_cache.lastShaderId != 0)
+            applyShader(nullptr);
+
         glCheck(glMatrixMode(GL_PROJECTION));
         glCheck(glPopMatrix());
         glCheck(glMatrixMode(GL_MODELVIEW));
@@ -692,6 +918,8 @@ void RenderTarget::applyCurrentView()
     glCheck(glMatrixMode(GL_MODELVIEW));
 
     m_cache.viewChanged = false;
+
+    ++m_statistics.viewChanges;
 }
 
 
@@ -745,6 +973,8 @@ void RenderTarget::applyBlendMode(const BlendMode& mode)
     }
 
     m_cache.lastBlendMode = mode;
+
+    ++m_statistics.blendModeChanges;
 }
 
 
@@ -782,6 +1012,8 @@ void RenderTarget::applyStencilMode(const StencilMode& mode)
     }
 
     m_cache.lastStencilMode = mode;
+
+    ++m_statistics.stencilModeChanges;
 }
 
 
@@ -804,6 +1036,8 @@ void RenderTarget::applyTexture(const Texture* texture, CoordinateType coordinat
 
     m_cache.lastTextureId      = texture ? texture->m_cacheId : 0;
     m_cache.lastCoordinateType = coordinateType;
+
+    ++m_statistics.textureBinds;
 }
 
 
@@ -811,6 +1045,328 @@ void RenderTarget::applyTexture(const Texture* texture, CoordinateType coordinat
 void RenderTarget::applyShader(const Shader* shader)
 {
     Shader::bind(shader);
+
+    m_cache.lastShaderId = shader ? shader->m_cacheId : 0;
+    m_cache.lastShaderTextureIds.clear();
+
+    if (shader)
+    {
+        // Remember which textures were bound to the texture units of the shader
+        for (const auto& [location, texture] : shader->m_textures)
+            m_cache.lastShaderTextureIds.push_back(texture->m_cacheId);
+
+        ++m_statistics.shaderBinds;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isShaderBound(const Shader& shader) const
+{
+    if ((shader.m_cacheId != m_cache.lastShaderId) || (shader.m_textures.size() != m_cache.lastShaderTextureIds.size()))
+        return false;
+
+    // The texture table is unchanged since the shader was bound, so it is iterated in the same order
+    auto textureId = m_cache.lastShaderTextureIds.begin();
+    for (const auto& [location, texture] : shader.m_textures)
+    {
+        // Like the texture of the draw, textures of render textures are always bound again
+        if (texture->m_fboAttachment || (texture->m_cacheId != *textureId++))
+            return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::submitVertices(const Vertex*       vertices,
+                                  std::size_t         vertexCount,
+                                  PrimitiveType       type,
+                                  const RenderStates& states,
+                                  const Indices&      indices)
+{
+    // Nothing to draw?
+    if (!vertices || (vertexCount == 0))
+        return;
+
+    // Indices past the end of the vertices would be read out of bounds, by the batch or by OpenGL
+    if (indices.data &&
+        !RenderTargetImpl::areIndicesInRange(indices.data, indices.count, indices.type, vertexCount))
+    {
+        err() << "Vertex indices must be lower than the vertex count (" << vertexCount << "), drawing skipped"
+              << std::endl;
+        return;
+    }
+
+    ++m_statistics.drawsSubmitted;
+
+    // Batched vertices are always pre-transformed
+    if (m_batch.enabled || (vertexCount <= m_cache.vertexCacheThreshold))
+    {
+        ++m_statistics.preTransformedDraws;
+        m_statistics.preTransformedVertices += vertexCount;
+    }
+    else
+    {
+        ++m_statistics.matrixTransformedDraws;
+        m_statistics.matrixTransformedVertices += vertexCount;
+    }
+
+    if (m_batch.enabled)
+        batchVertices(vertices, vertexCount, type, states, indices);
+    else
+        drawVertices(vertices, vertexCount, type, states, indices);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawVertices(const Vertex*       vertices,
+                                std::size_t         vertexCount,
+                                PrimitiveType       type,
+                                const RenderStates& states,
+                                const Indices&      indices)
+{
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        // Check if the vertex count is low enough so that we can pre-transform them
+        const bool useVertexCache = (vertexCount <= m_cache.vertexCacheThreshold);
+
+        if (useVertexCache)
+        {
+            // Grow the cache if needed, the vertex pointers must then be set up again
+            if (vertexCount > m_cache.vertexCache.size())
+            {
+                m_cache.vertexCache.resize(vertexCount);
+                m_cache.useVertexCache = false;
+            }
+
+            // Pre-transform the vertices and store them into the vertex cache
+            std::copy(vertices, vertices + vertexCount, m_cache.vertexCache.begin());
+            priv::transformPoints(states.transform,
+                                  vertexCount,
+                                  [this](std::size_t index) -> Vector2f&
+                                  { return m_cache.vertexCache[index].position; });
+        }
+
+        setupDraw(useVertexCache, states);
+
+        // Check if texture coordinates array is needed, and update client state accordingly
+        const bool enableTexCoordsArray = (states.texture || states.shader);
+        if (!m_cache.enable || (enableTexCoordsArray != m_cache.texCoordsArrayEnabled))
+        {
+            if (enableTexCoordsArray)
+                glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+            else
+                glCheck(glDisableClientState(GL_TEXTURE_COORD_ARRAY));
+        }
+
+        // If the context supports buffer objects, stream the vertices to the GPU
+        // instead of letting the driver copy them from client memory at every draw
+        std::optional<std::size_t> streamOffset;
+        if (!useVertexCache && VertexBuffer::isAvailable())
+        {
+            if (!m_streamBuffer)
+                m_streamBuffer = std::make_unique<priv::StreamBuffer>(GLEXT_GL_ARRAY_BUFFER);
+
+            streamOffset = m_streamBuffer->write(vertices, sizeof(Vertex) * vertexCount);
+        }
+
+        // If we switch between non-cache and cache mode or enable texture
+        // coordinates we need to set up the pointers to the vertices' components
+        if (!m_cache.enable || !useVertexCache || !m_cache.useVertexCache)
+        {
+            const auto* data = reinterpret_cast<const std::byte*>(vertices);
+
+            // If we pre-transform the vertices, we must use our internal vertex cache
+            if (useVertexCache)
+                data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+
+            // If we streamed the vertices, the pointers are offsets into the bound buffer
+            if (streamOffset)
+                data = reinterpret_cast<const std::byte*>(*streamOffset);
+
+            glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), data + 0));
+            glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), data + 8));
+            if (enableTexCoordsArray)
+                glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+        }
+        else if (enableTexCoordsArray && !m_cache.texCoordsArrayEnabled)
+        {
+            // If we enter this block, we are already using our internal vertex cache
+            const auto* data = reinterpret_cast<const std::byte*>(m_cache.vertexCache.data());
+
+            glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), data + 12));
+        }
+
+        // Indices are always read from client memory
+        if (indices.data)
+            drawIndexedPrimitives(type, indices.type, indices.data, indices.count);
+        else
+            drawPrimitives(type, 0, vertexCount);
+
+        // Whether they are streamed or read by the driver from client memory, the vertices are uploaded at every draw
+        const std::size_t indexSize = indices.type == IndexBuffer::Type::UInt16 ? sizeof(std::uint16_t)
+                                                                                : sizeof(std::uint32_t);
+        m_statistics.bytesUploaded += sizeof(Vertex) * vertexCount + (indices.data ? indexSize * indices.count : 0);
+
+        // Unbind the stream buffer, client-side arrays can't be used while it is bound
+        if (streamOffset)
+            VertexBuffer::bind(nullptr);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache        = useVertexCache;
+        m_cache.texCoordsArrayEnabled = enableTexCoordsArray;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawVertexBuffer(const VertexBuffer& vertexBuffer,
+                                    const IndexBuffer*  indexBuffer,
+                                    std::size_t         first,
+                                    std::size_t         count,
+                                    const RenderStates& states)
+{
+    // Pending geometry must be rendered first to preserve the drawing order
+    flush();
+
+    if (RenderTargetImpl::isActive(m_id) || setActive(true))
+    {
+        setupDraw(false, states);
+
+        // Bind vertex buffer
+        VertexBuffer::bind(&vertexBuffer);
+
+        // Always enable texture coordinates
+        if (!m_cache.enable || !m_cache.texCoordsArrayEnabled)
+            glCheck(glEnableClientState(GL_TEXTURE_COORD_ARRAY));
+
+        glCheck(glVertexPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(0)));
+        glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Vertex), reinterpret_cast<const void*>(8)));
+        glCheck(glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const void*>(12)));
+
+        if (indexBuffer)
+        {
+            // Bind index buffer, the indices are then given as an offset into it
+            IndexBuffer::bind(indexBuffer);
+
+            const std::size_t indexSize = indexBuffer->getType() == IndexBuffer::Type::UInt16 ? sizeof(std::uint16_t)
+                                                                                               : sizeof(std::uint32_t);
+            drawIndexedPrimitives(vertexBuffer.getPrimitiveType(),
+                                  indexBuffer->getType(),
+                                  reinterpret_cast<const void*>(first * indexSize),
+                                  count);
+
+            // Unbind index buffer
+            IndexBuffer::bind(nullptr);
+        }
+        else
+        {
+            drawPrimitives(vertexBuffer.getPrimitiveType(), first, count);
+        }
+
+        // Unbind vertex buffer
+        VertexBuffer::bind(nullptr);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_cache.useVertexCache        = false;
+        m_cache.texCoordsArrayEnabled = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::batchVertices(const Vertex*       vertices,
+                                 std::size_t         vertexCount,
+                                 PrimitiveType       type,
+                                 const RenderStates& states,
+                                 const Indices&      indices)
+{
+    const PrimitiveType batchType = RenderTargetImpl::batchPrimitiveType(type);
+    const std::uint64_t textureId = states.texture ? states.texture->m_cacheId : 0;
+
+    // Submit the pending geometry if the new one can't be merged into it
+    if ((batchType != m_batch.type) || (states.texture != m_batch.states.texture) || (textureId != m_batch.textureId) ||
+        (states.coordinateType != m_batch.states.coordinateType) || (states.shader != m_batch.states.shader) ||
+        (states.blendMode != m_batch.states.blendMode) || (states.stencilMode != m_batch.states.stencilMode))
+    {
+        flush();
+
+        m_batch.states           = states;
+        m_batch.states.transform = Transform::Identity;
+        m_batch.textureId        = textureId;
+        m_batch.type             = batchType;
+    }
+
+    // Indexed vertices are expanded, so that the batch only ever holds a plain list of primitives
+    const auto vertexIndex = [&indices](std::size_t index) -> std::size_t
+    {
+        if (!indices.data)
+            return index;
+
+        if (indices.type == IndexBuffer::Type::UInt16)
+            return static_cast<const std::uint16_t*>(indices.data)[index];
+
+        return static_cast<const std::uint32_t*>(indices.data)[index];
+    };
+
+    // Append the vertices as they are, they are all pre-transformed at once afterwards
+    const std::size_t first  = m_batch.vertices.size();
+    const std::size_t count  = indices.data ? indices.count : vertexCount;
+    const auto        append = [&](std::size_t index) { m_batch.vertices.push_back(vertices[vertexIndex(index)]); };
+
+    // Strips and fans can't be concatenated, so they are converted to their list counterparts
+    switch (type)
+    {
+        case PrimitiveType::Points:
+            for (std::size_t i = 0; i < count; ++i)
+                append(i);
+            break;
+        case PrimitiveType::Lines:
+            // Incomplete primitives are dropped, as OpenGL would do
+            for (std::size_t i = 0; i < count - count % 2; ++i)
+                append(i);
+            break;
+        case PrimitiveType::LineStrip:
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                append(i - 1);
+                append(i);
+            }
+            break;
+        case PrimitiveType::Triangles:
+            for (std::size_t i = 0; i < count - count % 3; ++i)
+                append(i);
+            break;
+        case PrimitiveType::TriangleStrip:
+            for (std::size_t i = 2; i < count; ++i)
+            {
+                // Keep the winding of the triangles consistent
+                append(i % 2 ? i - 1 : i - 2);
+                append(i % 2 ? i - 2 : i - 1);
+                append(i);
+            }
+            break;
+        case PrimitiveType::TriangleFan:
+            for (std::size_t i = 2; i < count; ++i)
+            {
+                append(0);
+                append(i - 1);
+                append(i);
+            }
+            break;
+    }
+
+    // Pre-transform the appended vertices
+    Vertex* appended = m_batch.vertices.data() + first;
+    priv::transformPoints(states.transform,
+                          m_batch.vertices.size() - first,
+                          [appended](std::size_t index) -> Vector2f& { return appended[index].position; });
 }
 
 
@@ -849,14 +1405,20 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
     // Apply the view
     if (!m_cache.enable || m_cache.viewChanged)
         applyCurrentView();
+    else
+        ++m_statistics.viewChangesSkipped;
 
     // Apply the blend mode
     if (!m_cache.enable || (states.blendMode != m_cache.lastBlendMode))
         applyBlendMode(states.blendMode);
+    else
+        ++m_statistics.blendModeChangesSkipped;
 
     // Apply the stencil mode
     if (!m_cache.enable || (states.stencilMode != m_cache.lastStencilMode))
         applyStencilMode(states.stencilMode);
+    else
+        ++m_statistics.stencilModeChangesSkipped;
 
     // Mask the color buffer off if necessary
     if (states.stencilMode.stencilOnly)
@@ -878,34 +1440,69 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
         const std::uint64_t textureId = states.texture ? states.texture->m_cacheId : 0;
         if (textureId != m_cache.lastTextureId || states.coordinateType != m_cache.lastCoordinateType)
             applyTexture(states.texture, states.coordinateType);
+        else
+            ++m_statistics.textureBindsSkipped;
     }
 
-    // Apply the shader
+    // Apply the shader, it stays bound after the draw until another draw needs a different one
     if (states.shader)
-        applyShader(states.shader);
+    {
+        if (!m_cache.enable || !isShaderBound(*states.shader))
+        {
+            applyShader(states.shader);
+        }
+        else
+        {
+            // Uniforms set since the last draw still have to be uploaded
+            states.shader->uploadUniforms();
+
+            // Binding the shader takes a call to use the program, three calls per texture unit to set its sampler
+            // and bind its texture, one to reset the active unit, one for the current texture and one per buffer
+            ++m_statistics.shaderBindsSkipped;
+            m_statistics.shaderCallsSkipped += 2 + 3 * states.shader->m_textures.size() +
+                                               (states.shader->m_currentTexture != -1 ? 1 : 0) +
+                                               states.shader->m_uniformBlocks.size();
+        }
+    }
+    else if ((m_cache.lastShaderId != 0) || (!m_cache.enable && Shader::isAvailable()))
+    {
+        // Unbind the shader of a previous draw, or any shader left by another target if the cache is invalid
+        applyShader(nullptr);
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
-    // Find the OpenGL primitive type
-    static constexpr priv::EnumArray<PrimitiveType, GLenum, 6> modes =
-        {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
-    const GLenum mode = modes[type];
+    // Draw the primitives
+    glCheck(glDrawArrays(RenderTargetImpl::primitiveModes[type],
+                         static_cast<GLint>(firstVertex),
+                         static_cast<GLsizei>(vertexCount)));
+
+    ++m_statistics.drawCallsIssued;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedPrimitives(PrimitiveType     type,
+                                         IndexBuffer::Type indexType,
+                                         const void*       indices,
+                                         std::size_t       indexCount)
+{
+    const GLenum glIndexType = indexType == IndexBuffer::Type::UInt16 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
 
     // Draw the primitives
-    glCheck(glDrawArrays(mode, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
+    glCheck(
+        glDrawElements(RenderTargetImpl::primitiveModes[type], static_cast<GLsizei>(indexCount), glIndexType, indices));
+
+    ++m_statistics.drawCallsIssued;
 }
 
 
 ////////////////////////////////////////////////////////////
 void RenderTarget::cleanupDraw(const RenderStates& states)
 {
-    // Unbind the shader, if any
-    if (states.shader)
-        applyShader(nullptr);
-
     // If the texture we used to draw belonged to a RenderTexture, then forcibly unbind that texture.
     // This prevents a bug where some drivers do not clear RenderTextures properly.
     if (states.texture && states.texture->m_fboAttachment)
@@ -936,7 +1533,8 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 //   lead, in worst case, to changing it every 4 vertices.
 //   To avoid that, when the vertex count is low enough, we
 //   pre-transform them and therefore use an identity transform
-//   to render them.
+//   to render them. The threshold is configurable per target,
+//   and the cache grows to hold the largest pre-transformed draw.
 //
 // * Blending mode
 //   Since it overloads the == operator, we can easily check
@@ -950,11 +1548,26 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 //   a new texture instance. We need to use our own unique
 //   identifier system to ensure consistent caching.
 //
+// * Batching
+//   When enabled, consecutive draws sharing the same texture,
+//   shader, blend and stencil modes are pre-transformed into a
+//   single list of points, lines or triangles, and submitted
+//   with one draw call when incompatible states are requested
+//   or when the target is cleared, displayed or its view changes.
+//
 // * Shader
-//   Shaders are very hard to optimize, because they have
-//   parameters that can be hard (if not impossible) to track,
-//   like matrices or textures. The only optimization that we
-//   do is that we avoid setting a null shader if there was
-//   already none for the previous draw.
+//   The shader stays bound after a draw. Its own unique
+//   identifier (m_cacheId) is renewed whenever what it binds
+//   changes: a new program, a texture or uniform buffer
+//   assigned to a uniform, or another location for the
+//   current texture. The identifiers of the textures bound
+//   to its units are stored along with it, so isShaderBound
+//   can tell whether the next draw may skip binding it again;
+//   uniform values set in the meantime are then sent with
+//   uploadUniforms. Textures of render textures are always
+//   bound again, like the texture of the draw. resetGLStates
+//   unbinds the shader, and everything is bound again while
+//   the cache is disabled, i.e. after another target used
+//   the same context.
 //
 ////////////////////////////////////////////////////////////
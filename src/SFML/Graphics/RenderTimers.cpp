@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/RenderTimers.hpp>
+
+#include <SFML/Window/Context.hpp>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+RenderTimers::~RenderTimers()
+{
+    // Queries aren't shared between contexts: those of an inactive context
+    // can't be deleted from here, they are released along with their context
+    const std::uint64_t contextId = Context::getActiveContextId();
+    for (auto& [name, region] : m_regions)
+    {
+        if ((region.contextId != 0) && (region.contextId == contextId))
+            glCheck(GLEXT_glDeleteQueries(static_cast<GLsizei>(region.queries.size()), region.queries.data()));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTimers::begin(const std::string& name)
+{
+    end();
+
+    Region& region = m_regions[name];
+    m_current      = &region;
+
+    if (isAvailable())
+    {
+        // Queries created in another context can't be used here, they are abandoned
+        const std::uint64_t contextId = Context::getActiveContextId();
+        if (region.contextId != contextId)
+        {
+            glCheck(GLEXT_glGenQueries(static_cast<GLsizei>(region.queries.size()), region.queries.data()));
+            region.contextId    = contextId;
+            region.firstPending = 0;
+            region.pendingCount = 0;
+        }
+
+        pollQueries(region);
+
+        // If all the queries are still in flight the GPU is several frames behind, skip this timing
+        region.querying = region.pendingCount < region.queries.size();
+        if (region.querying)
+        {
+            const std::size_t index = (region.firstPending + region.pendingCount) % region.queries.size();
+            glCheck(GLEXT_glBeginQuery(GLEXT_GL_TIME_ELAPSED, region.queries[index]));
+        }
+    }
+
+    m_clock.restart();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTimers::end()
+{
+    if (!m_current)
+        return;
+
+    Region& region = *m_current;
+    m_current      = nullptr;
+
+    region.results.cpuTime = m_clock.getElapsedTime();
+
+    if (region.querying)
+    {
+        glCheck(GLEXT_glEndQuery(GLEXT_GL_TIME_ELAPSED));
+        ++region.pendingCount;
+        region.querying = false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<RenderTarget::TimerResults> RenderTimers::getResults(const std::string& name) const
+{
+    const auto it = m_regions.find(name);
+    if (it == m_regions.end())
+        return std::nullopt;
+
+    return it->second.results;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTimers::isAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        ensureExtensionsInit();
+
+        return GLEXT_timer_query != 0;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTimers::pollQueries(Region& region)
+{
+    // Queries complete in the order they were issued, so reading stops at the first pending one
+    while (region.pendingCount > 0)
+    {
+        const unsigned int query     = region.queries[region.firstPending];
+        GLint              available = 0;
+        glCheck(GLEXT_glGetQueryObjectiv(query, GLEXT_GL_QUERY_RESULT_AVAILABLE, &available));
+        if (available == GL_FALSE)
+            break;
+
+        GLuint64 nanoseconds = 0;
+        glCheck(GLEXT_glGetQueryObjectui64v(query, GLEXT_GL_QUERY_RESULT, &nanoseconds));
+        region.results.gpuTime = microseconds(static_cast<std::int64_t>(nanoseconds / 1000));
+
+        region.firstPending = (region.firstPending + 1) % region.queries.size();
+        --region.pendingCount;
+    }
+}
+
+} // namespace sf::priv
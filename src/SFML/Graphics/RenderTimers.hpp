@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Clock.hpp>
+
+#include <array>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief CPU and GPU timers of the regions of the frames of a render target
+///
+////////////////////////////////////////////////////////////
+class RenderTimers : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTimers() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RenderTimers();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTimers(const RenderTimers&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTimers& operator=(const RenderTimers&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start timing a region
+    ///
+    /// The context of the render target must be active. If a
+    /// region is already being timed, it is ended first.
+    ///
+    /// \param name Name of the region
+    ///
+    ////////////////////////////////////////////////////////////
+    void begin(const std::string& name);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop timing the current region
+    ///
+    /// The context active in `begin` must still be active.
+    ///
+    ////////////////////////////////////////////////////////////
+    void end();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the latest results of a region
+    ///
+    /// \param name Name of the region
+    ///
+    /// \return Results of the region, or `std::nullopt` if it was never timed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<RenderTarget::TimerResults> getResults(const std::string& name) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether or not the system supports timer queries
+    ///
+    /// \return `true` if GPU times can be measured, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Timer queries and results of a region
+    ///
+    /// The queries form a ring: a new one is started at every
+    /// timing while the older ones wait for the GPU, so that
+    /// their results can be read without stalling.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Region
+    {
+        RenderTarget::TimerResults  results;        //!< Latest results of the region
+        std::array<unsigned int, 4> queries{};      //!< Ring of timer queries
+        std::uint64_t               contextId{};    //!< Context owning the queries, zero until they are created
+        std::size_t                 firstPending{}; //!< Index of the oldest query waiting for its result
+        std::size_t                 pendingCount{}; //!< Number of queries waiting for their result
+        bool                        querying{};     //!< Is a query running for the current timing?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read the results of the queries completed by the GPU
+    ///
+    /// \param region Region whose queries are read
+    ///
+    ////////////////////////////////////////////////////////////
+    static void pollQueries(Region& region);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::unordered_map<std::string, Region> m_regions;   //!< Regions timed so far, by name
+    Region*                                 m_current{}; //!< Region being timed, null if none
+    Clock                                   m_clock;     //!< Measures the CPU time of the current region
+};
+
+} // namespace sf::priv
@@ -103,6 +103,16 @@ bool RenderWindow::setActive(bool active)
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderWindow::display()
+{
+    // Render the pending geometry before swapping the buffers
+    flush();
+
+    Window::display();
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderWindow::onCreate()
 {
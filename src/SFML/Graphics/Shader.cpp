@@ -28,9 +28,12 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/GLCheck.hpp>
 #include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/ProgramCache.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
 
+#include <SFML/Window/Context.hpp>
 #include <SFML/Window/GlResource.hpp>
 
 #include <SFML/System/Err.hpp>
@@ -41,13 +44,17 @@
 #include <SFML/System/Vector3.hpp>
 
 #include <array>
+#include <atomic>
 #include <fstream>
 #include <iomanip>
 #include <ostream>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <cassert>
 #include <cstdint>
+#include <cstring>
 
 #ifndef SFML_OPENGL_ES
 
@@ -79,6 +86,252 @@ std::size_t getMaxTextureUnits()
     return static_cast<std::size_t>(maxUnits);
 }
 
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ShaderImpl
+{
+// Thread-safe unique identifier generator,
+// is used for states cache (see RenderTarget)
+std::uint64_t getUniqueId() noexcept
+{
+    static std::atomic<std::uint64_t> id(1); // start at 1, zero is "no shader"
+
+    return id.fetch_add(1);
+}
+
+// A program submitted to the driver, whose compilation and link haven't been checked yet
+struct PendingProgram
+{
+    GLEXT_GLhandle                program{};    // Program object, zero if the creation failed
+    std::array<GLEXT_GLhandle, 3> shaders{};    // Vertex, geometry and fragment shaders, zero if absent
+    std::uint64_t                 cacheKey{};   // Key of the program in the cache, zero if not cached
+    bool                          fromBinary{}; // Was the program read from the cache?
+};
+
+// Make sure that shaders can be created from the given sources
+bool checkAvailability(std::string_view geometryShaderCode)
+{
+    // First make sure that we can use shaders
+    if (!sf::Shader::isAvailable())
+    {
+        sf::err() << "Failed to create a shader: your system doesn't support shaders "
+                  << "(you should test Shader::isAvailable() before trying to use the Shader class)" << std::endl;
+        return false;
+    }
+
+    // Make sure we can use geometry shaders
+    if (!geometryShaderCode.empty() && !sf::Shader::isGeometryAvailable())
+    {
+        sf::err() << "Failed to create a shader: your system doesn't support geometry shaders "
+                  << "(you should test Shader::isGeometryAvailable() before trying to use geometry shaders)"
+                  << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+// Let the driver compile shaders on as many threads as it likes, where KHR_parallel_shader_compile
+// (or its ARB twin) is supported; the extension isn't exposed by the OpenGL loader, so it is loaded here
+void enableParallelCompile()
+{
+    using MaxShaderCompilerThreadsFunc = void(GLAD_API_PTR*)(GLuint);
+
+    static const auto maxShaderCompilerThreads = []() -> MaxShaderCompilerThreadsFunc
+    {
+        if (sf::Context::isExtensionAvailable("GL_KHR_parallel_shader_compile"))
+            return reinterpret_cast<MaxShaderCompilerThreadsFunc>(
+                sf::Context::getFunction("glMaxShaderCompilerThreadsKHR"));
+
+        if (sf::Context::isExtensionAvailable("GL_ARB_parallel_shader_compile"))
+            return reinterpret_cast<MaxShaderCompilerThreadsFunc>(
+                sf::Context::getFunction("glMaxShaderCompilerThreadsARB"));
+
+        return nullptr;
+    }();
+
+    // 0xFFFFFFFF lets the implementation choose the number of threads
+    if (maxShaderCompilerThreads)
+        glCheck(maxShaderCompilerThreads(0xFFFFFFFF));
+}
+
+// Compute the key of a program in the cache, or zero if the cache is disabled or unsupported
+std::uint64_t getProgramCacheKey(std::string_view vertexShaderCode,
+                                 std::string_view geometryShaderCode,
+                                 std::string_view fragmentShaderCode)
+{
+    if (!sf::Shader::isProgramCacheAvailable() || sf::priv::getProgramCacheDirectory().empty())
+        return 0;
+
+    const auto getString = [](GLenum name)
+    {
+        const auto* string = reinterpret_cast<const char*>(glCheck(glGetString(name)));
+        return string ? std::string_view(string) : std::string_view();
+    };
+
+    const std::uint64_t key = sf::priv::getProgramCacheKey({getString(GL_VENDOR),
+                                                            getString(GL_RENDERER),
+                                                            getString(GL_VERSION),
+                                                            vertexShaderCode,
+                                                            geometryShaderCode,
+                                                            fragmentShaderCode});
+
+    // Zero means "not cached"
+    return key ? key : 1;
+}
+
+// Create a program from the binary cached for the key, if the driver accepts it
+GLEXT_GLhandle createProgramFromCache(std::uint64_t key)
+{
+    const std::optional binary = sf::priv::loadProgramBinary(key);
+    if (!binary)
+        return {};
+
+    const GLEXT_GLhandle program = glCheck(GLEXT_glCreateProgramObject());
+    glCheck(GLEXT_glProgramBinary(castFromGlHandle(program),
+                                  binary->format,
+                                  binary->data.data(),
+                                  static_cast<GLsizei>(binary->data.size())));
+
+    // The driver rejects binaries made by other versions of itself by failing the link
+    GLint success = 0;
+    glCheck(GLEXT_glGetObjectParameteriv(program, GLEXT_GL_OBJECT_LINK_STATUS, &success));
+    if (success == GL_FALSE)
+    {
+        glCheck(GLEXT_glDeleteObject(program));
+        sf::priv::removeProgramBinary(key);
+        return {};
+    }
+
+    return program;
+}
+
+// Save the binary of a linked program to the cache
+void saveProgramToCache(GLEXT_GLhandle program, std::uint64_t key)
+{
+    GLint length = 0;
+    glCheck(GLEXT_glGetProgramiv(castFromGlHandle(program), GLEXT_GL_PROGRAM_BINARY_LENGTH, &length));
+    if (length <= 0)
+        return;
+
+    sf::priv::ProgramBinary binary;
+    binary.data.resize(static_cast<std::size_t>(length));
+
+    GLenum format = 0;
+    glCheck(GLEXT_glGetProgramBinary(castFromGlHandle(program), length, nullptr, &format, binary.data.data()));
+    binary.format = format;
+
+    sf::priv::saveProgramBinary(key, binary);
+}
+
+// Submit the sources of a program to the driver, without waiting for the compilation
+PendingProgram startProgram(std::string_view vertexShaderCode,
+                            std::string_view geometryShaderCode,
+                            std::string_view fragmentShaderCode)
+{
+    PendingProgram pending;
+
+    // Skip the compilation entirely if the program is cached
+    pending.cacheKey = getProgramCacheKey(vertexShaderCode, geometryShaderCode, fragmentShaderCode);
+    if (pending.cacheKey)
+    {
+        pending.program    = createProgramFromCache(pending.cacheKey);
+        pending.fromBinary = pending.program != GLEXT_GLhandle{};
+        if (pending.fromBinary)
+            return pending;
+    }
+
+    // Create the program
+    pending.program = glCheck(GLEXT_glCreateProgramObject());
+
+    // Create, compile and attach the shaders; the compile status is checked after the link,
+    // shaders can be deleted as soon as they are attached (they live until the program does)
+    static constexpr std::array<GLenum, 3> shaderTypes = {GLEXT_GL_VERTEX_SHADER,
+                                                          GLEXT_GL_GEOMETRY_SHADER,
+                                                          GLEXT_GL_FRAGMENT_SHADER};
+    const std::array<std::string_view, 3>  shaderCodes = {vertexShaderCode, geometryShaderCode, fragmentShaderCode};
+    for (std::size_t i = 0; i < shaderCodes.size(); ++i)
+    {
+        if (shaderCodes[i].empty())
+            continue;
+
+        const GLEXT_GLhandle shader           = glCheck(GLEXT_glCreateShaderObject(shaderTypes[i]));
+        const GLcharARB*     sourceCode       = shaderCodes[i].data();
+        const auto           sourceCodeLength = static_cast<GLint>(shaderCodes[i].length());
+        glCheck(GLEXT_glShaderSource(shader, 1, &sourceCode, &sourceCodeLength));
+        glCheck(GLEXT_glCompileShader(shader));
+        glCheck(GLEXT_glAttachObject(pending.program, shader));
+        pending.shaders[i] = shader;
+    }
+
+    // Ask the driver to keep the binary around if it is going to be cached
+    if (pending.cacheKey)
+        glCheck(GLEXT_glProgramParameteri(castFromGlHandle(pending.program),
+                                          GLEXT_GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                                          GL_TRUE));
+
+    // Link the program
+    glCheck(GLEXT_glLinkProgram(pending.program));
+
+    return pending;
+}
+
+// Wait for a program submitted with startProgram, and check the result of its compilation
+bool finishProgram(PendingProgram& pending)
+{
+    if (pending.fromBinary)
+        return true;
+
+    // Check the compile logs
+    static constexpr std::array<const char*, 3> shaderTypeNames = {"vertex", "geometry", "fragment"};
+
+    bool success = true;
+    for (std::size_t i = 0; i < pending.shaders.size(); ++i)
+    {
+        const GLEXT_GLhandle shader = std::exchange(pending.shaders[i], GLEXT_GLhandle{});
+        if (shader == GLEXT_GLhandle{})
+            continue;
+
+        GLint compiled = 0;
+        glCheck(GLEXT_glGetObjectParameteriv(shader, GLEXT_GL_OBJECT_COMPILE_STATUS, &compiled));
+        if (success && compiled == GL_FALSE)
+        {
+            std::array<char, 1024> log{};
+            glCheck(GLEXT_glGetInfoLog(shader, static_cast<GLsizei>(log.size()), nullptr, log.data()));
+            sf::err() << "Failed to compile " << shaderTypeNames[i] << " shader:" << '\n' << log.data() << std::endl;
+            success = false;
+        }
+
+        glCheck(GLEXT_glDeleteObject(shader));
+    }
+
+    // Check the link log
+    if (success)
+    {
+        GLint linked = 0;
+        glCheck(GLEXT_glGetObjectParameteriv(pending.program, GLEXT_GL_OBJECT_LINK_STATUS, &linked));
+        if (linked == GL_FALSE)
+        {
+            std::array<char, 1024> log{};
+            glCheck(GLEXT_glGetInfoLog(pending.program, static_cast<GLsizei>(log.size()), nullptr, log.data()));
+            sf::err() << "Failed to link shader:" << '\n' << log.data() << std::endl;
+            success = false;
+        }
+    }
+
+    if (!success)
+    {
+        glCheck(GLEXT_glDeleteObject(pending.program));
+        pending.program = {};
+        return false;
+    }
+
+    if (pending.cacheKey)
+        saveProgramToCache(pending.program, pending.cacheKey);
+
+    return true;
+}
+} // namespace ShaderImpl
+
 // Read the contents of a file into an array of char
 bool getFileContents(const std::filesystem::path& filename, std::vector<char>& buffer)
 {
@@ -173,57 +426,6 @@ std::vector<float> flatten(const sf::Glsl::Vec4* vectorArray, std::size_t length
 
 namespace sf
 {
-////////////////////////////////////////////////////////////
-struct Shader::UniformBinder
-{
-    ////////////////////////////////////////////////////////////
-    /// \brief Constructor: set up state before uniform is set
-    ///
-    ////////////////////////////////////////////////////////////
-    UniformBinder(Shader& shader, const std::string& name) : currentProgram(castToGlHandle(shader.m_shaderProgram))
-    {
-        if (currentProgram)
-        {
-            // Enable program object
-            savedProgram = glCheck(GLEXT_glGetHandle(GLEXT_GL_PROGRAM_OBJECT));
-            if (currentProgram != savedProgram)
-                glCheck(GLEXT_glUseProgramObject(currentProgram));
-
-            // Store uniform location for further use outside constructor
-            location = shader.getUniformLocation(name);
-        }
-    }
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Destructor: restore state after uniform is set
-    ///
-    ////////////////////////////////////////////////////////////
-    ~UniformBinder()
-    {
-        // Disable program object
-        if (currentProgram && (currentProgram != savedProgram))
-            glCheck(GLEXT_glUseProgramObject(savedProgram));
-    }
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Deleted copy constructor
-    ///
-    ////////////////////////////////////////////////////////////
-    UniformBinder(const UniformBinder&) = delete;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Deleted copy assignment
-    ///
-    ////////////////////////////////////////////////////////////
-    UniformBinder& operator=(const UniformBinder&) = delete;
-
-    TransientContextLock lock;           //!< Lock to keep context active while uniform is bound
-    GLEXT_GLhandle       savedProgram{}; //!< Handle to the previously active program object
-    GLEXT_GLhandle       currentProgram; //!< Handle to the program object of the modified sf::Shader instance
-    GLint                location{-1};   //!< Uniform location, used by the surrounding sf::Shader code
-};
-
-
 ////////////////////////////////////////////////////////////
 Shader::Shader(const std::filesystem::path& filename, Type type)
 {
@@ -313,7 +515,11 @@ Shader::Shader(Shader&& source) noexcept :
 m_shaderProgram(std::exchange(source.m_shaderProgram, 0u)),
 m_currentTexture(std::exchange(source.m_currentTexture, -1)),
 m_textures(std::move(source.m_textures)),
-m_uniforms(std::move(source.m_uniforms))
+m_uniformBlocks(std::move(source.m_uniformBlocks)),
+m_uniforms(std::move(source.m_uniforms)),
+m_uniformValues(std::move(source.m_uniformValues)),
+m_pendingUniforms(std::move(source.m_pendingUniforms)),
+m_cacheId(std::exchange(source.m_cacheId, 0))
 {
 }
 
@@ -334,10 +540,14 @@ Shader& Shader::operator=(Shader&& right) noexcept
     }
 
     // Move the contents of right.
-    m_shaderProgram  = std::exchange(right.m_shaderProgram, 0u);
-    m_currentTexture = std::exchange(right.m_currentTexture, -1);
-    m_textures       = std::move(right.m_textures);
-    m_uniforms       = std::move(right.m_uniforms);
+    m_shaderProgram   = std::exchange(right.m_shaderProgram, 0u);
+    m_currentTexture  = std::exchange(right.m_currentTexture, -1);
+    m_textures        = std::move(right.m_textures);
+    m_uniformBlocks   = std::move(right.m_uniformBlocks);
+    m_uniforms        = std::move(right.m_uniforms);
+    m_uniformValues   = std::move(right.m_uniformValues);
+    m_pendingUniforms = std::move(right.m_pendingUniforms);
+    m_cacheId         = std::exchange(right.m_cacheId, 0);
     return *this;
 }
 
@@ -530,75 +740,137 @@ bool Shader::loadFromStream(InputStream& vertexShaderStream, InputStream& geomet
 }
 
 
+////////////////////////////////////////////////////////////
+template <typename T>
+void Shader::storeUniform(UniformHandle handle, UniformType type, const T* values, std::size_t count)
+{
+    // Number of components of each type of value, in the order of UniformType
+    static constexpr std::array<std::size_t, 10> componentCounts{1, 2, 3, 4, 1, 2, 3, 4, 9, 16};
+
+    if ((handle.m_index >= m_uniformValues.size()) || (count == 0))
+        return;
+
+    Uniform& uniform = m_uniformValues[handle.m_index];
+    if (uniform.location == -1)
+        return;
+
+    std::vector<T>& storage = [&uniform]() -> std::vector<T>&
+    {
+        if constexpr (std::is_same_v<T, float>)
+            return uniform.floats;
+        else
+            return uniform.ints;
+    }();
+
+    const std::size_t size = count * componentCounts[static_cast<std::size_t>(type)];
+
+    // Setting the value that the uniform already has, or will have once uploaded, changes nothing
+    if ((uniform.type == type) && (uniform.count == count) &&
+        (std::memcmp(storage.data(), values, size * sizeof(T)) == 0))
+        return;
+
+    storage.assign(values, values + size);
+    uniform.type  = type;
+    uniform.count = count;
+
+    // The value is uploaded the next time the shader is bound
+    if (!uniform.pending)
+    {
+        uniform.pending = true;
+        m_pendingUniforms.push_back(handle.m_index);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Shader::UniformHandle> Shader::getUniformHandle(const std::string& name)
+{
+    if (!m_shaderProgram)
+        return std::nullopt;
+
+    // Check the cache
+    auto it = m_uniforms.find(name);
+    if (it == m_uniforms.end())
+    {
+        // Not in cache, request the location from OpenGL
+        const TransientContextLock lock;
+
+        const int location = GLEXT_glGetUniformLocation(castToGlHandle(m_shaderProgram), name.c_str());
+        if (location == -1)
+            err() << "Uniform " << std::quoted(name) << " not found in shader" << std::endl;
+
+        it = m_uniforms.try_emplace(name, m_uniformValues.size()).first;
+        m_uniformValues.emplace_back().location = location;
+    }
+
+    if (m_uniformValues[it->second].location == -1)
+        return std::nullopt;
+
+    return UniformHandle(it->second);
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, float x)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform1f(binder.location, x));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniform(*handle, x);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, Glsl::Vec2 v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform2f(binder.location, v.x, v.y));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniform(*handle, v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Vec3& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform3f(binder.location, v.x, v.y, v.z));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniform(*handle, v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Vec4& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform4f(binder.location, v.x, v.y, v.z, v.w));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniform(*handle, v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, int x)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform1i(binder.location, x));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniform(*handle, x);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, Glsl::Ivec2 v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform2i(binder.location, v.x, v.y));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniform(*handle, v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Ivec3& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform3i(binder.location, v.x, v.y, v.z));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniform(*handle, v);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Ivec4& v)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform4i(binder.location, v.x, v.y, v.z, v.w));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniform(*handle, v);
 }
 
 
@@ -633,18 +905,16 @@ void Shader::setUniform(const std::string& name, const Glsl::Bvec4& v)
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Mat3& matrix)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix3fv(binder.location, 1, GL_FALSE, matrix.array.data()));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniform(*handle, matrix);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(const std::string& name, const Glsl::Mat4& matrix)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix4fv(binder.location, 1, GL_FALSE, matrix.array.data()));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniform(*handle, matrix);
 }
 
 
@@ -673,11 +943,13 @@ void Shader::setUniform(const std::string& name, const Texture& texture)
             }
 
             m_textures[location] = &texture;
+            m_cacheId            = ShaderImpl::getUniqueId();
         }
-        else
+        else if (it->second != &texture)
         {
             // Location already used, just replace the texture
             it->second = &texture;
+            m_cacheId  = ShaderImpl::getUniqueId();
         }
     }
 }
@@ -691,242 +963,451 @@ void Shader::setUniform(const std::string& name, CurrentTextureType)
 
     const TransientContextLock lock;
 
-    // Find the location of the variable in the shader
-    m_currentTexture = getUniformLocation(name);
+    // Find the location of the variable in the shader, the bound state only changes with it
+    const int location = getUniformLocation(name);
+    if (location != m_currentTexture)
+    {
+        m_currentTexture = location;
+        m_cacheId        = ShaderImpl::getUniqueId();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformBlock(const std::string& name, const UniformBuffer& buffer)
+{
+    if (!m_shaderProgram)
+        return;
+
+    if (!UniformBuffer::isAvailable())
+    {
+        err() << "Impossible to use uniform block " << std::quoted(name)
+              << " for shader: your system doesn't support uniform buffers" << std::endl;
+        return;
+    }
+
+    const TransientContextLock lock;
+
+    // Find the index of the block in the shader
+    const GLuint index = glCheck(GLEXT_glGetUniformBlockIndex(m_shaderProgram, name.c_str()));
+    if (index == GLEXT_GL_INVALID_INDEX)
+    {
+        err() << "Uniform block " << std::quoted(name) << " not found in shader" << std::endl;
+        return;
+    }
+
+    // Store the index -> buffer mapping
+    const auto it = m_uniformBlocks.find(index);
+    if (it == m_uniformBlocks.end())
+    {
+        // New entry, the block reads the buffer bound to the binding point of the same number
+        glCheck(GLEXT_glUniformBlockBinding(m_shaderProgram, index, index));
+
+        m_uniformBlocks[index] = &buffer;
+        m_cacheId              = ShaderImpl::getUniqueId();
+    }
+    else if (it->second != &buffer)
+    {
+        // Block already used, just replace the buffer
+        it->second = &buffer;
+        m_cacheId  = ShaderImpl::getUniqueId();
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const float* scalarArray, std::size_t length)
 {
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform1fv(binder.location, static_cast<GLsizei>(length), scalarArray));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniformArray(*handle, scalarArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Vec2* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform2fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniformArray(*handle, vectorArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Vec3* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform3fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniformArray(*handle, vectorArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Vec4* vectorArray, std::size_t length)
 {
-    std::vector<float> contiguous = flatten(vectorArray, length);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniform4fv(binder.location, static_cast<GLsizei>(length), contiguous.data()));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniformArray(*handle, vectorArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Mat3* matrixArray, std::size_t length)
 {
-    static const std::size_t matrixSize = matrixArray[0].array.size();
-
-    std::vector<float> contiguous(matrixSize * length);
-    for (std::size_t i = 0; i < length; ++i)
-        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
-
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix3fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+    if (const std::optional handle = getUniformHandle(name))
+        setUniformArray(*handle, matrixArray, length);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(const std::string& name, const Glsl::Mat4* matrixArray, std::size_t length)
 {
-    static const std::size_t matrixSize = matrixArray[0].array.size();
+    if (const std::optional handle = getUniformHandle(name))
+        setUniformArray(*handle, matrixArray, length);
+}
 
-    std::vector<float> contiguous(matrixSize * length);
-    for (std::size_t i = 0; i < length; ++i)
-        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
 
-    const UniformBinder binder(*this, name);
-    if (binder.location != -1)
-        glCheck(GLEXT_glUniformMatrix4fv(binder.location, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, float x)
+{
+    storeUniform(handle, UniformType::Float, &x, 1);
 }
 
 
 ////////////////////////////////////////////////////////////
-unsigned int Shader::getNativeHandle() const
+void Shader::setUniform(UniformHandle handle, Glsl::Vec2 v)
 {
-    return m_shaderProgram;
+    const std::array values{v.x, v.y};
+    storeUniform(handle, UniformType::Vec2, values.data(), 1);
 }
 
 
 ////////////////////////////////////////////////////////////
-void Shader::bind(const Shader* shader)
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec3& v)
 {
-    const TransientContextLock lock;
+    const std::array values{v.x, v.y, v.z};
+    storeUniform(handle, UniformType::Vec3, values.data(), 1);
+}
 
-    // Make sure that we can use shaders
-    if (!isAvailable())
-    {
-        err() << "Failed to bind or unbind shader: your system doesn't support shaders "
-              << "(you should test Shader::isAvailable() before trying to use the Shader class)" << std::endl;
-        return;
-    }
 
-    if (shader && shader->m_shaderProgram)
-    {
-        // Enable the program
-        glCheck(GLEXT_glUseProgramObject(castToGlHandle(shader->m_shaderProgram)));
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Vec4& v)
+{
+    const std::array values{v.x, v.y, v.z, v.w};
+    storeUniform(handle, UniformType::Vec4, values.data(), 1);
+}
 
-        // Bind the textures
-        shader->bindTextures();
 
-        // Bind the current texture
-        if (shader->m_currentTexture != -1)
-            glCheck(GLEXT_glUniform1i(shader->m_currentTexture, 0));
-    }
-    else
-    {
-        // Bind no shader
-        glCheck(GLEXT_glUseProgramObject({}));
-    }
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, int x)
+{
+    storeUniform(handle, UniformType::Int, &x, 1);
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::isAvailable()
+void Shader::setUniform(UniformHandle handle, Glsl::Ivec2 v)
 {
-    static const bool available = []
-    {
-        const TransientContextLock contextLock;
-
-        // Make sure that extensions are initialized
-        priv::ensureExtensionsInit();
+    const std::array values{v.x, v.y};
+    storeUniform(handle, UniformType::Ivec2, values.data(), 1);
+}
 
-        return GLEXT_multitexture && GLEXT_shading_language_100 && GLEXT_shader_objects && GLEXT_vertex_shader &&
-               GLEXT_fragment_shader;
-    }();
 
-    return available;
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec3& v)
+{
+    const std::array values{v.x, v.y, v.z};
+    storeUniform(handle, UniformType::Ivec3, values.data(), 1);
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::isGeometryAvailable()
+void Shader::setUniform(UniformHandle handle, const Glsl::Ivec4& v)
 {
-    static const bool available = []
-    {
-        const TransientContextLock contextLock;
-
-        // Make sure that extensions are initialized
-        priv::ensureExtensionsInit();
+    const std::array values{v.x, v.y, v.z, v.w};
+    storeUniform(handle, UniformType::Ivec4, values.data(), 1);
+}
 
-        return isAvailable() && (GLEXT_geometry_shader4 || GLEXT_GL_VERSION_3_2);
-    }();
 
-    return available;
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, bool x)
+{
+    setUniform(handle, static_cast<int>(x));
 }
 
 
 ////////////////////////////////////////////////////////////
-bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometryShaderCode, std::string_view fragmentShaderCode)
+void Shader::setUniform(UniformHandle handle, Glsl::Bvec2 v)
 {
-    const TransientContextLock lock;
+    setUniform(handle, Glsl::Ivec2(v));
+}
 
-    // First make sure that we can use shaders
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec3& v)
+{
+    setUniform(handle, Glsl::Ivec3(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Bvec4& v)
+{
+    setUniform(handle, Glsl::Ivec4(v));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Mat3& matrix)
+{
+    storeUniform(handle, UniformType::Mat3, matrix.array.data(), 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle handle, const Glsl::Mat4& matrix)
+{
+    storeUniform(handle, UniformType::Mat4, matrix.array.data(), 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const float* scalarArray, std::size_t length)
+{
+    storeUniform(handle, UniformType::Float, scalarArray, length);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Vec2* vectorArray, std::size_t length)
+{
+    const std::vector<float> contiguous = flatten(vectorArray, length);
+    storeUniform(handle, UniformType::Vec2, contiguous.data(), length);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Vec3* vectorArray, std::size_t length)
+{
+    const std::vector<float> contiguous = flatten(vectorArray, length);
+    storeUniform(handle, UniformType::Vec3, contiguous.data(), length);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Vec4* vectorArray, std::size_t length)
+{
+    const std::vector<float> contiguous = flatten(vectorArray, length);
+    storeUniform(handle, UniformType::Vec4, contiguous.data(), length);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Mat3* matrixArray, std::size_t length)
+{
+    static const std::size_t matrixSize = matrixArray[0].array.size();
+
+    std::vector<float> contiguous(matrixSize * length);
+    for (std::size_t i = 0; i < length; ++i)
+        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
+
+    storeUniform(handle, UniformType::Mat3, contiguous.data(), length);
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle handle, const Glsl::Mat4* matrixArray, std::size_t length)
+{
+    static const std::size_t matrixSize = matrixArray[0].array.size();
+
+    std::vector<float> contiguous(matrixSize * length);
+    for (std::size_t i = 0; i < length; ++i)
+        priv::copyMatrix(matrixArray[i].array.data(), matrixSize, &contiguous[matrixSize * i]);
+
+    storeUniform(handle, UniformType::Mat4, contiguous.data(), length);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int Shader::getNativeHandle() const
+{
+    return m_shaderProgram;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::bind(const Shader* shader)
+{
+    const TransientContextLock lock;
+
+    // Make sure that we can use shaders
     if (!isAvailable())
     {
-        err() << "Failed to create a shader: your system doesn't support shaders "
+        err() << "Failed to bind or unbind shader: your system doesn't support shaders "
               << "(you should test Shader::isAvailable() before trying to use the Shader class)" << std::endl;
-        return false;
+        return;
     }
 
-    // Make sure we can use geometry shaders
-    if (!geometryShaderCode.empty() && !isGeometryAvailable())
+    if (shader && shader->m_shaderProgram)
     {
-        err() << "Failed to create a shader: your system doesn't support geometry shaders "
-              << "(you should test Shader::isGeometryAvailable() before trying to use geometry shaders)" << std::endl;
-        return false;
+        // Enable the program
+        glCheck(GLEXT_glUseProgramObject(castToGlHandle(shader->m_shaderProgram)));
+
+        // Bind the textures
+        shader->bindTextures();
+
+        // Bind the current texture
+        if (shader->m_currentTexture != -1)
+            glCheck(GLEXT_glUniform1i(shader->m_currentTexture, 0));
+
+        // Bind the uniform buffers
+        for (const auto& [index, buffer] : shader->m_uniformBlocks)
+            glCheck(GLEXT_glBindBufferBase(GLEXT_GL_UNIFORM_BUFFER, index, buffer->getNativeHandle()));
+
+        // Upload the uniforms set since the shader was last bound
+        shader->uploadUniforms();
+    }
+    else
+    {
+        // Bind no shader
+        glCheck(GLEXT_glUseProgramObject({}));
     }
+}
 
-    // Create the program
-    const GLEXT_GLhandle shaderProgram = glCheck(GLEXT_glCreateProgramObject());
 
-    // Helper function for shader creation
-    const auto createAndAttachShader =
-        [shaderProgram](GLenum shaderType, const char* shaderTypeStr, std::string_view shaderCode)
+////////////////////////////////////////////////////////////
+bool Shader::isAvailable()
+{
+    static const bool available = []
     {
-        // Create and compile the shader
-        const GLEXT_GLhandle shader           = glCheck(GLEXT_glCreateShaderObject(shaderType));
-        const GLcharARB*     sourceCode       = shaderCode.data();
-        const auto           sourceCodeLength = static_cast<GLint>(shaderCode.length());
-        glCheck(GLEXT_glShaderSource(shader, 1, &sourceCode, &sourceCodeLength));
-        glCheck(GLEXT_glCompileShader(shader));
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_multitexture && GLEXT_shading_language_100 && GLEXT_shader_objects && GLEXT_vertex_shader &&
+               GLEXT_fragment_shader;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isGeometryAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
 
-        // Check the compile log
-        GLint success = 0;
-        glCheck(GLEXT_glGetObjectParameteriv(shader, GLEXT_GL_OBJECT_COMPILE_STATUS, &success));
-        if (success == GL_FALSE)
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return isAvailable() && (GLEXT_geometry_shader4 || GLEXT_GL_VERSION_3_2);
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t Shader::loadManyFromMemory(const MemorySources* sources, std::size_t count)
+{
+    const TransientContextLock lock;
+
+    ShaderImpl::enableParallelCompile();
+
+    // Submit all the programs first, so that the driver can work on them while the next ones are submitted
+    std::vector<ShaderImpl::PendingProgram> pending(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        assert(sources[i].shader && "Shader::loadManyFromMemory() Cannot load a null shader");
+
+        if (ShaderImpl::checkAvailability(sources[i].geometryShader))
+            pending[i] = ShaderImpl::startProgram(sources[i].vertexShader,
+                                                  sources[i].geometryShader,
+                                                  sources[i].fragmentShader);
+    }
+
+    // Then wait for each of them
+    std::size_t loaded = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if ((pending[i].program != GLEXT_GLhandle{}) && ShaderImpl::finishProgram(pending[i]))
         {
-            std::array<char, 1024> log{};
-            glCheck(GLEXT_glGetInfoLog(shader, static_cast<GLsizei>(log.size()), nullptr, log.data()));
-            err() << "Failed to compile " << shaderTypeStr << " shader:" << '\n' << log.data() << std::endl;
-            glCheck(GLEXT_glDeleteObject(shader));
-            glCheck(GLEXT_glDeleteObject(shaderProgram));
-            return false;
+            sources[i].shader->replaceProgram(castFromGlHandle(pending[i].program));
+            ++loaded;
         }
+    }
 
-        // Attach the shader to the program, and delete it (not needed anymore)
-        glCheck(GLEXT_glAttachObject(shaderProgram, shader));
-        glCheck(GLEXT_glDeleteObject(shader));
-        return true;
-    };
+    // Force an OpenGL flush, so that the shaders will appear updated
+    // in all contexts immediately (solves problems in multi-threaded apps)
+    glCheck(glFlush());
 
-    // Create the vertex shader if needed
-    if (!vertexShaderCode.empty())
-        if (!createAndAttachShader(GLEXT_GL_VERTEX_SHADER, "vertex", vertexShaderCode))
-            return false;
+    return loaded;
+}
 
-    // Create the geometry shader if needed
-    if (!geometryShaderCode.empty())
-        if (!createAndAttachShader(GLEXT_GL_GEOMETRY_SHADER, "geometry", geometryShaderCode))
-            return false;
 
-    // Create the fragment shader if needed
-    if (!fragmentShaderCode.empty())
-        if (!createAndAttachShader(GLEXT_GL_FRAGMENT_SHADER, "fragment", fragmentShaderCode))
-            return false;
+////////////////////////////////////////////////////////////
+void Shader::setProgramCacheDirectory(const std::filesystem::path& directory)
+{
+    priv::setProgramCacheDirectory(directory);
+}
 
-    // Link the program
-    glCheck(GLEXT_glLinkProgram(shaderProgram));
 
-    // Check the link log
-    GLint success = 0;
-    glCheck(GLEXT_glGetObjectParameteriv(shaderProgram, GLEXT_GL_OBJECT_LINK_STATUS, &success));
-    if (success == GL_FALSE)
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getProgramCacheDirectory()
+{
+    return priv::getProgramCacheDirectory();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isProgramCacheAvailable()
+{
+    static const bool available = []
     {
-        std::array<char, 1024> log{};
-        glCheck(GLEXT_glGetInfoLog(shaderProgram, static_cast<GLsizei>(log.size()), nullptr, log.data()));
-        err() << "Failed to link shader:" << '\n' << log.data() << std::endl;
-        glCheck(GLEXT_glDeleteObject(shaderProgram));
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        if (!isAvailable() || !GLEXT_get_program_binary)
+            return false;
+
+        // Some drivers expose the extension without supporting any binary format
+        GLint formats = 0;
+        glCheck(glGetIntegerv(GLEXT_GL_NUM_PROGRAM_BINARY_FORMATS, &formats));
+        return formats > 0;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometryShaderCode, std::string_view fragmentShaderCode)
+{
+    const TransientContextLock lock;
+
+    if (!ShaderImpl::checkAvailability(geometryShaderCode))
         return false;
-    }
 
+    ShaderImpl::PendingProgram pending = ShaderImpl::startProgram(vertexShaderCode,
+                                                                  geometryShaderCode,
+                                                                  fragmentShaderCode);
+    if (!ShaderImpl::finishProgram(pending))
+        return false;
+
+    replaceProgram(castFromGlHandle(pending.program));
+
+    // Force an OpenGL flush, so that the shader will appear updated
+    // in all contexts immediately (solves problems in multi-threaded apps)
+    glCheck(glFlush());
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::replaceProgram(unsigned int shaderProgram)
+{
     // Destroy the shader if it was already created
     if (m_shaderProgram)
     {
@@ -937,15 +1418,13 @@ bool Shader::compile(std::string_view vertexShaderCode, std::string_view geometr
     // Reset the internal state
     m_currentTexture = -1;
     m_textures.clear();
+    m_uniformBlocks.clear();
     m_uniforms.clear();
+    m_uniformValues.clear();
+    m_pendingUniforms.clear();
 
-    m_shaderProgram = castFromGlHandle(shaderProgram);
-
-    // Force an OpenGL flush, so that the shader will appear updated
-    // in all contexts immediately (solves problems in multi-threaded apps)
-    glCheck(glFlush());
-
-    return true;
+    m_shaderProgram = shaderProgram;
+    m_cacheId       = ShaderImpl::getUniqueId();
 }
 
 
@@ -968,23 +1447,62 @@ void Shader::bindTextures() const
 
 
 ////////////////////////////////////////////////////////////
-int Shader::getUniformLocation(const std::string& name)
+void Shader::uploadUniforms() const
 {
-    // Check the cache
-    if (const auto it = m_uniforms.find(name); it != m_uniforms.end())
+    for (const std::size_t index : m_pendingUniforms)
     {
-        // Already in cache, return it
-        return it->second;
+        Uniform&       uniform  = m_uniformValues[index];
+        const GLint    location = uniform.location;
+        const auto     count    = static_cast<GLsizei>(uniform.count);
+        const GLfloat* floats   = uniform.floats.data();
+        const GLint*   ints     = uniform.ints.data();
+
+        switch (uniform.type)
+        {
+            case UniformType::Float:
+                glCheck(GLEXT_glUniform1fv(location, count, floats));
+                break;
+            case UniformType::Vec2:
+                glCheck(GLEXT_glUniform2fv(location, count, floats));
+                break;
+            case UniformType::Vec3:
+                glCheck(GLEXT_glUniform3fv(location, count, floats));
+                break;
+            case UniformType::Vec4:
+                glCheck(GLEXT_glUniform4fv(location, count, floats));
+                break;
+            case UniformType::Int:
+                glCheck(GLEXT_glUniform1i(location, ints[0]));
+                break;
+            case UniformType::Ivec2:
+                glCheck(GLEXT_glUniform2i(location, ints[0], ints[1]));
+                break;
+            case UniformType::Ivec3:
+                glCheck(GLEXT_glUniform3i(location, ints[0], ints[1], ints[2]));
+                break;
+            case UniformType::Ivec4:
+                glCheck(GLEXT_glUniform4i(location, ints[0], ints[1], ints[2], ints[3]));
+                break;
+            case UniformType::Mat3:
+                glCheck(GLEXT_glUniformMatrix3fv(location, count, GL_FALSE, floats));
+                break;
+            case UniformType::Mat4:
+                glCheck(GLEXT_glUniformMatrix4fv(location, count, GL_FALSE, floats));
+                break;
+        }
+
+        uniform.pending = false;
     }
 
-    // Not in cache, request the location from OpenGL
-    const int location = GLEXT_glGetUniformLocation(castToGlHandle(m_shaderProgram), name.c_str());
-    m_uniforms.try_emplace(name, location);
+    m_pendingUniforms.clear();
+}
 
-    if (location == -1)
-        err() << "Uniform " << std::quoted(name) << " not found in shader" << std::endl;
 
-    return location;
+////////////////////////////////////////////////////////////
+int Shader::getUniformLocation(const std::string& name)
+{
+    const std::optional handle = getUniformHandle(name);
+    return handle ? m_uniformValues[handle->m_index].location : -1;
 }
 
 } // namespace sf
@@ -1277,6 +1795,139 @@ void Shader::setUniformArray(const std::string& /* name */, const Glsl::Mat4* /*
 }
 
 
+////////////////////////////////////////////////////////////
+std::optional<Shader::UniformHandle> Shader::getUniformHandle(const std::string& /* name */)
+{
+    return std::nullopt;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, float)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, Glsl::Vec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Vec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, int)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, Glsl::Ivec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Ivec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, bool)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, Glsl::Bvec2)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec3&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Bvec4&)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Mat3& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniform(UniformHandle /* handle */, const Glsl::Mat4& /* matrix */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformBlock(const std::string& /* name */, const UniformBuffer& /* buffer */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const float* /* scalarArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Vec2* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Vec3* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Vec4* /* vectorArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Mat3* /* matrixArray */, std::size_t /* length */)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setUniformArray(UniformHandle /* handle */, const Glsl::Mat4* /* matrixArray */, std::size_t /* length */)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int Shader::getNativeHandle() const
 {
@@ -1304,6 +1955,34 @@ bool Shader::isGeometryAvailable()
 }
 
 
+////////////////////////////////////////////////////////////
+std::size_t Shader::loadManyFromMemory(const MemorySources* /* sources */, std::size_t /* count */)
+{
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setProgramCacheDirectory(const std::filesystem::path& directory)
+{
+    priv::setProgramCacheDirectory(directory);
+}
+
+
+////////////////////////////////////////////////////////////
+std::filesystem::path Shader::getProgramCacheDirectory()
+{
+    return priv::getProgramCacheDirectory();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::isProgramCacheAvailable()
+{
+    return false;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Shader::compile(std::string_view /* vertexShaderCode */,
                      std::string_view /* geometryShaderCode */,
@@ -1313,11 +1992,23 @@ bool Shader::compile(std::string_view /* vertexShaderCode */,
 }
 
 
+////////////////////////////////////////////////////////////
+void Shader::replaceProgram(unsigned int /* shaderProgram */)
+{
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::bindTextures() const
 {
 }
 
+
+////////////////////////////////////////////////////////////
+void Shader::uploadUniforms() const
+{
+}
+
 } // namespace sf
 
 #endif // SFML_OPENGL_ES
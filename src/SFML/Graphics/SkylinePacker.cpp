@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/SkylinePacker.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+SkylinePacker::SkylinePacker(Vector2u size) : m_size(size)
+{
+    if (size.x > 0)
+        m_skyline.push_back({0, 0, size.x});
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Vector2u> SkylinePacker::insert(Vector2u size)
+{
+    if ((size.x == 0) || (size.y == 0))
+        return Vector2u();
+
+    // Find the segment where the top of the rectangle is the lowest
+    std::optional<std::size_t> bestIndex;
+    unsigned int               bestTop = 0;
+    unsigned int               bestY   = 0;
+
+    for (std::size_t i = 0; i < m_skyline.size(); ++i)
+    {
+        const std::optional<unsigned int> y = fit(i, size);
+
+        if (y && (!bestIndex || (*y + size.y < bestTop)))
+        {
+            bestIndex = i;
+            bestTop   = *y + size.y;
+            bestY     = *y;
+        }
+    }
+
+    if (!bestIndex)
+        return std::nullopt;
+
+    // Raise the skyline over the rectangle
+    const Vector2u position(m_skyline[*bestIndex].x, bestY);
+    m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(*bestIndex), {position.x, bestTop, size.x});
+
+    // Shrink or remove the segments that are now below the rectangle
+    const unsigned int right = position.x + size.x;
+    for (std::size_t i = *bestIndex + 1; i < m_skyline.size();)
+    {
+        Segment& segment = m_skyline[i];
+
+        if (segment.x >= right)
+            break;
+
+        const unsigned int covered = right - segment.x;
+        if (segment.width > covered)
+        {
+            segment.x += covered;
+            segment.width -= covered;
+            break;
+        }
+
+        m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+
+    merge();
+
+    m_usedSize.x = std::max(m_usedSize.x, right);
+    m_usedSize.y = std::max(m_usedSize.y, bestTop);
+
+    return position;
+}
+
+
+////////////////////////////////////////////////////////////
+void SkylinePacker::grow(Vector2u size)
+{
+    assert(size.x >= m_size.x && size.y >= m_size.y && "SkylinePacker::grow() cannot shrink the bin");
+
+    // The new columns are empty, the new rows don't need to be tracked
+    if (size.x > m_size.x)
+    {
+        m_skyline.push_back({m_size.x, 0, size.x - m_size.x});
+        merge();
+    }
+
+    m_size = size;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u SkylinePacker::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u SkylinePacker::getUsedSize() const
+{
+    return m_usedSize;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<unsigned int> SkylinePacker::fit(std::size_t index, Vector2u size) const
+{
+    if (m_skyline[index].x + size.x > m_size.x)
+        return std::nullopt;
+
+    // The rectangle rests on the highest segment it spans
+    unsigned int y         = 0;
+    unsigned int widthLeft = size.x;
+
+    for (std::size_t i = index; widthLeft > 0; ++i)
+    {
+        y = std::max(y, m_skyline[i].y);
+
+        if (y + size.y > m_size.y)
+            return std::nullopt;
+
+        widthLeft -= std::min(widthLeft, m_skyline[i].width);
+    }
+
+    return y;
+}
+
+
+////////////////////////////////////////////////////////////
+void SkylinePacker::merge()
+{
+    for (std::size_t i = 0; i + 1 < m_skyline.size();)
+    {
+        if (m_skyline[i].y == m_skyline[i + 1].y)
+        {
+            m_skyline[i].width += m_skyline[i + 1].width;
+            m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+} // namespace sf::priv
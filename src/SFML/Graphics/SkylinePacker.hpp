@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Packer placing rectangles into a 2D bin with the skyline algorithm
+///
+/// The top edge of the rectangles packed so far is tracked as a
+/// list of horizontal segments (the skyline). New rectangles are
+/// placed on top of it, at the position where their top edge is
+/// the lowest (bottom-left heuristic).
+///
+////////////////////////////////////////////////////////////
+class SkylinePacker
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the packer
+    ///
+    /// \param size Size of the bin
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit SkylinePacker(Vector2u size = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a place for a rectangle and reserve it
+    ///
+    /// Empty rectangles are always placed at (0, 0).
+    ///
+    /// \param size Size of the rectangle
+    ///
+    /// \return Position of the rectangle in the bin, or `std::nullopt` if it doesn't fit
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<Vector2u> insert(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Grow the bin
+    ///
+    /// The rectangles already placed keep their position.
+    ///
+    /// \param size New size of the bin, must not be smaller than the current one
+    ///
+    ////////////////////////////////////////////////////////////
+    void grow(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the bin
+    ///
+    /// \return Size of the bin
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the area covered by the placed rectangles
+    ///
+    /// \return Bottom-right corner of the bounding box of the placed rectangles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getUsedSize() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Horizontal segment of the skyline
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Segment
+    {
+        unsigned int x{};     //!< Left of the segment
+        unsigned int y{};     //!< Height of the skyline along the segment
+        unsigned int width{}; //!< Width of the segment
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find where a rectangle would be placed if its left edge started at a segment
+    ///
+    /// \param index Index of the segment
+    /// \param size  Size of the rectangle
+    ///
+    /// \return Top of the rectangle, or `std::nullopt` if it doesn't fit there
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<unsigned int> fit(std::size_t index, Vector2u size) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Merge adjacent segments of the same height
+    ///
+    ////////////////////////////////////////////////////////////
+    void merge();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Segment> m_skyline;  //!< Segments of the skyline, from left to right
+    Vector2u             m_size;     //!< Size of the bin
+    Vector2u             m_usedSize; //!< Size of the area covered by the placed rectangles
+};
+
+} // namespace sf::priv
@@ -0,0 +1,343 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/SpatialGrid.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <algorithm>
+
+#include <cassert>
+#include <cmath>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace SpatialGridImpl
+{
+// Cell coordinates are clamped, so that huge bounds can't overflow them
+constexpr float maxCell = 1 << 30;
+
+// Convert a cell coordinate to an integer, clamping it
+int toCell(float cell)
+{
+    if (std::isnan(cell))
+        return 0;
+
+    return static_cast<int>(std::clamp(cell, -maxCell, maxCell));
+}
+
+// Get the cell containing the start of a range along one axis
+int getFirstCell(float coordinate, float cellSize)
+{
+    return toCell(std::floor(coordinate / cellSize));
+}
+
+// Get the last cell covered by a range along one axis; ranges are half-open, so
+// a range ending exactly on the border of a cell doesn't cover the next one
+int getLastCell(float coordinate, float cellSize)
+{
+    return toCell(std::ceil(coordinate / cellSize) - 1.f);
+}
+
+// Make the size of a rectangle positive, keeping the area it covers
+sf::FloatRect normalize(const sf::FloatRect& rectangle)
+{
+    const sf::Vector2f end = rectangle.position + rectangle.size;
+    const sf::Vector2f min(std::min(rectangle.position.x, end.x), std::min(rectangle.position.y, end.y));
+    const sf::Vector2f max(std::max(rectangle.position.x, end.x), std::max(rectangle.position.y, end.y));
+    return {min, max - min};
+}
+
+// Objects covering more cells than this are kept aside and tested by every query,
+// so that a huge object doesn't have to be registered in millions of cells
+constexpr std::uint64_t maxObjectCells = 64;
+
+// Get the number of cells in a range
+std::uint64_t getCellCount(sf::Vector2i first, sf::Vector2i last)
+{
+    const auto columns = static_cast<std::uint64_t>(std::int64_t{last.x} - first.x + 1);
+    const auto rows    = static_cast<std::uint64_t>(std::int64_t{last.y} - first.y + 1);
+    return columns * rows;
+}
+
+// Pack the coordinates of a cell into its key in the cell table
+std::uint64_t getKey(int x, int y)
+{
+    return (std::uint64_t{static_cast<std::uint32_t>(x)} << 32) | std::uint64_t{static_cast<std::uint32_t>(y)};
+}
+
+// Tell whether two normalized rectangles overlap
+bool overlap(const sf::FloatRect& a, const sf::FloatRect& b)
+{
+    return (a.position.x < b.position.x + b.size.x) && (b.position.x < a.position.x + a.size.x) &&
+           (a.position.y < b.position.y + b.size.y) && (b.position.y < a.position.y + a.size.y);
+}
+} // namespace SpatialGridImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SpatialGrid::SpatialGrid(Vector2f cellSize) : m_cellSize(cellSize)
+{
+    assert(cellSize.x > 0.f && cellSize.y > 0.f && "SpatialGrid::SpatialGrid() Cell size must be positive");
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialGrid::insert(const FloatRect& bounds)
+{
+    // Reuse the identifier of a removed object if possible
+    std::size_t id = m_objects.size();
+    if (m_freeIds.empty())
+    {
+        m_objects.emplace_back();
+    }
+    else
+    {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+    }
+
+    Object& object = m_objects[id];
+    object.bounds  = SpatialGridImpl::normalize(bounds);
+    object.cells   = getCells(object.bounds);
+    object.used    = true;
+    link(id, object.cells);
+
+    ++m_objectCount;
+    return id;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::update(std::size_t id, const FloatRect& bounds)
+{
+    assert(contains(id) && "SpatialGrid::update() Object is not in the grid");
+
+    Object& object = m_objects[id];
+    object.bounds  = SpatialGridImpl::normalize(bounds);
+
+    // Objects moving within their cells don't touch the cell table
+    const CellRange cells = getCells(object.bounds);
+    if (cells == object.cells)
+        return;
+
+    unlink(id, object.cells);
+    link(id, cells);
+    object.cells = cells;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::remove(std::size_t id)
+{
+    assert(contains(id) && "SpatialGrid::remove() Object is not in the grid");
+
+    Object& object = m_objects[id];
+    unlink(id, object.cells);
+    object.used = false;
+
+    m_freeIds.push_back(id);
+    --m_objectCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::clear()
+{
+    m_objects.clear();
+    m_freeIds.clear();
+    m_cells.clear();
+    m_largeIds.clear();
+    m_objectCount = 0;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SpatialGrid::contains(std::size_t id) const
+{
+    return (id < m_objects.size()) && m_objects[id].used;
+}
+
+
+////////////////////////////////////////////////////////////
+const FloatRect& SpatialGrid::getBounds(std::size_t id) const
+{
+    assert(contains(id) && "SpatialGrid::getBounds() Object is not in the grid");
+
+    return m_objects[id].bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialGrid::getObjectCount() const
+{
+    return m_objectCount;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f SpatialGrid::getCellSize() const
+{
+    return m_cellSize;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::query(const FloatRect& area, std::vector<std::size_t>& ids) const
+{
+    if (m_objectCount == 0)
+        return;
+
+    const FloatRect bounds = SpatialGridImpl::normalize(area);
+    const CellRange range  = getCells(bounds);
+
+    // An object spanning several cells is only reported by the first of its cells within the range
+    const auto visitCell = [&](Vector2i cell, const std::vector<std::size_t>& cellIds)
+    {
+        for (const std::size_t id : cellIds)
+        {
+            const Object&  object = m_objects[id];
+            const Vector2i reportingCell(std::max(object.cells.first.x, range.first.x),
+                                         std::max(object.cells.first.y, range.first.y));
+            if ((reportingCell == cell) && SpatialGridImpl::overlap(object.bounds, bounds))
+                ids.push_back(id);
+        }
+    };
+
+    for (const std::size_t id : m_largeIds)
+    {
+        if (SpatialGridImpl::overlap(m_objects[id].bounds, bounds))
+            ids.push_back(id);
+    }
+
+    // A zoomed out view can cover far more cells than there are non-empty ones, visit the smallest set
+    if (SpatialGridImpl::getCellCount(range.first, range.last) > m_cells.size())
+    {
+        for (const auto& [key, cellIds] : m_cells)
+        {
+            const Vector2i cell(static_cast<int>(static_cast<std::uint32_t>(key >> 32)),
+                                static_cast<int>(static_cast<std::uint32_t>(key)));
+            if ((cell.x >= range.first.x) && (cell.x <= range.last.x) && (cell.y >= range.first.y) &&
+                (cell.y <= range.last.y))
+                visitCell(cell, cellIds);
+        }
+    }
+    else
+    {
+        for (int y = range.first.y; y <= range.last.y; ++y)
+        {
+            for (int x = range.first.x; x <= range.last.x; ++x)
+            {
+                if (const auto it = m_cells.find(SpatialGridImpl::getKey(x, y)); it != m_cells.end())
+                    visitCell({x, y}, it->second);
+            }
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::query(const View& view, std::vector<std::size_t>& ids) const
+{
+    // The inverse transform of the view maps the normalized device coordinates back to the world
+    query(view.getInverseTransform().transformRect(FloatRect({-1.f, -1.f}, {2.f, 2.f})), ids);
+}
+
+
+////////////////////////////////////////////////////////////
+SpatialGrid::CellRange SpatialGrid::getCells(const FloatRect& rectangle) const
+{
+    using SpatialGridImpl::getFirstCell;
+    using SpatialGridImpl::getLastCell;
+
+    // Empty rectangles still belong to the cell they start in
+    const Vector2f start = rectangle.position;
+    const Vector2f end   = rectangle.position + rectangle.size;
+    const Vector2i first(getFirstCell(start.x, m_cellSize.x), getFirstCell(start.y, m_cellSize.y));
+    const Vector2i last(getLastCell(end.x, m_cellSize.x), getLastCell(end.y, m_cellSize.y));
+    return {first, {std::max(first.x, last.x), std::max(first.y, last.y)}};
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::link(std::size_t id, const CellRange& cells)
+{
+    if (SpatialGridImpl::getCellCount(cells.first, cells.last) > SpatialGridImpl::maxObjectCells)
+    {
+        m_largeIds.push_back(id);
+        return;
+    }
+
+    for (int y = cells.first.y; y <= cells.last.y; ++y)
+        for (int x = cells.first.x; x <= cells.last.x; ++x)
+            m_cells[SpatialGridImpl::getKey(x, y)].push_back(id);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::unlink(std::size_t id, const CellRange& cells)
+{
+    // The order of the objects doesn't matter, they are removed by swapping them with the last one
+    const auto removeId = [id](std::vector<std::size_t>& objectIds)
+    {
+        if (const auto it = std::find(objectIds.begin(), objectIds.end(), id); it != objectIds.end())
+        {
+            *it = objectIds.back();
+            objectIds.pop_back();
+        }
+    };
+
+    if (SpatialGridImpl::getCellCount(cells.first, cells.last) > SpatialGridImpl::maxObjectCells)
+    {
+        removeId(m_largeIds);
+        return;
+    }
+
+    for (int y = cells.first.y; y <= cells.last.y; ++y)
+    {
+        for (int x = cells.first.x; x <= cells.last.x; ++x)
+        {
+            const auto it = m_cells.find(SpatialGridImpl::getKey(x, y));
+            if (it == m_cells.end())
+                continue;
+
+            removeId(it->second);
+
+            // Empty cells are dropped, so that the table only holds the occupied ones
+            if (it->second.empty())
+                m_cells.erase(it);
+        }
+    }
+}
+
+} // namespace sf
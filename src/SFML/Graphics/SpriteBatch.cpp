@@ -0,0 +1,575 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+#include <SFML/Window/GlResource.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <utility>
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace SpriteBatchImpl
+{
+// Corners of the unit quad expanded by the vertex shader, in triangle strip order
+constexpr std::array<float, 8> quadCorners = {0.f, 0.f, 0.f, 1.f, 1.f, 0.f, 1.f, 1.f};
+
+// Number of floats stored for the transform of each instance
+constexpr std::size_t transformSize = 6;
+
+// Vertex shader reading the per-instance arrays, it mirrors the geometry built by sf::Sprite
+constexpr const char* vertexShaderSource = R"(
+#version 110
+
+attribute vec3 sf_instanceTransformRow0;
+attribute vec3 sf_instanceTransformRow1;
+attribute vec4 sf_instanceTextureRect;
+attribute vec4 sf_instanceColor;
+
+void main()
+{
+    vec2 corner    = gl_Vertex.xy;
+    vec3 point     = vec3(corner * abs(sf_instanceTextureRect.zw), 1.0);
+    vec2 position  = vec2(dot(sf_instanceTransformRow0, point), dot(sf_instanceTransformRow1, point));
+    vec2 texCoords = sf_instanceTextureRect.xy + corner * sf_instanceTextureRect.zw;
+
+    gl_Position    = gl_ModelViewProjectionMatrix * vec4(position, 0.0, 1.0);
+    gl_TexCoord[0] = gl_TextureMatrix[0] * vec4(texCoords, 0.0, 1.0);
+    gl_FrontColor  = sf_instanceColor;
+}
+)";
+
+constexpr const char* fragmentShaderSource = R"(
+#version 110
+
+uniform sampler2D sf_texture;
+
+void main()
+{
+    gl_FragColor = gl_Color * texture2D(sf_texture, gl_TexCoord[0].xy);
+}
+)";
+
+// Names of the per-instance attributes, in the order they are stored in the instance buffer
+constexpr std::array<const char*, 4> attributeNames = {"sf_instanceTransformRow0",
+                                                       "sf_instanceTransformRow1",
+                                                       "sf_instanceTextureRect",
+                                                       "sf_instanceColor"};
+
+GLint getAttributeLocation(const sf::Shader& shader, const char* name)
+{
+#if !defined(SFML_OPENGL_ES) && (defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS))
+    const auto program = reinterpret_cast<GLEXT_GLhandle>(std::ptrdiff_t{shader.getNativeHandle()});
+#else
+    const auto program = shader.getNativeHandle();
+#endif
+
+    return glCheck(GLEXT_glGetAttribLocation(program, name));
+}
+
+void setInstanceAttribute(GLint       location,
+                          GLint       size,
+                          GLenum      type,
+                          GLboolean   normalized,
+                          std::size_t stride,
+                          std::size_t offset)
+{
+    const auto index = static_cast<GLuint>(location);
+
+    glCheck(GLEXT_glEnableVertexAttribArray(index));
+    glCheck(GLEXT_glVertexAttribPointer(index,
+                                        size,
+                                        type,
+                                        normalized,
+                                        static_cast<GLsizei>(stride),
+                                        reinterpret_cast<const void*>(offset)));
+    glCheck(GLEXT_glVertexAttribDivisor(index, 1));
+}
+
+// Built-in shader expanding the instances, it is the same for all the sprite batches
+struct Program : private sf::GlResource
+{
+    Program()
+    {
+        if (shader.loadFromMemory(vertexShaderSource, fragmentShaderSource))
+        {
+            const TransientContextLock contextLock;
+
+            shader.setUniform("sf_texture", sf::Shader::CurrentTexture);
+
+            valid = true;
+            for (std::size_t i = 0; i < attributes.size(); ++i)
+            {
+                attributes[i] = getAttributeLocation(shader, attributeNames[i]);
+                valid         = valid && (attributes[i] != -1);
+            }
+        }
+
+        if (!valid)
+            sf::err() << "Failed to set up instanced drawing of sprite batches, falling back to CPU geometry"
+                      << std::endl;
+    }
+
+    sf::Shader           shader;       //!< Shader program expanding the instances
+    std::array<GLint, 4> attributes{}; //!< Locations of the per-instance attributes
+    bool                 valid{};      //!< Was the shader successfully set up?
+};
+
+// Get the program shared by the sprite batches, it is compiled once and released with the
+// last batch that uses it; OpenGL programs are shared between all the contexts of SFML
+std::shared_ptr<const Program> getProgram()
+{
+    static std::mutex              mutex;
+    static std::weak_ptr<Program>  sharedProgram;
+    const std::lock_guard          lock(mutex);
+    std::shared_ptr<const Program> program = sharedProgram.lock();
+
+    if (!program)
+    {
+        auto newProgram = std::make_shared<Program>();
+        sharedProgram   = newProgram;
+        program         = std::move(newProgram);
+    }
+
+    return program;
+}
+} // namespace SpriteBatchImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct SpriteBatch::Instancing : private GlResource
+{
+    Instancing() : program(SpriteBatchImpl::getProgram())
+    {
+    }
+
+    ~Instancing()
+    {
+        if (buffer)
+        {
+            const TransientContextLock contextLock;
+
+            glCheck(GLEXT_glDeleteBuffers(1, &buffer));
+        }
+    }
+
+    Instancing(const Instancing&)            = delete;
+    Instancing& operator=(const Instancing&) = delete;
+
+    static bool isAvailable()
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_instanced_arrays != 0;
+    }
+
+    std::shared_ptr<const SpriteBatchImpl::Program> program;  //!< Shader program shared by all the batches
+    unsigned int                                    buffer{}; //!< OpenGL buffer of the quad corners and instance arrays
+};
+
+
+////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch(const Texture& texture) : m_texture(&texture)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SpriteBatch::~SpriteBatch() = default;
+
+
+////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch(const SpriteBatch& copy) :
+Drawable(copy),
+Transformable(copy),
+m_texture(copy.m_texture),
+m_transforms(copy.m_transforms),
+m_textureRects(copy.m_textureRects),
+m_colors(copy.m_colors),
+m_verticesNeedUpdate(true),
+m_needUpload(true)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SpriteBatch& SpriteBatch::operator=(const SpriteBatch& right)
+{
+    SpriteBatch temp(right);
+    *this = std::move(temp);
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch(SpriteBatch&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+SpriteBatch& SpriteBatch::operator=(SpriteBatch&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setTexture(const Texture& texture)
+{
+    m_texture = &texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& SpriteBatch::getTexture() const
+{
+    return *m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::addInstance(const Transform& transform, const IntRect& textureRect, Color color)
+{
+    const float* matrix = transform.getMatrix();
+    m_transforms.insert(m_transforms.end(), {matrix[0], matrix[4], matrix[12], matrix[1], matrix[5], matrix[13]});
+    m_textureRects.push_back(textureRect);
+    m_colors.push_back(color);
+
+    invalidate();
+    return m_colors.size() - 1;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::addInstance(const Sprite& sprite)
+{
+    return addInstance(sprite.getTransform(), sprite.getTextureRect(), sprite.getColor());
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::removeInstance(std::size_t index)
+{
+    assert(index < m_colors.size() && "Index is out of bounds");
+
+    const std::size_t last = m_colors.size() - 1;
+    if (index != last)
+    {
+        std::copy_n(m_transforms.begin() + static_cast<std::ptrdiff_t>(last * SpriteBatchImpl::transformSize),
+                    SpriteBatchImpl::transformSize,
+                    m_transforms.begin() + static_cast<std::ptrdiff_t>(index * SpriteBatchImpl::transformSize));
+        m_textureRects[index] = m_textureRects[last];
+        m_colors[index]       = m_colors[last];
+    }
+
+    m_transforms.resize(last * SpriteBatchImpl::transformSize);
+    m_textureRects.pop_back();
+    m_colors.pop_back();
+
+    invalidate();
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::clear()
+{
+    m_transforms.clear();
+    m_textureRects.clear();
+    m_colors.clear();
+
+    invalidate();
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::reserve(std::size_t instanceCount)
+{
+    m_transforms.reserve(instanceCount * SpriteBatchImpl::transformSize);
+    m_textureRects.reserve(instanceCount);
+    m_colors.reserve(instanceCount);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::getInstanceCount() const
+{
+    return m_colors.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setInstanceTransform(std::size_t index, const Transform& transform)
+{
+    assert(index < m_colors.size() && "Index is out of bounds");
+
+    const float* matrix      = transform.getMatrix();
+    float*       destination = m_transforms.data() + index * SpriteBatchImpl::transformSize;
+    destination[0]           = matrix[0];
+    destination[1]           = matrix[4];
+    destination[2]           = matrix[12];
+    destination[3]           = matrix[1];
+    destination[4]           = matrix[5];
+    destination[5]           = matrix[13];
+
+    invalidate();
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setInstanceTextureRect(std::size_t index, const IntRect& textureRect)
+{
+    assert(index < m_colors.size() && "Index is out of bounds");
+
+    m_textureRects[index] = textureRect;
+    invalidate();
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setInstanceColor(std::size_t index, Color color)
+{
+    assert(index < m_colors.size() && "Index is out of bounds");
+
+    m_colors[index] = color;
+    invalidate();
+}
+
+
+////////////////////////////////////////////////////////////
+Transform SpriteBatch::getInstanceTransform(std::size_t index) const
+{
+    assert(index < m_colors.size() && "Index is out of bounds");
+
+    const float* source = m_transforms.data() + index * SpriteBatchImpl::transformSize;
+    return {source[0], source[1], source[2], source[3], source[4], source[5], 0.f, 0.f, 1.f};
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& SpriteBatch::getInstanceTextureRect(std::size_t index) const
+{
+    assert(index < m_colors.size() && "Index is out of bounds");
+
+    return m_textureRects[index];
+}
+
+
+////////////////////////////////////////////////////////////
+Color SpriteBatch::getInstanceColor(std::size_t index) const
+{
+    assert(index < m_colors.size() && "Index is out of bounds");
+
+    return m_colors[index];
+}
+
+
+////////////////////////////////////////////////////////////
+bool SpriteBatch::isInstancingAvailable()
+{
+    static const bool available = Shader::isAvailable() && VertexBuffer::isAvailable() && Instancing::isAvailable();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::draw(RenderTarget& target, RenderStates states) const
+{
+    if (m_colors.empty())
+        return;
+
+    states.transform *= getTransform();
+    states.texture        = m_texture;
+    states.coordinateType = CoordinateType::Pixels;
+
+    // A custom shader doesn't know about the instance attributes,
+    // in this case the instances are expanded on the CPU instead
+    if (!states.shader && isInstancingAvailable())
+    {
+        if (!m_instancing)
+        {
+            m_instancing = std::make_unique<Instancing>();
+            m_needUpload = true;
+        }
+
+        if (m_instancing->program->valid)
+        {
+            states.shader = &m_instancing->program->shader;
+            target.drawInstances(*this, states);
+            return;
+        }
+    }
+
+    if (m_verticesNeedUpdate)
+        updateVertices();
+
+    target.draw(m_vertices.data(), m_vertices.size(), PrimitiveType::Triangles, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setupInstanceArrays() const
+{
+    assert(m_instancing && m_instancing->program->valid && "Instancing must be set up before drawing instances");
+
+    // Layout of the buffer: quad corners, then one tightly packed array per instance attribute
+    const std::size_t transformsOffset   = sizeof(SpriteBatchImpl::quadCorners);
+    const std::size_t textureRectsOffset = transformsOffset + sizeof(float) * m_transforms.size();
+    const std::size_t colorsOffset       = textureRectsOffset + sizeof(IntRect) * m_textureRects.size();
+    const std::size_t size               = colorsOffset + sizeof(Color) * m_colors.size();
+
+    if (!m_instancing->buffer)
+    {
+        glCheck(GLEXT_glGenBuffers(1, &m_instancing->buffer));
+        m_needUpload = true;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_instancing->buffer));
+
+    if (m_needUpload)
+    {
+        // Allocating new storage every time lets the driver keep the previous one alive for pending draws
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(size),
+                                   nullptr,
+                                   GLEXT_GL_DYNAMIC_DRAW));
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      0,
+                                      static_cast<GLsizeiptrARB>(transformsOffset),
+                                      SpriteBatchImpl::quadCorners.data()));
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      static_cast<GLintptrARB>(transformsOffset),
+                                      static_cast<GLsizeiptrARB>(textureRectsOffset - transformsOffset),
+                                      m_transforms.data()));
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      static_cast<GLintptrARB>(textureRectsOffset),
+                                      static_cast<GLsizeiptrARB>(colorsOffset - textureRectsOffset),
+                                      m_textureRects.data()));
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      static_cast<GLintptrARB>(colorsOffset),
+                                      static_cast<GLsizeiptrARB>(size - colorsOffset),
+                                      m_colors.data()));
+
+        m_needUpload = false;
+    }
+
+    // The fixed function arrays all read the quad corners, only the position is used by the shader
+    glCheck(glVertexPointer(2, GL_FLOAT, 0, nullptr));
+    glCheck(glColorPointer(4, GL_UNSIGNED_BYTE, 0, nullptr));
+    glCheck(glTexCoordPointer(2, GL_FLOAT, 0, nullptr));
+
+    const std::array<GLint, 4>& attributes = m_instancing->program->attributes;
+    const std::size_t           stride     = sizeof(float) * SpriteBatchImpl::transformSize;
+    const std::size_t           row1Offset = transformsOffset + sizeof(float) * 3;
+    SpriteBatchImpl::setInstanceAttribute(attributes[0], 3, GL_FLOAT, GL_FALSE, stride, transformsOffset);
+    SpriteBatchImpl::setInstanceAttribute(attributes[1], 3, GL_FLOAT, GL_FALSE, stride, row1Offset);
+    SpriteBatchImpl::setInstanceAttribute(attributes[2], 4, GL_INT, GL_FALSE, sizeof(IntRect), textureRectsOffset);
+    SpriteBatchImpl::setInstanceAttribute(attributes[3], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Color), colorsOffset);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::cleanupInstanceArrays() const
+{
+    for (const GLint location : m_instancing->program->attributes)
+    {
+        glCheck(GLEXT_glVertexAttribDivisor(static_cast<GLuint>(location), 0));
+        glCheck(GLEXT_glDisableVertexAttribArray(static_cast<GLuint>(location)));
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::updateVertices() const
+{
+    m_vertices.resize(m_colors.size() * 6);
+
+    for (std::size_t i = 0; i < m_colors.size(); ++i)
+    {
+        const float* matrix         = m_transforms.data() + i * SpriteBatchImpl::transformSize;
+        const auto   transformPoint = [matrix](Vector2f point) -> Vector2f
+        {
+            return {matrix[0] * point.x + matrix[1] * point.y + matrix[2],
+                    matrix[3] * point.x + matrix[4] * point.y + matrix[5]};
+        };
+        const auto [position, size] = FloatRect(m_textureRects[i]);
+        const Color color           = m_colors[i];
+
+        // Absolute value is used to support negative texture rect sizes
+        const Vector2f absSize(std::abs(size.x), std::abs(size.y));
+
+        const Vertex topLeft{transformPoint({0.f, 0.f}), color, position};
+        const Vertex bottomLeft{transformPoint({0.f, absSize.y}), color, position + Vector2f(0.f, size.y)};
+        const Vertex topRight{transformPoint({absSize.x, 0.f}), color, position + Vector2f(size.x, 0.f)};
+        const Vertex bottomRight{transformPoint(absSize), color, position + size};
+
+        Vertex* vertices = m_vertices.data() + i * 6;
+        vertices[0]      = topLeft;
+        vertices[1]      = bottomLeft;
+        vertices[2]      = topRight;
+        vertices[3]      = topRight;
+        vertices[4]      = bottomLeft;
+        vertices[5]      = bottomRight;
+    }
+
+    m_verticesNeedUpdate = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::invalidate()
+{
+    m_verticesNeedUpdate = true;
+    m_needUpload         = true;
+}
+
+} // namespace sf
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/StreamBuffer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <ostream>
+
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace StreamBufferImpl
+{
+// Smallest storage allocated for a stream buffer, in bytes
+constexpr std::size_t minimumCapacity = 1024 * 1024;
+
+// Alignment of the written data, in bytes
+constexpr std::size_t alignment = 16;
+} // namespace StreamBufferImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+StreamBuffer::StreamBuffer(unsigned int target) : m_target(target)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+StreamBuffer::~StreamBuffer()
+{
+    if (m_buffer)
+    {
+        const TransientContextLock contextLock;
+
+        glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> StreamBuffer::write(const void* data, std::size_t size)
+{
+    const std::optional<std::size_t> offset = allocate(size);
+    if (!offset)
+        return std::nullopt;
+
+    bool written = false;
+
+    if (void* const destination = map(*offset, size))
+    {
+        std::memcpy(destination, data, size);
+
+        // Unmapping fails if the storage got corrupted, in which case we upload it again below
+        written = unmap();
+    }
+
+    if (!written)
+    {
+        glCheck(GLEXT_glBufferSubData(m_target,
+                                      static_cast<GLintptrARB>(*offset),
+                                      static_cast<GLsizeiptrARB>(size),
+                                      data));
+    }
+
+    return offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> StreamBuffer::allocate(std::size_t size)
+{
+    if (!m_buffer)
+        glCheck(GLEXT_glGenBuffers(1, &m_buffer));
+
+    if (!m_buffer)
+    {
+        err() << "Could not create stream buffer, generation failed" << std::endl;
+        return std::nullopt;
+    }
+
+    glCheck(GLEXT_glBindBuffer(m_target, m_buffer));
+
+    std::size_t offset = (m_offset + StreamBufferImpl::alignment - 1) / StreamBufferImpl::alignment *
+                         StreamBufferImpl::alignment;
+
+    if (size > m_capacity)
+    {
+        // Grow the storage so that it can hold several writes of this size
+        m_capacity = std::max({StreamBufferImpl::minimumCapacity, m_capacity * 2, size * 4});
+        glCheck(GLEXT_glBufferData(m_target, static_cast<GLsizeiptrARB>(m_capacity), nullptr, GLEXT_GL_STREAM_DRAW));
+        offset = 0;
+    }
+    else if (offset + size > m_capacity)
+    {
+        // Orphan the storage: the driver hands us a fresh one while
+        // the GPU keeps reading from the old one until it's done with it
+        glCheck(GLEXT_glBufferData(m_target, static_cast<GLsizeiptrARB>(m_capacity), nullptr, GLEXT_GL_STREAM_DRAW));
+        offset = 0;
+    }
+
+    m_offset = offset + size;
+
+    return offset;
+}
+
+
+////////////////////////////////////////////////////////////
+void* StreamBuffer::map(std::size_t offset, std::size_t size)
+{
+    if (!GLEXT_map_buffer_range || (size == 0))
+        return nullptr;
+
+    // The reserved range is never in use by the GPU, so there is no need to synchronize
+    return glCheck(GLEXT_glMapBufferRange(m_target,
+                                          static_cast<GLintptr>(offset),
+                                          static_cast<GLsizeiptr>(size),
+                                          GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT |
+                                              GLEXT_GL_MAP_UNSYNCHRONIZED_BIT));
+}
+
+
+////////////////////////////////////////////////////////////
+bool StreamBuffer::unmap()
+{
+    return glCheck(GLEXT_glUnmapBuffer(m_target)) == GL_TRUE;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int StreamBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+} // namespace sf::priv
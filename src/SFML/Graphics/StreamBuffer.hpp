@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Window/GlResource.hpp>
+
+#include <optional>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Ring-buffered OpenGL buffer object for streaming data every frame
+///
+////////////////////////////////////////////////////////////
+class StreamBuffer : private GlResource
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the stream buffer
+    ///
+    /// The buffer object is only created on the first write.
+    ///
+    /// \param target OpenGL binding point of the buffer (e.g. `GL_ARRAY_BUFFER`)
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit StreamBuffer(unsigned int target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~StreamBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamBuffer(const StreamBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append data to the buffer
+    ///
+    /// The data is written right after the previously written
+    /// data, without waiting for the GPU to finish reading it.
+    /// When the end of the buffer is reached, its storage is
+    /// orphaned and writing starts over at the beginning of
+    /// a fresh storage provided by the driver.
+    ///
+    /// The buffer is left bound to its target when the function
+    /// returns, so that the written data can be used right away.
+    ///
+    /// \param data Pointer to the data to write
+    /// \param size Size of the data, in bytes
+    ///
+    /// \return Offset of the written data in the buffer, or `std::nullopt` on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> write(const void* data, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reserve space for data at the end of the buffer
+    ///
+    /// Works like `write`, except that the data is not written:
+    /// fill the reserved range with `map` and `unmap` instead.
+    ///
+    /// The buffer is left bound to its target when the function
+    /// returns.
+    ///
+    /// \param size Size of the data, in bytes
+    ///
+    /// \return Offset of the reserved range in the buffer, or `std::nullopt` on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::optional<std::size_t> allocate(std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Map a reserved range of the buffer for writing
+    ///
+    /// The buffer must be bound to its target. The range is
+    /// never in use by the GPU, so mapping it doesn't wait.
+    ///
+    /// \param offset Offset of the range returned by `allocate`
+    /// \param size   Size of the range, in bytes
+    ///
+    /// \return Pointer to the mapped range, or a null pointer if
+    ///         the buffer can't be mapped
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] void* map(std::size_t offset, std::size_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unmap the mapped range of the buffer
+    ///
+    /// The buffer must be bound to its target.
+    ///
+    /// \return `true` if the written data is valid, `false` if
+    ///         the storage got corrupted while it was mapped
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool unmap();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the buffer
+    ///
+    /// \return OpenGL handle of the buffer or 0 if not yet created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    unsigned int m_target;     //!< OpenGL binding point of the buffer
+    unsigned int m_buffer{};   //!< Internal buffer identifier
+    std::size_t  m_capacity{}; //!< Size of the buffer storage, in bytes
+    std::size_t  m_offset{};   //!< Offset at which the next write starts, in bytes
+};
+
+} // namespace sf::priv
@@ -27,7 +27,9 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/TextGeometry.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include <algorithm>
@@ -40,44 +42,64 @@
 
 namespace
 {
-// Add an underline or strikethrough line to the vertex array
-void addLine(sf::VertexArray& vertices,
-             float            lineLength,
-             float            lineTop,
-             sf::Color        color,
-             float            offset,
-             float            thickness,
-             float            outlineThickness = 0)
-{
-    const float top    = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
-    const float bottom = top + std::floor(thickness + 0.5f);
-
-    vertices.append({{-outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
-    vertices.append({{lineLength + outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
-    vertices.append({{-outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
-    vertices.append({{-outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
-    vertices.append({{lineLength + outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
-    vertices.append({{lineLength + outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
-}
-
-// Add a glyph quad to the vertex array
-void addGlyphQuad(sf::VertexArray& vertices, sf::Vector2f position, sf::Color color, const sf::Glyph& glyph, float italicShear)
+// Glyphs of a text: either the rasterized glyphs of its character size, or the
+// distance field glyphs of its font scaled to the character size, which are only
+// used when the shader rendering them is available
+class GlyphSource
 {
-    const sf::Vector2f padding(1.f, 1.f);
+public:
+    GlyphSource(const sf::Font& font, unsigned int characterSize, bool bold, bool distanceField) :
+    m_font(font),
+    m_characterSize(characterSize),
+    m_bold(bold),
+    m_distanceField(distanceField),
+    m_scale(static_cast<float>(characterSize) / static_cast<float>(sf::Font::DistanceFieldCharacterSize))
+    {
+    }
 
-    const sf::Vector2f p1 = glyph.bounds.position - padding;
-    const sf::Vector2f p2 = glyph.bounds.position + glyph.bounds.size + padding;
+    [[nodiscard]] bool isDistanceField() const
+    {
+        return m_distanceField;
+    }
 
-    const auto uv1 = sf::Vector2f(glyph.textureRect.position) - padding;
-    const auto uv2 = sf::Vector2f(glyph.textureRect.position + glyph.textureRect.size) + padding;
+    // Scale from the distance field glyphs to the character size
+    [[nodiscard]] float getScale() const
+    {
+        return m_scale;
+    }
 
-    vertices.append({position + sf::Vector2f(p1.x - italicShear * p1.y, p1.y), color, {uv1.x, uv1.y}});
-    vertices.append({position + sf::Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
-    vertices.append({position + sf::Vector2f(p1.x - italicShear * p2.y, p2.y), color, {uv1.x, uv2.y}});
-    vertices.append({position + sf::Vector2f(p1.x - italicShear * p2.y, p2.y), color, {uv1.x, uv2.y}});
-    vertices.append({position + sf::Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
-    vertices.append({position + sf::Vector2f(p2.x - italicShear * p2.y, p2.y), color, {uv2.x, uv2.y}});
-}
+    [[nodiscard]] sf::Glyph getGlyph(char32_t codePoint, float outlineThickness = 0) const
+    {
+        if (!m_distanceField)
+            return m_font.getGlyph(codePoint, m_characterSize, m_bold, outlineThickness);
+
+        sf::Glyph glyph = m_font.getDistanceFieldGlyph(codePoint, m_bold);
+        glyph.advance *= m_scale;
+        glyph.bounds.position *= m_scale;
+        glyph.bounds.size *= m_scale;
+        return glyph;
+    }
+
+    [[nodiscard]] float getKerning(std::uint32_t first, std::uint32_t second) const
+    {
+        if (!m_distanceField)
+            return m_font.getKerning(first, second, m_characterSize, m_bold);
+
+        return m_font.getDistanceFieldKerning(first, second, m_bold) * m_scale;
+    }
+
+    [[nodiscard]] const sf::Texture& getTexture() const
+    {
+        return m_distanceField ? m_font.getDistanceFieldTexture() : m_font.getTexture(m_characterSize);
+    }
+
+private:
+    const sf::Font& m_font;
+    unsigned int    m_characterSize;
+    bool            m_bold;
+    bool            m_distanceField;
+    float           m_scale;
+};
 } // namespace
 
 
@@ -97,8 +119,19 @@ void Text::setString(const String& string)
 {
     if (m_string != string)
     {
-        m_string             = string;
-        m_geometryNeedUpdate = true;
+        // Only the characters after the common prefix of both strings need to be laid out again
+        const std::size_t prefix = static_cast<std::size_t>(
+            std::mismatch(m_string.begin(), m_string.end(), string.begin(), string.end()).first - m_string.begin());
+
+        m_string              = string;
+        m_validCharacterCount = std::min(m_validCharacterCount, prefix);
+
+        // Characters that are kept keep their color, new ones get the fill color
+        if (!m_characterColors.empty())
+        {
+            m_characterColors.resize(prefix);
+            m_characterColors.resize(m_string.getSize(), m_fillColor);
+        }
     }
 }
 
@@ -161,9 +194,10 @@ void Text::setStyle(std::uint32_t style)
 ////////////////////////////////////////////////////////////
 void Text::setFillColor(Color color)
 {
-    if (color != m_fillColor)
+    if (color != m_fillColor || !m_characterColors.empty())
     {
         m_fillColor = color;
+        m_characterColors.clear();
 
         // Change vertex colors directly, no need to update whole geometry
         // (if geometry is updated anyway, we can skip this step)
@@ -176,6 +210,39 @@ void Text::setFillColor(Color color)
 }
 
 
+////////////////////////////////////////////////////////////
+void Text::setFillColor(Color color, std::size_t first, std::size_t count)
+{
+    // Adjust the range if it's out of bounds
+    first = std::min(first, m_string.getSize());
+    count = std::min(count, m_string.getSize() - first);
+    if (count == 0)
+        return;
+
+    if (m_characterColors.empty())
+        m_characterColors.resize(m_string.getSize(), m_fillColor);
+
+    std::fill_n(m_characterColors.begin() + static_cast<std::ptrdiff_t>(first), count, color);
+
+    // Change the vertex colors of the characters that are already laid out,
+    // the other ones will get their color when they are
+    if (m_geometryNeedUpdate)
+        return;
+
+    const std::size_t last = std::min(first + count, m_validCharacterCount);
+    for (std::size_t i = first; i < last; ++i)
+    {
+        // Skip whitespace, the vertices that follow them belong to underlines and strike throughs
+        const std::uint32_t curChar = m_string[i];
+        if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
+            continue;
+
+        for (std::size_t j = m_layout[i].vertexCount; j < m_layout[i + 1].vertexCount; ++j)
+            m_vertices[j].color = color;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void Text::setOutlineColor(Color color)
 {
@@ -205,6 +272,20 @@ void Text::setOutlineThickness(float thickness)
 }
 
 
+////////////////////////////////////////////////////////////
+void Text::setGlowColor(Color color)
+{
+    m_glowColor = color;
+}
+
+
+////////////////////////////////////////////////////////////
+void Text::setGlowThickness(float thickness)
+{
+    m_glowThickness = thickness;
+}
+
+
 ////////////////////////////////////////////////////////////
 const String& Text::getString() const
 {
@@ -254,6 +335,13 @@ Color Text::getFillColor() const
 }
 
 
+////////////////////////////////////////////////////////////
+Color Text::getFillColor(std::size_t index) const
+{
+    return index < m_characterColors.size() ? m_characterColors[index] : m_fillColor;
+}
+
+
 ////////////////////////////////////////////////////////////
 Color Text::getOutlineColor() const
 {
@@ -269,49 +357,30 @@ float Text::getOutlineThickness() const
 
 
 ////////////////////////////////////////////////////////////
-Vector2f Text::findCharacterPos(std::size_t index) const
+Color Text::getGlowColor() const
 {
-    // Adjust the index if it's out of range
-    index = std::min(index, m_string.getSize());
+    return m_glowColor;
+}
 
-    // Precompute the variables needed by the algorithm
-    const bool  isBold          = m_style & Bold;
-    float       whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
-    const float letterSpacing   = (whitespaceWidth / 3.f) * (m_letterSpacingFactor - 1.f);
-    whitespaceWidth += letterSpacing;
-    const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
 
-    // Compute the position
-    Vector2f      position;
-    std::uint32_t prevChar = 0;
-    for (std::size_t i = 0; i < index; ++i)
-    {
-        const std::uint32_t curChar = m_string[i];
+////////////////////////////////////////////////////////////
+float Text::getGlowThickness() const
+{
+    return m_glowThickness;
+}
 
-        // Apply the kerning offset
-        position.x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
-        prevChar = curChar;
 
-        // Handle special characters
-        switch (curChar)
-        {
-            case U' ':
-                position.x += whitespaceWidth;
-                continue;
-            case U'\t':
-                position.x += whitespaceWidth * 4;
-                continue;
-            case U'\n':
-                position.y += lineSpacing;
-                position.x = 0;
-                continue;
-        }
+////////////////////////////////////////////////////////////
+Vector2f Text::findCharacterPos(std::size_t index) const
+{
+    // The position of every character is recorded when the text is laid out
+    ensureGeometryUpdate();
 
-        // For regular characters, add the advance offset of the glyph
-        position.x += m_font->getGlyph(curChar, m_characterSize, isBold).advance + letterSpacing;
-    }
+    // Adjust the index if it's out of range
+    index = std::min(index, m_string.getSize());
 
-    // Transform the position to global coordinates
+    // Remove the baseline offset of the layout and transform the position to global coordinates
+    const Vector2f position = m_layout[index].position - Vector2f(0.f, static_cast<float>(m_characterSize));
     return getTransform().transformPoint(position);
 }
 
@@ -338,9 +407,34 @@ void Text::draw(RenderTarget& target, RenderStates states) const
     ensureGeometryUpdate();
 
     states.transform *= getTransform();
-    states.texture        = &m_font->getTexture(m_characterSize);
     states.coordinateType = CoordinateType::Pixels;
 
+    // Distance field glyphs are rendered by the shader of the font, along with the outline and glow
+    if (m_font->isDistanceFieldEnabled() && m_font->getDistanceFieldShader())
+    {
+        states.texture = &m_font->getDistanceFieldTexture();
+
+        if (!states.shader)
+        {
+            // Thicknesses are converted from pixels of the text to distances stored in the texture
+            const auto  spread = static_cast<float>(Font::DistanceFieldSpread);
+            const float scale  = static_cast<float>(Font::DistanceFieldCharacterSize) /
+                                (static_cast<float>(m_characterSize) * 2.f * spread);
+            const bool hasOutline = m_outlineThickness > 0;
+
+            const Font::DistanceFieldStyle style{hasOutline ? m_outlineColor : Color::Transparent,
+                                                 hasOutline ? std::min(m_outlineThickness * scale, 0.5f) : 0.f,
+                                                 m_glowColor,
+                                                 std::clamp(m_glowThickness * scale, 0.f, 0.5f)};
+            states.shader = m_font->getDistanceFieldShader(target, style);
+        }
+
+        target.draw(m_vertices, states);
+        return;
+    }
+
+    states.texture = &m_font->getTexture(m_characterSize);
+
     // Only draw the outline if there is something to draw
     if (m_outlineThickness != 0)
         target.draw(m_outlineVertices, states);
@@ -352,27 +446,51 @@ void Text::draw(RenderTarget& target, RenderStates states) const
 ////////////////////////////////////////////////////////////
 void Text::ensureGeometryUpdate() const
 {
-    // Do nothing, if geometry has not changed and the font texture has not changed
-    if (!m_geometryNeedUpdate && m_font->getTexture(m_characterSize).m_cacheId == m_fontTextureId)
+    const GlyphSource glyphs(*m_font,
+                             m_characterSize,
+                             m_style & Bold,
+                             m_font->isDistanceFieldEnabled() && m_font->getDistanceFieldShader());
+
+    // Lay out the whole text again if anything but its string changed, or if the font texture changed
+    if (m_geometryNeedUpdate || glyphs.getTexture().m_cacheId != m_fontTextureId)
+    {
+        m_validCharacterCount = 0;
+        m_layout.clear();
+    }
+
+    // Do nothing, if all the characters are already laid out
+    if (m_validCharacterCount == m_string.getSize() && m_layout.size() == m_string.getSize() + 1)
         return;
 
     // Save the current fonts texture id
-    m_fontTextureId = m_font->getTexture(m_characterSize).m_cacheId;
+    m_fontTextureId = glyphs.getTexture().m_cacheId;
 
     // Mark geometry as updated
     m_geometryNeedUpdate = false;
 
-    // Clear the previous geometry
-    m_vertices.clear();
-    m_outlineVertices.clear();
+    // Resume the layout from the first character that changed, or start it over
+    const std::size_t first = m_layout.empty() ? 0 : m_validCharacterCount;
+    CharacterLayout   state;
+    state.position = Vector2f(0.f, static_cast<float>(m_characterSize));
+    state.minimum  = Vector2f(static_cast<float>(m_characterSize), static_cast<float>(m_characterSize));
+    if (first > 0)
+        state = m_layout[first];
+
+    // Clear the geometry of the characters to lay out again
+    m_vertices.resize(state.vertexCount);
+    m_outlineVertices.resize(state.outlineVertexCount);
+    m_layout.resize(first);
     m_bounds = FloatRect();
 
     // No text: nothing to draw
     if (m_string.isEmpty())
+    {
+        m_layout.push_back(state);
+        m_validCharacterCount = 0;
         return;
+    }
 
     // Compute values related to the text style
-    const bool  isBold             = m_style & Bold;
     const bool  isUnderlined       = m_style & Underlined;
     const bool  isStrikeThrough    = m_style & StrikeThrough;
     const float italicShear        = (m_style & Italic) ? degrees(12).asRadians() : 0.f;
@@ -382,47 +500,88 @@ void Text::ensureGeometryUpdate() const
     // Compute the location of the strike through dynamically
     // We use the center point of the lowercase 'x' glyph as the reference
     // We reuse the underline thickness as the thickness of the strike through as well
-    const float strikeThroughOffset = m_font->getGlyph(U'x', m_characterSize, isBold).bounds.getCenter().y;
+    const float strikeThroughOffset = glyphs.getGlyph(U'x').bounds.getCenter().y;
+
+    // The outline of distance field glyphs is drawn by their shader,
+    // their quads cover the spread of the distance field
+    const bool  hasOutlineVertices = (m_outlineThickness != 0) && !glyphs.isDistanceField();
+    const auto  spread             = static_cast<float>(Font::DistanceFieldSpread);
+    const float quadPadding        = glyphs.isDistanceField() ? spread * glyphs.getScale() : 1.f;
+    const float texturePadding     = glyphs.isDistanceField() ? spread : 1.f;
 
     // Precompute the variables needed by the algorithm
-    float       whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
+    float       whitespaceWidth = glyphs.getGlyph(U' ').advance;
     const float letterSpacing   = (whitespaceWidth / 3.f) * (m_letterSpacingFactor - 1.f);
     whitespaceWidth += letterSpacing;
     const float lineSpacing = m_font->getLineSpacing(m_characterSize) * m_lineSpacingFactor;
-    float       x           = 0.f;
-    auto        y           = static_cast<float>(m_characterSize);
+    float       x           = state.position.x;
+    float       y           = state.position.y;
 
     // Create one quad for each character
-    auto          minX     = static_cast<float>(m_characterSize);
-    auto          minY     = static_cast<float>(m_characterSize);
-    float         maxX     = 0.f;
-    float         maxY     = 0.f;
+    float         minX     = state.minimum.x;
+    float         minY     = state.minimum.y;
+    float         maxX     = state.maximum.x;
+    float         maxY     = state.maximum.y;
     std::uint32_t prevChar = 0;
-    for (const std::uint32_t curChar : m_string)
+    for (std::size_t i = first; i-- > 0;)
+    {
+        if (m_string[i] != U'\r')
+        {
+            prevChar = m_string[i];
+            break;
+        }
+    }
+
+    const auto recordLayout = [&]
     {
+        m_layout.push_back(
+            {{x, y}, m_vertices.getVertexCount(), m_outlineVertices.getVertexCount(), {minX, minY}, {maxX, maxY}});
+    };
+
+    for (std::size_t i = first; i < m_string.getSize(); ++i)
+    {
+        const std::uint32_t curChar = m_string[i];
+
+        // Record the layout before the character
+        recordLayout();
+
         // Skip the \r char to avoid weird graphical issues
         if (curChar == U'\r')
             continue;
 
         // Apply the kerning offset
-        x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+        x += glyphs.getKerning(prevChar, curChar);
 
         // If we're using the underlined style and there's a new line, draw a line
         if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
         {
-            addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
-
-            if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+            priv::addTextLine(m_vertices, 0, x, y, m_fillColor, underlineOffset, underlineThickness);
+
+            if (hasOutlineVertices)
+                priv::addTextLine(m_outlineVertices,
+                                  0,
+                                  x,
+                                  y,
+                                  m_outlineColor,
+                                  underlineOffset,
+                                  underlineThickness,
+                                  m_outlineThickness);
         }
 
         // If we're using the strike through style and there's a new line, draw a line across all characters
         if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
         {
-            addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
-
-            if (m_outlineThickness != 0)
-                addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+            priv::addTextLine(m_vertices, 0, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+
+            if (hasOutlineVertices)
+                priv::addTextLine(m_outlineVertices,
+                                  0,
+                                  x,
+                                  y,
+                                  m_outlineColor,
+                                  strikeThroughOffset,
+                                  underlineThickness,
+                                  m_outlineThickness);
         }
 
         prevChar = curChar;
@@ -457,19 +616,20 @@ void Text::ensureGeometryUpdate() const
         }
 
         // Apply the outline
-        if (m_outlineThickness != 0)
+        if (hasOutlineVertices)
         {
-            const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
+            const Glyph glyph = glyphs.getGlyph(curChar, m_outlineThickness);
 
             // Add the outline glyph to the vertices
-            addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
+            priv::addGlyphQuad(m_outlineVertices, Vector2f(x, y), m_outlineColor, glyph, italicShear);
         }
 
         // Extract the current glyph's description
-        const Glyph& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
+        const Glyph glyph = glyphs.getGlyph(curChar);
 
         // Add the glyph to the vertices
-        addGlyphQuad(m_vertices, Vector2f(x, y), m_fillColor, glyph, italicShear);
+        const Color color = m_characterColors.empty() ? m_fillColor : m_characterColors[i];
+        priv::addGlyphQuad(m_vertices, Vector2f(x, y), color, glyph, italicShear, quadPadding, texturePadding);
 
         // Update the current bounds
         const Vector2f p1 = glyph.bounds.position;
@@ -484,6 +644,10 @@ void Text::ensureGeometryUpdate() const
         x += glyph.advance + letterSpacing;
     }
 
+    // Record the layout at the end of the string, before the lines that close it
+    recordLayout();
+    m_validCharacterCount = m_string.getSize();
+
     // If we're using outline, update the current bounds
     if (m_outlineThickness != 0)
     {
@@ -497,19 +661,33 @@ void Text::ensureGeometryUpdate() const
     // If we're using the underlined style, add the last line
     if (isUnderlined && (x > 0))
     {
-        addLine(m_vertices, x, y, m_fillColor, underlineOffset, underlineThickness);
-
-        if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, underlineOffset, underlineThickness, m_outlineThickness);
+        priv::addTextLine(m_vertices, 0, x, y, m_fillColor, underlineOffset, underlineThickness);
+
+        if (hasOutlineVertices)
+            priv::addTextLine(m_outlineVertices,
+                              0,
+                              x,
+                              y,
+                              m_outlineColor,
+                              underlineOffset,
+                              underlineThickness,
+                              m_outlineThickness);
     }
 
     // If we're using the strike through style, add the last line across all characters
     if (isStrikeThrough && (x > 0))
     {
-        addLine(m_vertices, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
-
-        if (m_outlineThickness != 0)
-            addLine(m_outlineVertices, x, y, m_outlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness);
+        priv::addTextLine(m_vertices, 0, x, y, m_fillColor, strikeThroughOffset, underlineThickness);
+
+        if (hasOutlineVertices)
+            priv::addTextLine(m_outlineVertices,
+                              0,
+                              x,
+                              y,
+                              m_outlineColor,
+                              strikeThroughOffset,
+                              underlineThickness,
+                              m_outlineThickness);
     }
 
     // Update the bounding rectangle
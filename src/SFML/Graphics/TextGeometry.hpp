@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Glyph.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cmath>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Add an underline or strikethrough line to a vertex array
+///
+/// \param vertices         Vertex array to append the two triangles of the line to
+/// \param left             Horizontal position of the start of the line
+/// \param right            Horizontal position of the end of the line
+/// \param lineTop          Vertical position of the baseline of the text
+/// \param color            Color of the line
+/// \param offset           Vertical offset of the line from the baseline
+/// \param thickness        Thickness of the line
+/// \param outlineThickness Thickness of the outline around the line
+///
+////////////////////////////////////////////////////////////
+inline void addTextLine(VertexArray& vertices,
+                        float        left,
+                        float        right,
+                        float        lineTop,
+                        Color        color,
+                        float        offset,
+                        float        thickness,
+                        float        outlineThickness = 0)
+{
+    const float top    = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+    const float bottom = top + std::floor(thickness + 0.5f);
+
+    vertices.append({{left - outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
+    vertices.append({{right + outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
+    vertices.append({{left - outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
+    vertices.append({{left - outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
+    vertices.append({{right + outlineThickness, top - outlineThickness}, color, {1.0f, 1.0f}});
+    vertices.append({{right + outlineThickness, bottom + outlineThickness}, color, {1.0f, 1.0f}});
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Add the quad of a glyph to a vertex array
+///
+/// The quad and its texture coordinates are extended by a
+/// padding around the glyph, so that its antialiased edges
+/// are not cut. The padding of the texture coordinates differs
+/// from the padding of the quad for scaled glyphs, such as the
+/// distance field glyphs of a font.
+///
+/// \param vertices       Vertex array to append the two triangles of the quad to
+/// \param position       Position of the glyph on the baseline
+/// \param color          Color of the glyph
+/// \param glyph          Glyph to add
+/// \param italicShear    Horizontal shear applied for the italic style
+/// \param padding        Padding around the quad
+/// \param texturePadding Padding around the texture coordinates
+///
+////////////////////////////////////////////////////////////
+inline void addGlyphQuad(VertexArray& vertices,
+                         Vector2f     position,
+                         Color        color,
+                         const Glyph& glyph,
+                         float        italicShear,
+                         float        padding        = 1.f,
+                         float        texturePadding = 1.f)
+{
+    const Vector2f p1 = glyph.bounds.position - Vector2f(padding, padding);
+    const Vector2f p2 = glyph.bounds.position + glyph.bounds.size + Vector2f(padding, padding);
+
+    const auto uv1 = Vector2f(glyph.textureRect.position) - Vector2f(texturePadding, texturePadding);
+    const auto uv2 = Vector2f(glyph.textureRect.position + glyph.textureRect.size) +
+                     Vector2f(texturePadding, texturePadding);
+
+    vertices.append({position + Vector2f(p1.x - italicShear * p1.y, p1.y), color, {uv1.x, uv1.y}});
+    vertices.append({position + Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
+    vertices.append({position + Vector2f(p1.x - italicShear * p2.y, p2.y), color, {uv1.x, uv2.y}});
+    vertices.append({position + Vector2f(p1.x - italicShear * p2.y, p2.y), color, {uv1.x, uv2.y}});
+    vertices.append({position + Vector2f(p2.x - italicShear * p1.y, p1.y), color, {uv2.x, uv1.y}});
+    vertices.append({position + Vector2f(p2.x - italicShear * p2.y, p2.y), color, {uv2.x, uv2.y}});
+}
+
+} // namespace sf::priv
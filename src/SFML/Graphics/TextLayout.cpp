@@ -0,0 +1,504 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/TextGeometry.hpp>
+#include <SFML/Graphics/TextLayout.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+// Character of the layout, with the metrics needed to break the lines
+struct Item
+{
+    std::size_t run{};       // Index of the run of the character
+    char32_t    character{}; // Code point of the character
+    float       kerning{};   // Kerning offset with the previous character
+    float       advance{};   // Horizontal offset to the next character
+};
+
+// Line of the layout
+struct Line
+{
+    std::size_t begin{};    // Index of the first item of the line
+    std::size_t end{};      // Index past the last item of the line
+    float       baseline{}; // Vertical position of the baseline of the line
+};
+
+// Check whether a character is laid out without a glyph
+bool isWhitespace(char32_t character)
+{
+    return (character == U' ') || (character == U'\n') || (character == U'\t');
+}
+
+// Check whether two runs can be kerned together
+bool haveSameGlyphs(const sf::TextLayout::Run& first, const sf::TextLayout::Run& second)
+{
+    return (first.font == second.font) && (first.characterSize == second.characterSize) &&
+           ((first.style & sf::Text::Bold) == (second.style & sf::Text::Bold));
+}
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void TextLayout::addRun(Run run)
+{
+    assert(run.font && "TextLayout::addRun() run has no font");
+
+    m_runs.push_back(std::move(run));
+    m_geometryNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::addRun(const Font&   font,
+                        String        string,
+                        unsigned int  characterSize,
+                        std::uint32_t style,
+                        Color         fillColor)
+{
+    Run run;
+    run.font          = &font;
+    run.string        = std::move(string);
+    run.characterSize = characterSize;
+    run.style         = style;
+    run.fillColor     = fillColor;
+    addRun(std::move(run));
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setRun(std::size_t index, Run run)
+{
+    assert(index < m_runs.size() && "Index is out of bounds");
+    assert(run.font && "TextLayout::setRun() run has no font");
+
+    m_runs[index]        = std::move(run);
+    m_geometryNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::clear()
+{
+    m_runs.clear();
+    m_geometryNeedUpdate = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextLayout::getRunCount() const
+{
+    return m_runs.size();
+}
+
+
+////////////////////////////////////////////////////////////
+const TextLayout::Run& TextLayout::getRun(std::size_t index) const
+{
+    assert(index < m_runs.size() && "Index is out of bounds");
+    return m_runs[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setWrapWidth(float width)
+{
+    if (m_wrapWidth != width)
+    {
+        m_wrapWidth          = width;
+        m_geometryNeedUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+float TextLayout::getWrapWidth() const
+{
+    return m_wrapWidth;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::setLineSpacing(float spacingFactor)
+{
+    if (m_lineSpacingFactor != spacingFactor)
+    {
+        m_lineSpacingFactor  = spacingFactor;
+        m_geometryNeedUpdate = true;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+float TextLayout::getLineSpacing() const
+{
+    return m_lineSpacingFactor;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextLayout::getLineCount() const
+{
+    ensureGeometryUpdate();
+
+    return m_lineCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextLayout::getBatchCount() const
+{
+    ensureGeometryUpdate();
+
+    return m_batches.size();
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TextLayout::getLocalBounds() const
+{
+    ensureGeometryUpdate();
+
+    return m_bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TextLayout::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::draw(RenderTarget& target, RenderStates states) const
+{
+    ensureGeometryUpdate();
+
+    states.transform *= getTransform();
+    states.coordinateType = CoordinateType::Pixels;
+
+    // Draw all the outlines first, so that they don't cover the characters of other batches
+    for (const Batch& batch : m_batches)
+    {
+        if (batch.outlineVertices.getVertexCount() > 0)
+        {
+            states.texture = &batch.font->getTexture(batch.characterSize);
+            target.draw(batch.outlineVertices, states);
+        }
+    }
+
+    for (const Batch& batch : m_batches)
+    {
+        if (batch.vertices.getVertexCount() > 0)
+        {
+            states.texture = &batch.font->getTexture(batch.characterSize);
+            target.draw(batch.vertices, states);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void TextLayout::ensureGeometryUpdate() const
+{
+    // Do nothing, if geometry has not changed and the glyph textures have not changed
+    if (!m_geometryNeedUpdate &&
+        std::all_of(m_batches.begin(),
+                    m_batches.end(),
+                    [](const Batch& batch)
+                    { return batch.font->getTexture(batch.characterSize).m_cacheId == batch.textureId; }))
+        return;
+
+    // Mark geometry as updated
+    m_geometryNeedUpdate = false;
+
+    // Clear the previous geometry
+    m_batches.clear();
+    m_lineCount = 0;
+    m_bounds    = FloatRect();
+
+    // Gather the characters of all the runs, with their advance and their kerning
+    std::vector<Item> items;
+    for (std::size_t runIndex = 0; runIndex < m_runs.size(); ++runIndex)
+    {
+        const Run&  run             = m_runs[runIndex];
+        const bool  isBold          = run.style & Text::Bold;
+        const float whitespaceWidth = run.font->getGlyph(U' ', run.characterSize, isBold).advance;
+
+        for (const char32_t curChar : run.string)
+        {
+            // Skip the \r char to avoid weird graphical issues
+            if (curChar == U'\r')
+                continue;
+
+            Item item{runIndex, curChar, 0.f, 0.f};
+
+            // Kerning only applies between characters that share the same glyphs
+            if (!items.empty() && haveSameGlyphs(m_runs[items.back().run], run))
+                item.kerning = run.font->getKerning(items.back().character, curChar, run.characterSize, isBold);
+
+            switch (curChar)
+            {
+                case U' ':
+                    item.advance = whitespaceWidth;
+                    break;
+                case U'\t':
+                    item.advance = whitespaceWidth * 4;
+                    break;
+                case U'\n':
+                    break;
+                default:
+                    item.advance = run.font->getGlyph(curChar, run.characterSize, isBold).advance;
+                    break;
+            }
+
+            items.push_back(item);
+        }
+    }
+
+    // No text: nothing to draw
+    if (items.empty())
+        return;
+
+    // Break the lines at the new line characters, and wrap them at the wrap width
+    std::vector<Line> lines;
+    std::size_t       lineBegin = 0;
+    std::size_t       breakEnd  = 0;
+    float             x         = 0.f;
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+        const Item& item = items[i];
+
+        if (item.character == U'\n')
+        {
+            lines.push_back({lineBegin, i + 1});
+            lineBegin = i + 1;
+            breakEnd  = 0;
+            x         = 0.f;
+            continue;
+        }
+
+        // The first character of a line isn't kerned
+        const float kerning = (i == lineBegin) ? 0.f : item.kerning;
+
+        // Break after the last whitespace of the line, or before the character if the word is wider than the line
+        if ((m_wrapWidth > 0) && !isWhitespace(item.character) && (i > lineBegin) &&
+            (x + kerning + item.advance > m_wrapWidth))
+        {
+            const std::size_t lineEnd = (breakEnd > lineBegin) ? breakEnd : i;
+            lines.push_back({lineBegin, lineEnd});
+            lineBegin = lineEnd;
+            breakEnd  = 0;
+            x         = 0.f;
+
+            // Lay out the characters that moved to the new line again
+            i = lineEnd - 1;
+            continue;
+        }
+
+        x += kerning + item.advance;
+
+        if (isWhitespace(item.character))
+            breakEnd = i + 1;
+    }
+    lines.push_back({lineBegin, items.size()});
+
+    // Place the baselines: each line is as high as its largest characters, and
+    // lines that have no characters take the metrics of the previous character
+    std::size_t metricsRun = items.front().run;
+    for (std::size_t l = 0; l < lines.size(); ++l)
+    {
+        Line&        line          = lines[l];
+        unsigned int characterSize = 0;
+        float        lineSpacing   = 0.f;
+        for (std::size_t i = line.begin; (i < line.end) || (i == line.begin); ++i)
+        {
+            if (i < line.end)
+                metricsRun = items[i].run;
+
+            const Run& run = m_runs[metricsRun];
+            characterSize  = std::max(characterSize, run.characterSize);
+            lineSpacing    = std::max(lineSpacing, run.font->getLineSpacing(run.characterSize));
+        }
+
+        line.baseline = (l == 0) ? static_cast<float>(characterSize)
+                                 : lines[l - 1].baseline + lineSpacing * m_lineSpacingFactor;
+    }
+
+    // Find the batch of the glyph texture used by a run, or create it; the texture id is
+    // saved before any of its glyphs is placed, so that a texture which changes while the
+    // layout is in progress (e.g. glyphs evicted to stay in the memory budget) is detected
+    const auto getBatch = [this](const Run& run) -> Batch&
+    {
+        const auto it = std::find_if(m_batches.begin(),
+                                     m_batches.end(),
+                                     [&run](const Batch& batch)
+                                     { return batch.font == run.font && batch.characterSize == run.characterSize; });
+        if (it != m_batches.end())
+            return *it;
+
+        Batch& batch        = m_batches.emplace_back();
+        batch.font          = run.font;
+        batch.characterSize = run.characterSize;
+        batch.textureId     = run.font->getTexture(run.characterSize).m_cacheId;
+        return batch;
+    };
+
+    // Add the underline and the strike through of a run, from left to right
+    const auto addLines = [&getBatch](const Run& run, float left, float right, float y)
+    {
+        const bool isUnderlined    = run.style & Text::Underlined;
+        const bool isStrikeThrough = run.style & Text::StrikeThrough;
+        if ((!isUnderlined && !isStrikeThrough) || (right <= left))
+            return;
+
+        Batch&      batch     = getBatch(run);
+        const float outline   = run.outlineThickness;
+        const float thickness = run.font->getUnderlineThickness(run.characterSize);
+
+        if (isUnderlined)
+        {
+            const float offset = run.font->getUnderlinePosition(run.characterSize);
+            priv::addTextLine(batch.vertices, left, right, y, run.fillColor, offset, thickness);
+
+            if (outline != 0)
+                priv::addTextLine(batch.outlineVertices, left, right, y, run.outlineColor, offset, thickness, outline);
+        }
+
+        // We use the center point of the lowercase 'x' glyph as the reference of the strike through
+        if (isStrikeThrough)
+        {
+            const Glyph glyph  = run.font->getGlyph(U'x', run.characterSize, run.style & Text::Bold);
+            const float offset = glyph.bounds.getCenter().y;
+            priv::addTextLine(batch.vertices, left, right, y, run.fillColor, offset, thickness);
+
+            if (outline != 0)
+                priv::addTextLine(batch.outlineVertices, left, right, y, run.outlineColor, offset, thickness, outline);
+        }
+    };
+
+    // Create one quad for each character, in the batch of its run
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest();
+    float maxY = std::numeric_limits<float>::lowest();
+    for (std::size_t l = 0; l < lines.size(); ++l)
+    {
+        const Line& line = lines[l];
+        const float y    = line.baseline;
+        x                = 0.f;
+
+        // Underlines and strike throughs are drawn for each piece of run of the line
+        std::size_t segmentRun   = m_runs.size();
+        float       segmentStart = 0.f;
+
+        for (std::size_t i = line.begin; i < line.end; ++i)
+        {
+            const Item& item = items[i];
+            const Run&  run  = m_runs[item.run];
+
+            if (i != line.begin)
+                x += item.kerning;
+
+            if (item.run != segmentRun)
+            {
+                if (segmentRun < m_runs.size())
+                    addLines(m_runs[segmentRun], segmentStart, x, y);
+
+                segmentRun   = item.run;
+                segmentStart = x;
+            }
+
+            // Handle special characters, no need to create a quad for whitespace
+            if (isWhitespace(item.character))
+            {
+                minX = std::min(minX, x);
+                minY = std::min(minY, y);
+
+                x += item.advance;
+
+                maxX = std::max(maxX, item.character == U'\n' ? 0.f : x);
+                maxY = std::max(maxY, item.character == U'\n' ? lines[l + 1].baseline : y);
+                continue;
+            }
+
+            const bool  isBold      = run.style & Text::Bold;
+            const float italicShear = (run.style & Text::Italic) ? degrees(12).asRadians() : 0.f;
+            Batch&      batch       = getBatch(run);
+
+            // Apply the outline
+            if (run.outlineThickness != 0)
+            {
+                const Glyph glyph = run.font->getGlyph(item.character, run.characterSize, isBold, run.outlineThickness);
+                priv::addGlyphQuad(batch.outlineVertices, Vector2f(x, y), run.outlineColor, glyph, italicShear);
+            }
+
+            // Add the glyph to the vertices
+            const Glyph glyph = run.font->getGlyph(item.character, run.characterSize, isBold);
+            priv::addGlyphQuad(batch.vertices, Vector2f(x, y), run.fillColor, glyph, italicShear);
+
+            // Update the current bounds, including the outline
+            const Vector2f p1      = glyph.bounds.position;
+            const Vector2f p2      = glyph.bounds.position + glyph.bounds.size;
+            const float    outline = std::abs(std::ceil(run.outlineThickness));
+
+            minX = std::min(minX, x + p1.x - italicShear * p2.y - outline);
+            maxX = std::max(maxX, x + p2.x - italicShear * p1.y + outline);
+            minY = std::min(minY, y + p1.y - outline);
+            maxY = std::max(maxY, y + p2.y + outline);
+
+            // Advance to the next character
+            x += item.advance;
+        }
+
+        if (segmentRun < m_runs.size())
+            addLines(m_runs[segmentRun], segmentStart, x, y);
+    }
+
+    // Update the bounding rectangle
+    m_lineCount       = lines.size();
+    m_bounds.position = Vector2f(minX, minY);
+    m_bounds.size     = Vector2f(maxX, maxY) - Vector2f(minX, minY);
+}
+
+} // namespace sf
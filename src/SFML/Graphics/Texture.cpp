@@ -29,6 +29,7 @@
 #include <SFML/Graphics/GLExtensions.hpp>
 #include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureContainer.hpp>
 #include <SFML/Graphics/TextureSaver.hpp>
 
 #include <SFML/Window/Context.hpp>
@@ -36,12 +37,15 @@
 
 #include <SFML/System/Err.hpp>
 #include <SFML/System/Exception.hpp>
+#include <SFML/System/FileInputStream.hpp>
+#include <SFML/System/Utils.hpp>
 
 #include <algorithm>
 #include <array>
 #include <atomic>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 #include <cassert>
 #include <cstring>
@@ -60,6 +64,64 @@ std::uint64_t getUniqueId() noexcept
 
     return id.fetch_add(1);
 }
+
+// Check whether the driver can sample textures in a compressed format,
+// must be called with an active context
+bool isFormatSupported(sf::priv::TextureContainer::Format format)
+{
+    using Format = sf::priv::TextureContainer::Format;
+
+    switch (format)
+    {
+        case Format::Rgba8:
+            return true;
+        case Format::Bc1:
+        case Format::Bc3:
+            if (sf::Context::isExtensionAvailable("GL_EXT_texture_compression_s3tc"))
+                return true;
+            break;
+        case Format::Bc7:
+#ifndef SFML_OPENGL_ES
+            if (GLEXT_GL_VERSION_4_2)
+                return true;
+#endif
+            if (sf::Context::isExtensionAvailable("GL_ARB_texture_compression_bptc") ||
+                sf::Context::isExtensionAvailable("GL_EXT_texture_compression_bptc"))
+                return true;
+            break;
+        case Format::Etc2Rgb:
+        case Format::Etc2Rgba:
+#ifndef SFML_OPENGL_ES
+            if (GLEXT_GL_VERSION_4_3)
+                return true;
+#endif
+            if (sf::Context::isExtensionAvailable("GL_ARB_ES3_compatibility"))
+                return true;
+            break;
+        case Format::Astc4x4:
+        case Format::Astc6x6:
+        case Format::Astc8x8:
+            if (sf::Context::isExtensionAvailable("GL_KHR_texture_compression_astc_ldr"))
+                return true;
+            break;
+    }
+
+    // Some drivers support formats without exposing the matching extension, they still list them
+    static const std::vector<GLint> compressedFormats = []
+    {
+        GLint count = 0;
+        glCheck(glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &count));
+
+        std::vector<GLint> result(static_cast<std::size_t>(std::max(count, 0)));
+        if (!result.empty())
+            glCheck(glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, result.data()));
+
+        return result;
+    }();
+
+    const auto internalFormat = static_cast<GLint>(sf::priv::getCompressedInternalFormat(format, false));
+    return std::find(compressedFormats.begin(), compressedFormats.end(), internalFormat) != compressedFormats.end();
+}
 } // namespace TextureImpl
 } // namespace
 
@@ -351,6 +413,20 @@ bool Texture::resize(Vector2u size, bool sRgb)
 ////////////////////////////////////////////////////////////
 bool Texture::loadFromFile(const std::filesystem::path& filename, bool sRgb, const IntRect& area)
 {
+    // Texture containers are read whole, other files are decoded to an image
+    const std::string extension = toLower(filename.extension().string());
+    if ((extension == ".dds") || (extension == ".ktx2"))
+    {
+        FileInputStream stream;
+        if (!stream.open(filename))
+        {
+            err() << "Failed to load texture\n" << formatDebugPathInfo(filename) << std::endl;
+            return false;
+        }
+
+        return loadFromStream(stream, sRgb, area);
+    }
+
     Image image;
     return image.loadFromFile(filename) && loadFromImage(image, sRgb, area);
 }
@@ -359,6 +435,9 @@ bool Texture::loadFromFile(const std::filesystem::path& filename, bool sRgb, con
 ////////////////////////////////////////////////////////////
 bool Texture::loadFromMemory(const void* data, std::size_t size, bool sRgb, const IntRect& area)
 {
+    if (priv::isTextureContainer(data, size))
+        return loadFromContainer(data, size, sRgb, area);
+
     Image image;
     return image.loadFromMemory(data, size) && loadFromImage(image, sRgb, area);
 }
@@ -367,6 +446,26 @@ bool Texture::loadFromMemory(const void* data, std::size_t size, bool sRgb, cons
 ////////////////////////////////////////////////////////////
 bool Texture::loadFromStream(InputStream& stream, bool sRgb, const IntRect& area)
 {
+    // Read the signature to find out whether the stream holds a texture container
+    std::array<std::uint8_t, 12> signature{};
+    std::optional<std::size_t>   signatureSize;
+    if (stream.seek(0).has_value())
+        signatureSize = stream.read(signature.data(), signature.size());
+
+    if (signatureSize && priv::isTextureContainer(signature.data(), *signatureSize))
+    {
+        const std::optional<std::size_t> size = stream.getSize();
+        std::vector<std::uint8_t>        data(size.value_or(0));
+
+        if (!size || !stream.seek(0).has_value() || (stream.read(data.data(), data.size()) != data.size()))
+        {
+            err() << "Failed to read texture container from stream" << std::endl;
+            return false;
+        }
+
+        return loadFromContainer(data.data(), data.size(), sRgb, area);
+    }
+
     Image image;
     return image.loadFromStream(stream) && loadFromImage(image, sRgb, area);
 }
@@ -434,6 +533,136 @@ bool Texture::loadFromImage(const Image& image, bool sRgb, const IntRect& area)
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::loadFromContainer(const void* data, std::size_t size, bool sRgb, const IntRect& area)
+{
+    const std::optional<priv::TextureContainer> container = priv::loadTextureContainer(data, size);
+    if (!container)
+    {
+        // Error message generated in called function.
+        return false;
+    }
+
+    // Don't go any further with pixels that couldn't fit in a texture anyway
+    const unsigned int maxSize = getMaximumSize();
+    if ((container->size.x > maxSize) || (container->size.y > maxSize))
+    {
+        err() << "Failed to load texture, its size is too high "
+              << "(" << container->size.x << "x" << container->size.y << ", "
+              << "maximum is " << maxSize << "x" << maxSize << ")" << std::endl;
+        return false;
+    }
+
+    const auto containerSize = Vector2i(container->size);
+    const bool srgbPixels    = sRgb || container->sRgb;
+    const bool wholeTexture  = (area.size.x == 0) || (area.size.y == 0) ||
+                              ((area.position.x <= 0) && (area.position.y <= 0) && (area.size.x >= containerSize.x) &&
+                               (area.size.y >= containerSize.y));
+
+    {
+        const TransientContextLock lock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        // Upload the levels as they are when the driver supports their format and no padding is needed
+        if (wholeTexture && (getValidSize(container->size.x) == container->size.x) &&
+            (getValidSize(container->size.y) == container->size.y) && TextureImpl::isFormatSupported(container->format))
+        {
+            // Create the texture with its parameters, its storage is then replaced by the levels
+            if (!resize(container->size, srgbPixels))
+                return false;
+
+            std::size_t levelCount = container->levels.size();
+
+#ifdef SFML_OPENGL_ES
+            // Without GL_TEXTURE_MAX_LEVEL, only a complete chain of levels can be sampled
+            std::size_t completeLevelCount = 1;
+            while ((std::max(container->size.x, container->size.y) >> completeLevelCount) > 0)
+                ++completeLevelCount;
+
+            if (levelCount != completeLevelCount)
+                levelCount = 1;
+#endif
+
+            // Make sure that the current texture binding will be preserved
+            const priv::TextureSaver save;
+
+            glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+            for (std::size_t level = 0; level < levelCount; ++level)
+            {
+                const std::vector<std::uint8_t>& pixels = container->levels[level];
+                const auto levelWidth  = static_cast<GLsizei>(std::max(container->size.x >> level, 1u));
+                const auto levelHeight = static_cast<GLsizei>(std::max(container->size.y >> level, 1u));
+
+                if (container->format == priv::TextureContainer::Format::Rgba8)
+                {
+                    glCheck(glTexImage2D(GL_TEXTURE_2D,
+                                         static_cast<GLint>(level),
+                                         (m_sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA),
+                                         levelWidth,
+                                         levelHeight,
+                                         0,
+                                         GL_RGBA,
+                                         GL_UNSIGNED_BYTE,
+                                         pixels.data()));
+                }
+                else
+                {
+                    glCheck(glCompressedTexImage2D(GL_TEXTURE_2D,
+                                                   static_cast<GLint>(level),
+                                                   priv::getCompressedInternalFormat(container->format, m_sRgb),
+                                                   levelWidth,
+                                                   levelHeight,
+                                                   0,
+                                                   static_cast<GLsizei>(pixels.size()),
+                                                   pixels.data()));
+                }
+            }
+
+            if (levelCount > 1)
+            {
+#ifndef SFML_OPENGL_ES
+                glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levelCount - 1)));
+#endif
+                glCheck(glTexParameteri(GL_TEXTURE_2D,
+                                        GL_TEXTURE_MIN_FILTER,
+                                        m_isSmooth ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR));
+                m_hasMipmap = true;
+            }
+
+            // Force an OpenGL flush, so that the texture will appear updated
+            // in all contexts immediately (solves problems in multi-threaded apps)
+            glCheck(glFlush());
+
+            return true;
+        }
+    }
+
+    // Otherwise decompress the first level and go through an image, mipmaps are then generated
+    std::optional<std::vector<std::uint8_t>> pixels;
+    if (container->format == priv::TextureContainer::Format::Rgba8)
+        pixels = container->levels.front();
+    else
+        pixels = priv::decompressLevel(container->format, container->size, container->levels.front());
+
+    if (!pixels)
+    {
+        err() << "Failed to load texture, its compressed format is not supported by the graphics driver" << std::endl;
+        return false;
+    }
+
+    if (!loadFromImage(Image(container->size, pixels->data()), srgbPixels, area))
+        return false;
+
+    // The texture is still usable without mipmap if they can't be generated
+    if (container->levels.size() > 1)
+        (void)generateMipmap();
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2u Texture::getSize() const
 {
@@ -555,7 +784,15 @@ void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
     assert(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
     assert(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
 
-    if (pixels && m_texture)
+    if (pixels)
+        updatePixels(pixels, size, dest);
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::updatePixels(const void* pixels, Vector2u size, Vector2u dest)
+{
+    if (m_texture)
     {
         const TransientContextLock lock;
 
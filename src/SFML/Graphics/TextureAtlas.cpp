@@ -0,0 +1,317 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/SkylinePacker.hpp>
+#include <SFML/Graphics/TextureAtlas.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TextureAtlasImpl
+{
+// Size of the texture when the first entry is added
+constexpr sf::Vector2u initialSize(256, 256);
+
+// Number of transparent pixels uploaded at once when clearing an area of the texture
+constexpr unsigned int clearBlockSize = 256 * 1024;
+
+// Double the smallest side of the packer bin, if the texture can be that big
+bool grow(sf::priv::SkylinePacker& packer)
+{
+    const sf::Vector2u size        = packer.getSize();
+    const unsigned int maximumSize = sf::Texture::getMaximumSize();
+
+    if ((size.x <= size.y) && (size.x * 2 <= maximumSize))
+        packer.grow({size.x * 2, size.y});
+    else if (size.y * 2 <= maximumSize)
+        packer.grow({size.x, size.y * 2});
+    else if (size.x * 2 <= maximumSize)
+        packer.grow({size.x * 2, size.y});
+    else
+        return false;
+
+    return true;
+}
+
+// Make an area of the texture transparent, uploading a few rows at a time from the same block of zeros
+void clear(sf::Texture& texture, sf::Vector2u position, sf::Vector2u size)
+{
+    if ((size.x == 0) || (size.y == 0))
+        return;
+
+    const unsigned int              rows = std::clamp(clearBlockSize / size.x, 1u, size.y);
+    const std::vector<std::uint8_t> zeros(std::size_t{size.x} * rows * 4);
+
+    for (unsigned int y = 0; y < size.y; y += rows)
+        texture.update(zeros.data(), {size.x, std::min(rows, size.y - y)}, {position.x, position.y + y});
+}
+} // namespace TextureAtlasImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas() = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(unsigned int padding) : m_padding(padding)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::~TextureAtlas() = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas::TextureAtlas(TextureAtlas&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TextureAtlas& TextureAtlas::operator=(TextureAtlas&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::optional<IntRect> TextureAtlas::add(const Image& image)
+{
+    return add(image.getPixelsPtr(), image.getSize());
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<IntRect> TextureAtlas::add(const std::uint8_t* pixels, Vector2u size)
+{
+    const std::optional<std::vector<IntRect>> rects = insert({{pixels, size}});
+
+    if (!rects)
+        return std::nullopt;
+
+    return rects->front();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::vector<IntRect>> TextureAtlas::add(const std::vector<Image>& images)
+{
+    std::vector<Pixels> entries;
+    entries.reserve(images.size());
+
+    for (const Image& image : images)
+        entries.push_back({image.getPixelsPtr(), image.getSize()});
+
+    return insert(entries);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::freeze()
+{
+    if (m_isFrozen)
+        return;
+
+    m_isFrozen = true;
+
+    if (!m_packer)
+        return;
+
+    const Vector2u usedSize = m_packer->getUsedSize();
+    m_packer.reset();
+
+    if ((usedSize.x == 0) || (usedSize.y == 0) || (usedSize == m_texture.getSize()))
+        return;
+
+    // Crop the texture, the entries keep their position since the texture is anchored at its top-left corner
+    Texture texture;
+    if (!texture.loadFromImage(m_texture.copyToImage(), false, IntRect({0, 0}, Vector2i(usedSize))))
+    {
+        err() << "Failed to crop texture atlas" << std::endl;
+        return;
+    }
+
+    texture.setSmooth(m_isSmooth);
+    m_texture = std::move(texture);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::isFrozen() const
+{
+    return m_isFrozen;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::clear()
+{
+    m_texture  = Texture();
+    m_packer   = nullptr;
+    m_isFrozen = false;
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureAtlas::getTexture() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TextureAtlas::getPadding() const
+{
+    return m_padding;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureAtlas::setSmooth(bool smooth)
+{
+    m_isSmooth = smooth;
+    m_texture.setSmooth(smooth);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::isSmooth() const
+{
+    return m_isSmooth;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::vector<IntRect>> TextureAtlas::insert(const std::vector<Pixels>& entries)
+{
+    if (m_isFrozen)
+    {
+        err() << "Failed to add to texture atlas: the atlas is frozen" << std::endl;
+        return std::nullopt;
+    }
+
+    if (!m_packer)
+        m_packer = std::make_unique<priv::SkylinePacker>(TextureAtlasImpl::initialSize);
+
+    // Place the tallest entries first, they leave less space unused
+    std::vector<std::size_t> order(entries.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&entries](std::size_t left, std::size_t right)
+                     {
+                         const Vector2u leftSize  = entries[left].size;
+                         const Vector2u rightSize = entries[right].size;
+
+                         if (leftSize.y != rightSize.y)
+                             return leftSize.y > rightSize.y;
+
+                         return leftSize.x > rightSize.x;
+                     });
+
+    // Place all the entries before touching the texture, so that it is grown at most once
+    // and nothing is added if one of the entries doesn't fit
+    priv::SkylinePacker  packer = *m_packer;
+    std::vector<IntRect> rects(entries.size());
+    const Vector2u       padding(m_padding, m_padding);
+
+    for (const std::size_t index : order)
+    {
+        const Vector2u size = entries[index].size;
+
+        if ((size.x == 0) || (size.y == 0))
+            continue;
+
+        std::optional<Vector2u> position = packer.insert(size + padding);
+        while (!position && TextureAtlasImpl::grow(packer))
+            position = packer.insert(size + padding);
+
+        if (!position)
+        {
+            err() << "Failed to add to texture atlas: the maximum texture size has been reached" << std::endl;
+            return std::nullopt;
+        }
+
+        rects[index] = IntRect(Vector2i(*position + padding), Vector2i(size));
+    }
+
+    if ((packer.getSize() != m_texture.getSize()) && !resizeTexture(packer.getSize()))
+        return std::nullopt;
+
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        if (rects[i].size != Vector2i())
+            m_texture.update(entries[i].data, entries[i].size, Vector2u(rects[i].position));
+    }
+
+    *m_packer = std::move(packer);
+
+    return rects;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureAtlas::resizeTexture(Vector2u size)
+{
+    Texture texture;
+    if (!texture.resize(size))
+    {
+        err() << "Failed to resize texture atlas" << std::endl;
+        return false;
+    }
+
+    texture.setSmooth(m_isSmooth);
+
+    // Copy the current pixels on the GPU
+    const Vector2u oldSize = m_texture.getSize();
+    if (oldSize != Vector2u())
+        texture.update(m_texture);
+
+    // The rest starts transparent, so that the padding doesn't bleed into smooth entries:
+    // clear the strip on the right of the current pixels, then the strip below them
+    TextureAtlasImpl::clear(texture, {oldSize.x, 0}, {size.x - oldSize.x, oldSize.y});
+    TextureAtlasImpl::clear(texture, {0, oldSize.y}, {size.x, size.y - oldSize.y});
+
+    m_texture = std::move(texture);
+
+    return true;
+}
+
+} // namespace sf
@@ -0,0 +1,535 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureContainer.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <ostream>
+
+#include <cstring>
+
+
+namespace
+{
+using Format = sf::priv::TextureContainer::Format;
+
+// Block dimensions and OpenGL internal formats of a pixel format; the compressed formats are
+// not all exposed by the OpenGL loader, their values come from the OpenGL extension registry
+struct FormatInfo
+{
+    sf::Vector2u blockSize;    //!< Size of a block, in pixels
+    std::size_t  blockBytes{}; //!< Size of a block, in bytes
+    unsigned int linear{};     //!< Internal format of the linear variant
+    unsigned int sRgb{};       //!< Internal format of the sRGB variant
+};
+
+const FormatInfo& getFormatInfo(Format format)
+{
+    static constexpr std::array<FormatInfo, 9> infos = {{
+        {{1, 1}, 4, 0, 0},            // Rgba8, uploaded uncompressed
+        {{4, 4}, 8, 0x83F1, 0x8C4D},  // Bc1: COMPRESSED_RGBA_S3TC_DXT1_EXT, COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+        {{4, 4}, 16, 0x83F3, 0x8C4F}, // Bc3: COMPRESSED_RGBA_S3TC_DXT5_EXT, COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT
+        {{4, 4}, 16, 0x8E8C, 0x8E8D}, // Bc7: COMPRESSED_RGBA_BPTC_UNORM, COMPRESSED_SRGB_ALPHA_BPTC_UNORM
+        {{4, 4}, 8, 0x9274, 0x9275},  // Etc2Rgb: COMPRESSED_RGB8_ETC2, COMPRESSED_SRGB8_ETC2
+        {{4, 4}, 16, 0x9278, 0x9279}, // Etc2Rgba: COMPRESSED_RGBA8_ETC2_EAC, COMPRESSED_SRGB8_ALPHA8_ETC2_EAC
+        {{4, 4}, 16, 0x93B0, 0x93D0}, // Astc4x4: COMPRESSED_RGBA_ASTC_4x4_KHR, COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR
+        {{6, 6}, 16, 0x93B4, 0x93D4}, // Astc6x6: COMPRESSED_RGBA_ASTC_6x6_KHR, COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR
+        {{8, 8}, 16, 0x93B7, 0x93D7}, // Astc8x8: COMPRESSED_RGBA_ASTC_8x8_KHR, COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR
+    }};
+
+    return infos[static_cast<std::size_t>(format)];
+}
+
+// Signatures of the containers
+constexpr std::array<std::uint8_t, 4>  ddsMagic  = {'D', 'D', 'S', ' '};
+constexpr std::array<std::uint8_t, 12> ktx2Magic = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+// Read little-endian integers, the caller checks the bounds
+std::uint32_t readUint32(const std::uint8_t* data, std::size_t offset)
+{
+    return std::uint32_t{data[offset]} | (std::uint32_t{data[offset + 1]} << 8) |
+           (std::uint32_t{data[offset + 2]} << 16) | (std::uint32_t{data[offset + 3]} << 24);
+}
+
+std::uint64_t readUint64(const std::uint8_t* data, std::size_t offset)
+{
+    return std::uint64_t{readUint32(data, offset)} | (std::uint64_t{readUint32(data, offset + 4)} << 32);
+}
+
+constexpr std::uint32_t makeFourCc(char a, char b, char c, char d)
+{
+    return std::uint32_t{static_cast<std::uint8_t>(a)} | (std::uint32_t{static_cast<std::uint8_t>(b)} << 8) |
+           (std::uint32_t{static_cast<std::uint8_t>(c)} << 16) | (std::uint32_t{static_cast<std::uint8_t>(d)} << 24);
+}
+
+// Largest width or height accepted in a container, above what drivers support but
+// low enough for the size of the decompressed pixels not to overflow on 64-bit platforms
+constexpr unsigned int maxContainerSize = 65536;
+
+// Check that the size of the first mipmap level is neither empty nor unreasonably large
+bool isValidSize(sf::Vector2u size)
+{
+    return (size.x > 0) && (size.y > 0) && (size.x <= maxContainerSize) && (size.y <= maxContainerSize);
+}
+
+// Number of levels of a complete mipmap chain, down to 1x1
+std::size_t getMaxLevelCount(sf::Vector2u size)
+{
+    std::size_t levelCount = 1;
+    while ((std::max(size.x, size.y) >> levelCount) > 0)
+        ++levelCount;
+
+    return levelCount;
+}
+
+// Size of a mipmap level, each dimension being halved and at least 1
+sf::Vector2u getLevelSize(sf::Vector2u size, std::size_t level)
+{
+    return {std::max(size.x >> level, 1u), std::max(size.y >> level, 1u)};
+}
+
+// Copy a mipmap level of the container, checking that it's within the data
+bool addLevel(sf::priv::TextureContainer& container, const std::uint8_t* data, std::size_t size, std::uint64_t offset)
+{
+    const std::size_t byteCount = sf::priv::getLevelByteCount(container.format,
+                                                              getLevelSize(container.size, container.levels.size()));
+    if ((byteCount == 0) || (offset > size) || (byteCount > size - offset))
+        return false;
+
+    const std::uint8_t* begin = data + offset;
+    container.levels.emplace_back(begin, begin + byteCount);
+    return true;
+}
+
+// Find the pixel format of a DDS file, from the DX10 header's DXGI format or from the legacy pixel format
+std::optional<std::pair<Format, bool>> getDxgiFormat(std::uint32_t dxgiFormat)
+{
+    switch (dxgiFormat)
+    {
+        case 28: // DXGI_FORMAT_R8G8B8A8_UNORM
+            return std::pair(Format::Rgba8, false);
+        case 29: // DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+            return std::pair(Format::Rgba8, true);
+        case 71: // DXGI_FORMAT_BC1_UNORM
+            return std::pair(Format::Bc1, false);
+        case 72: // DXGI_FORMAT_BC1_UNORM_SRGB
+            return std::pair(Format::Bc1, true);
+        case 77: // DXGI_FORMAT_BC3_UNORM
+            return std::pair(Format::Bc3, false);
+        case 78: // DXGI_FORMAT_BC3_UNORM_SRGB
+            return std::pair(Format::Bc3, true);
+        case 98: // DXGI_FORMAT_BC7_UNORM
+            return std::pair(Format::Bc7, false);
+        case 99: // DXGI_FORMAT_BC7_UNORM_SRGB
+            return std::pair(Format::Bc7, true);
+        default:
+            return std::nullopt;
+    }
+}
+
+std::optional<sf::priv::TextureContainer> loadDds(const std::uint8_t* data, std::size_t size)
+{
+    // Layout of the 124 bytes header that follows the signature
+    constexpr std::size_t   headerEnd       = 128;
+    constexpr std::size_t   dx10HeaderEnd   = 148;
+    constexpr std::uint32_t mipMapCountFlag = 0x20000;
+    constexpr std::uint32_t fourCcFlag      = 0x4;
+    constexpr std::uint32_t rgbFlag         = 0x40;
+    constexpr std::uint32_t cubeMapFlag     = 0x200;
+    constexpr std::uint32_t volumeFlag      = 0x200000;
+
+    if ((size < headerEnd) || (readUint32(data, 4) != 124))
+    {
+        sf::err() << "Failed to load DDS file, invalid header" << std::endl;
+        return std::nullopt;
+    }
+
+    sf::priv::TextureContainer container;
+    container.size = {readUint32(data, 16), readUint32(data, 12)};
+
+    const std::uint32_t flags      = readUint32(data, 8);
+    const std::uint32_t pixelFlags = readUint32(data, 80);
+    const std::uint32_t fourCc     = readUint32(data, 84);
+    const std::uint32_t caps2      = readUint32(data, 112);
+    std::size_t         offset     = headerEnd;
+    std::size_t         levelCount = (flags & mipMapCountFlag) ? std::max(readUint32(data, 28), 1u) : 1;
+
+    if ((caps2 & (cubeMapFlag | volumeFlag)) != 0)
+    {
+        sf::err() << "Failed to load DDS file, only 2D textures are supported" << std::endl;
+        return std::nullopt;
+    }
+
+    std::optional<std::pair<Format, bool>> format;
+    if ((pixelFlags & fourCcFlag) && (fourCc == makeFourCc('D', 'X', 'T', '1')))
+    {
+        format = std::pair(Format::Bc1, false);
+    }
+    else if ((pixelFlags & fourCcFlag) && (fourCc == makeFourCc('D', 'X', 'T', '5')))
+    {
+        format = std::pair(Format::Bc3, false);
+    }
+    else if ((pixelFlags & fourCcFlag) && (fourCc == makeFourCc('D', 'X', '1', '0')))
+    {
+        // The DX10 header must describe a single 2D texture
+        if ((size < dx10HeaderEnd) || (readUint32(data, 132) != 3) || (readUint32(data, 136) & 0x4) ||
+            (readUint32(data, 140) > 1))
+        {
+            sf::err() << "Failed to load DDS file, only 2D textures are supported" << std::endl;
+            return std::nullopt;
+        }
+
+        format = getDxgiFormat(readUint32(data, 128));
+        offset = dx10HeaderEnd;
+    }
+    else if ((pixelFlags & rgbFlag) && (readUint32(data, 88) == 32) && (readUint32(data, 92) == 0x000000FF) &&
+             (readUint32(data, 96) == 0x0000FF00) && (readUint32(data, 100) == 0x00FF0000) &&
+             (readUint32(data, 104) == 0xFF000000))
+    {
+        format = std::pair(Format::Rgba8, false);
+    }
+
+    if (!format)
+    {
+        sf::err() << "Failed to load DDS file, unsupported pixel format" << std::endl;
+        return std::nullopt;
+    }
+
+    container.format = format->first;
+    container.sRgb   = format->second;
+
+    if (!isValidSize(container.size))
+    {
+        sf::err() << "Failed to load DDS file, invalid size (" << container.size.x << "x" << container.size.y << ")"
+                  << std::endl;
+        return std::nullopt;
+    }
+
+    // The levels are stored one after the other, starting with the largest
+    levelCount = std::min(levelCount, getMaxLevelCount(container.size));
+    for (std::size_t level = 0; level < levelCount; ++level)
+    {
+        if (!addLevel(container, data, size, offset))
+        {
+            sf::err() << "Failed to load DDS file, the file is truncated" << std::endl;
+            return std::nullopt;
+        }
+
+        offset += container.levels.back().size();
+    }
+
+    return container;
+}
+
+// Find the pixel format of a KTX2 file from its Vulkan format
+std::optional<std::pair<Format, bool>> getVulkanFormat(std::uint32_t vkFormat)
+{
+    switch (vkFormat)
+    {
+        case 37: // VK_FORMAT_R8G8B8A8_UNORM
+            return std::pair(Format::Rgba8, false);
+        case 43: // VK_FORMAT_R8G8B8A8_SRGB
+            return std::pair(Format::Rgba8, true);
+        case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+            return std::pair(Format::Bc1, false);
+        case 132: // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+        case 134: // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+            return std::pair(Format::Bc1, true);
+        case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+            return std::pair(Format::Bc3, false);
+        case 138: // VK_FORMAT_BC3_SRGB_BLOCK
+            return std::pair(Format::Bc3, true);
+        case 145: // VK_FORMAT_BC7_UNORM_BLOCK
+            return std::pair(Format::Bc7, false);
+        case 146: // VK_FORMAT_BC7_SRGB_BLOCK
+            return std::pair(Format::Bc7, true);
+        case 147: // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+            return std::pair(Format::Etc2Rgb, false);
+        case 148: // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+            return std::pair(Format::Etc2Rgb, true);
+        case 151: // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+            return std::pair(Format::Etc2Rgba, false);
+        case 152: // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+            return std::pair(Format::Etc2Rgba, true);
+        case 157: // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+            return std::pair(Format::Astc4x4, false);
+        case 158: // VK_FORMAT_ASTC_4x4_SRGB_BLOCK
+            return std::pair(Format::Astc4x4, true);
+        case 165: // VK_FORMAT_ASTC_6x6_UNORM_BLOCK
+            return std::pair(Format::Astc6x6, false);
+        case 166: // VK_FORMAT_ASTC_6x6_SRGB_BLOCK
+            return std::pair(Format::Astc6x6, true);
+        case 171: // VK_FORMAT_ASTC_8x8_UNORM_BLOCK
+            return std::pair(Format::Astc8x8, false);
+        case 172: // VK_FORMAT_ASTC_8x8_SRGB_BLOCK
+            return std::pair(Format::Astc8x8, true);
+        default:
+            return std::nullopt;
+    }
+}
+
+std::optional<sf::priv::TextureContainer> loadKtx2(const std::uint8_t* data, std::size_t size)
+{
+    // Layout of the header, which is followed by the index of the levels
+    constexpr std::size_t headerEnd      = 80;
+    constexpr std::size_t levelIndexSize = 24;
+
+    if (size < headerEnd)
+    {
+        sf::err() << "Failed to load KTX2 file, invalid header" << std::endl;
+        return std::nullopt;
+    }
+
+    const std::optional<std::pair<Format, bool>> format = getVulkanFormat(readUint32(data, 12));
+    if (!format)
+    {
+        sf::err() << "Failed to load KTX2 file, unsupported pixel format" << std::endl;
+        return std::nullopt;
+    }
+
+    // Only uncompressed 2D textures are supported, not arrays, cube maps or supercompressed data
+    if ((readUint32(data, 28) != 0) || (readUint32(data, 32) > 1) || (readUint32(data, 36) != 1) ||
+        (readUint32(data, 44) != 0))
+    {
+        sf::err() << "Failed to load KTX2 file, only 2D textures without supercompression are supported" << std::endl;
+        return std::nullopt;
+    }
+
+    sf::priv::TextureContainer container;
+    container.format = format->first;
+    container.sRgb   = format->second;
+    container.size   = {readUint32(data, 20), readUint32(data, 24)};
+
+    if (!isValidSize(container.size))
+    {
+        sf::err() << "Failed to load KTX2 file, invalid size (" << container.size.x << "x" << container.size.y << ")"
+                  << std::endl;
+        return std::nullopt;
+    }
+
+    // A level count of 0 asks for mipmaps to be generated, only the first level is stored then
+    const std::size_t levelCount = std::min<std::size_t>(std::max(readUint32(data, 40), 1u),
+                                                         getMaxLevelCount(container.size));
+    if (size < headerEnd + levelCount * levelIndexSize)
+    {
+        sf::err() << "Failed to load KTX2 file, the file is truncated" << std::endl;
+        return std::nullopt;
+    }
+
+    for (std::size_t level = 0; level < levelCount; ++level)
+    {
+        if (!addLevel(container, data, size, readUint64(data, headerEnd + level * levelIndexSize)))
+        {
+            sf::err() << "Failed to load KTX2 file, the file is truncated" << std::endl;
+            return std::nullopt;
+        }
+    }
+
+    return container;
+}
+
+// Expand a RGB565 color to 8 bits per component
+std::array<std::uint8_t, 4> expandColor(std::uint32_t color)
+{
+    const auto r = (color >> 11) & 0x1F;
+    const auto g = (color >> 5) & 0x3F;
+    const auto b = color & 0x1F;
+    return {static_cast<std::uint8_t>((r << 3) | (r >> 2)),
+            static_cast<std::uint8_t>((g << 2) | (g >> 4)),
+            static_cast<std::uint8_t>((b << 3) | (b >> 2)),
+            255};
+}
+
+// Decode the 8 bytes color block shared by BC1 and BC3 to 16 RGBA pixels
+void decodeColorBlock(const std::uint8_t* block, bool allowTransparency, std::array<std::uint8_t, 64>& pixels)
+{
+    const std::uint32_t color0 = block[0] | (std::uint32_t{block[1]} << 8);
+    const std::uint32_t color1 = block[2] | (std::uint32_t{block[3]} << 8);
+
+    std::array<std::array<std::uint8_t, 4>, 4> palette = {expandColor(color0), expandColor(color1), {}, {}};
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        const std::uint32_t first  = palette[0][k];
+        const std::uint32_t second = palette[1][k];
+
+        // Without transparency, the two other colors are at one and two thirds, otherwise the third is halfway
+        if ((color0 > color1) || !allowTransparency)
+        {
+            palette[2][k] = static_cast<std::uint8_t>((2 * first + second) / 3);
+            palette[3][k] = static_cast<std::uint8_t>((first + 2 * second) / 3);
+        }
+        else
+        {
+            palette[2][k] = static_cast<std::uint8_t>((first + second) / 2);
+            palette[3][k] = 0;
+        }
+    }
+    palette[2][3] = 255;
+    palette[3][3] = ((color0 > color1) || !allowTransparency) ? 255 : 0;
+
+    // Each pixel picks a color of the palette with 2 bits, starting with the lowest bits
+    const std::uint32_t indices = readUint32(block, 4);
+    for (std::size_t i = 0; i < 16; ++i)
+        std::memcpy(pixels.data() + i * 4, palette[(indices >> (i * 2)) & 3].data(), 4);
+}
+
+// Decode the 8 bytes alpha block of BC3 into the alpha of 16 RGBA pixels
+void decodeAlphaBlock(const std::uint8_t* block, std::array<std::uint8_t, 64>& pixels)
+{
+    const std::uint32_t alpha0 = block[0];
+    const std::uint32_t alpha1 = block[1];
+
+    // Interpolate 6 alpha values between the two endpoints, or 4 and add fully transparent and opaque values
+    std::array<std::uint32_t, 8> palette = {alpha0, alpha1};
+    for (std::uint32_t i = 1; i < 7; ++i)
+    {
+        if (alpha0 > alpha1)
+            palette[i + 1] = ((7 - i) * alpha0 + i * alpha1) / 7;
+        else if (i < 5)
+            palette[i + 1] = ((5 - i) * alpha0 + i * alpha1) / 5;
+    }
+    if (alpha0 <= alpha1)
+    {
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    // Each pixel picks an alpha value of the palette with 3 bits, starting with the lowest bits
+    std::uint64_t indices = 0;
+    for (std::size_t i = 0; i < 6; ++i)
+        indices |= std::uint64_t{block[2 + i]} << (i * 8);
+
+    for (std::size_t i = 0; i < 16; ++i)
+        pixels[i * 4 + 3] = static_cast<std::uint8_t>(palette[(indices >> (i * 3)) & 7]);
+}
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+bool isTextureContainer(const void* data, std::size_t size)
+{
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    return (bytes && (size >= ddsMagic.size()) && std::equal(ddsMagic.begin(), ddsMagic.end(), bytes)) ||
+           (bytes && (size >= ktx2Magic.size()) && std::equal(ktx2Magic.begin(), ktx2Magic.end(), bytes));
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<TextureContainer> loadTextureContainer(const void* data, std::size_t size)
+{
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+
+    if (!isTextureContainer(data, size))
+    {
+        err() << "Failed to load texture container, the data is not a DDS or KTX2 file" << std::endl;
+        return std::nullopt;
+    }
+
+    return (bytes[0] == ddsMagic[0]) ? loadDds(bytes, size) : loadKtx2(bytes, size);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int getCompressedInternalFormat(TextureContainer::Format format, bool sRgb)
+{
+    const FormatInfo& info = getFormatInfo(format);
+    return sRgb ? info.sRgb : info.linear;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t getLevelByteCount(TextureContainer::Format format, Vector2u size)
+{
+    const FormatInfo& info = getFormatInfo(format);
+
+    // Partial blocks at the right and bottom edges are stored whole
+    const std::size_t blocksX = (std::size_t{size.x} + info.blockSize.x - 1) / info.blockSize.x;
+    const std::size_t blocksY = (std::size_t{size.y} + info.blockSize.y - 1) / info.blockSize.y;
+    constexpr std::size_t maxByteCount = std::numeric_limits<std::size_t>::max();
+    if ((blocksX == 0) || (blocksY == 0) || (blocksX > maxByteCount / info.blockBytes / blocksY))
+        return 0;
+
+    return blocksX * blocksY * info.blockBytes;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::vector<std::uint8_t>> decompressLevel(TextureContainer::Format         format,
+                                                         Vector2u                         size,
+                                                         const std::vector<std::uint8_t>& level)
+{
+    if ((format != TextureContainer::Format::Bc1) && (format != TextureContainer::Format::Bc3))
+        return std::nullopt;
+
+    // The level must hold all its blocks, and its RGBA pixels must be addressable
+    const std::size_t byteCount = getLevelByteCount(format, size);
+    constexpr std::size_t maxByteCount = std::numeric_limits<std::size_t>::max();
+    if ((byteCount == 0) || (level.size() < byteCount) || (size.x > maxByteCount / 4 / size.y))
+        return std::nullopt;
+
+    const std::uint8_t*          data       = level.data();
+    const std::size_t            blockBytes = getFormatInfo(format).blockBytes;
+    std::vector<std::uint8_t>    pixels(std::size_t{size.x} * size.y * 4);
+    std::array<std::uint8_t, 64> block{};
+
+    for (unsigned int blockY = 0; blockY < size.y; blockY += 4)
+    {
+        for (unsigned int blockX = 0; blockX < size.x; blockX += 4)
+        {
+            // BC3 blocks start with the alpha block, followed by a color block without transparency
+            if (format == TextureContainer::Format::Bc3)
+            {
+                decodeColorBlock(data + 8, false, block);
+                decodeAlphaBlock(data, block);
+            }
+            else
+            {
+                decodeColorBlock(data, true, block);
+            }
+            data += blockBytes;
+
+            // Copy the pixels of the block that are within the level
+            for (unsigned int y = 0; (y < 4) && (blockY + y < size.y); ++y)
+            {
+                const std::size_t width  = std::min(4u, size.x - blockX) * 4;
+                const std::size_t offset = (std::size_t{blockY + y} * size.x + blockX) * 4;
+                std::memcpy(pixels.data() + offset, block.data() + y * 16, width);
+            }
+        }
+    }
+
+    return pixels;
+}
+
+} // namespace sf::priv
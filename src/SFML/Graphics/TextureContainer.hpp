@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Vector2.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Pixels of a texture stored in a DDS or KTX2 file,
+///        ready to be uploaded as is
+///
+////////////////////////////////////////////////////////////
+struct TextureContainer
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Format of the pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Format
+    {
+        Rgba8,    //!< Uncompressed 8-bit RGBA
+        Bc1,      //!< BC1 (DXT1), RGB with 1-bit alpha in 4x4 blocks of 8 bytes
+        Bc3,      //!< BC3 (DXT5), RGBA in 4x4 blocks of 16 bytes
+        Bc7,      //!< BC7, RGBA in 4x4 blocks of 16 bytes
+        Etc2Rgb,  //!< ETC2, RGB in 4x4 blocks of 8 bytes
+        Etc2Rgba, //!< ETC2 with EAC alpha, RGBA in 4x4 blocks of 16 bytes
+        Astc4x4,  //!< ASTC LDR, RGBA in 4x4 blocks of 16 bytes
+        Astc6x6,  //!< ASTC LDR, RGBA in 6x6 blocks of 16 bytes
+        Astc8x8   //!< ASTC LDR, RGBA in 8x8 blocks of 16 bytes
+    };
+
+    Format                                 format{}; //!< Format of the pixels
+    bool                                   sRgb{};   //!< Are the colors stored in sRGB space?
+    Vector2u                               size;     //!< Size of the first mipmap level, in pixels
+    std::vector<std::vector<std::uint8_t>> levels;   //!< Pixels of each mipmap level, starting with the largest
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether data starts like a DDS or KTX2 file
+///
+/// \param data Pointer to the data
+/// \param size Size of the data, in bytes
+///
+/// \return `true` if the data has the signature of a texture container
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isTextureContainer(const void* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Read the pixels of a DDS or KTX2 file in memory
+///
+/// Only 2D textures without supercompression, in one of the
+/// formats of `TextureContainer::Format`, are supported.
+///
+/// \param data Pointer to the file data in memory
+/// \param size Size of the data, in bytes
+///
+/// \return Pixels of the texture, or `std::nullopt` if the file is invalid or unsupported
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::optional<TextureContainer> loadTextureContainer(const void* data, std::size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the OpenGL internal format of compressed pixels
+///
+/// \param format Format of the pixels, other than `Rgba8`
+/// \param sRgb   `true` to get the sRGB variant of the format
+///
+/// \return OpenGL enumeration value of the compressed internal format
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] unsigned int getCompressedInternalFormat(TextureContainer::Format format, bool sRgb);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the size of a mipmap level, in bytes
+///
+/// \param format Format of the pixels
+/// \param size   Size of the level, in pixels
+///
+/// \return Size of the level data in bytes, or 0 if the size is empty or too large
+///        for its byte count to be represented
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t getLevelByteCount(TextureContainer::Format format, Vector2u size);
+
+////////////////////////////////////////////////////////////
+/// \brief Decompress a mipmap level to 8-bit RGBA pixels on the CPU
+///
+/// Only BC1 and BC3 pixels can be decompressed.
+///
+/// \param format Format of the pixels
+/// \param size   Size of the level, in pixels
+/// \param level  Compressed pixels of the level
+///
+/// \return RGBA pixels of the level, or `std::nullopt` if the format can't be
+///         decompressed or the level doesn't match its size
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::optional<std::vector<std::uint8_t>> decompressLevel(TextureContainer::Format         format,
+                                                                      Vector2u                         size,
+                                                                      const std::vector<std::uint8_t>& level);
+
+} // namespace sf::priv
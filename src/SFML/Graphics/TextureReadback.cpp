@@ -0,0 +1,368 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureReadback.hpp>
+#include <SFML/Graphics/TextureSaver.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureReadback::Impl
+{
+    // Forget the texture being read, the pixel buffer is kept for the next readback
+    void reset()
+    {
+        if (fence)
+        {
+            glCheck(GLEXT_glDeleteSync(fence));
+            fence = {};
+        }
+
+        image.reset();
+        size = {};
+    }
+
+    // Bind the pixel buffer, with a storage of at least byteCount bytes
+    bool bindBuffer(std::size_t byteCount)
+    {
+        if (!buffer)
+        {
+            glCheck(GLEXT_glGenBuffers(1, &buffer));
+
+            if (!buffer)
+            {
+                err() << "Failed to read pixels, failed to create pixel buffer" << std::endl;
+                return false;
+            }
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, buffer));
+
+        // Only grow the storage, readbacks of the same size in turn then never reallocate
+        if (byteCount > capacity)
+        {
+            glCheck(GLEXT_glBufferData(GLEXT_GL_PIXEL_PACK_BUFFER,
+                                       static_cast<GLsizeiptr>(byteCount),
+                                       nullptr,
+                                       GLEXT_GL_STREAM_READ));
+            capacity = byteCount;
+        }
+
+        return true;
+    }
+
+    // Unbind the pixel buffer and place the fence following the copy to it
+    void placeFence(Vector2u storageSize, bool rowsFlipped)
+    {
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+        // Flush so that the fence gets signaled without anyone waiting for it
+        fence = glCheck(GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+        glCheck(glFlush());
+
+        actualSize = storageSize;
+        flipped    = rowsFlipped;
+    }
+
+    // Read the pixels from the pixel buffer, waiting for the GPU if they haven't arrived yet
+    std::optional<Image> readPixels()
+    {
+        const auto           byteCount = static_cast<GLsizeiptr>(std::size_t{actualSize.x} * actualSize.y * 4);
+        std::optional<Image> result;
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, buffer));
+        const void* const data   = glCheck(
+            GLEXT_glMapBufferRange(GLEXT_GL_PIXEL_PACK_BUFFER, 0, byteCount, GLEXT_GL_MAP_READ_BIT));
+        const auto* const mapped = static_cast<const std::uint8_t*>(data);
+
+        if (mapped)
+        {
+            if ((size == actualSize) && !flipped)
+            {
+                // Texture is not padded nor flipped, we can use a direct copy
+                result.emplace(size, mapped);
+            }
+            else
+            {
+                // Copy the useful rows, starting from the last one if they are flipped vertically
+                std::vector<std::uint8_t> pixels(std::size_t{size.x} * std::size_t{size.y} * 4);
+                const std::size_t         srcPitch = std::size_t{actualSize.x} * 4;
+                const std::size_t         dstPitch = std::size_t{size.x} * 4;
+
+                for (std::size_t i = 0; i < size.y; ++i)
+                {
+                    const std::size_t srcRow = flipped ? (size.y - 1 - i) : i;
+                    std::memcpy(pixels.data() + i * dstPitch, mapped + srcRow * srcPitch, dstPitch);
+                }
+
+                result.emplace(size, pixels.data());
+            }
+
+            if (glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_PIXEL_PACK_BUFFER)) == GL_FALSE)
+            {
+                // The pixels may have been corrupted while the buffer was mapped
+                err() << "Failed to read pixels, the pixel buffer got corrupted" << std::endl;
+                result.reset();
+            }
+        }
+        else
+        {
+            err() << "Failed to read pixels, the pixel buffer couldn't be mapped" << std::endl;
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_PACK_BUFFER, 0));
+
+        reset();
+        return result;
+    }
+
+    unsigned int         buffer{};   //!< Pixel pack buffer receiving the pixels
+    std::size_t          capacity{}; //!< Size of the pixel buffer storage, in bytes
+    GLsync               fence{};    //!< Fence following the copy, null when nothing is being read
+    std::optional<Image> image;      //!< Pixels read synchronously, when asynchronous readbacks are not available
+    Vector2u             size;       //!< Size of the pixels being read
+    Vector2u             actualSize; //!< Size of the pixels in the pixel buffer, including the padding
+    bool                 flipped{};  //!< Are the rows stored bottom up in the pixel buffer?
+};
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback(const Texture& texture) : TextureReadback()
+{
+    start(texture);
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::~TextureReadback()
+{
+    if (!m_impl)
+        return;
+
+    const TransientContextLock contextLock;
+
+    m_impl->reset();
+
+    if (m_impl->buffer)
+        glCheck(GLEXT_glDeleteBuffers(1, &m_impl->buffer));
+}
+
+
+////////////////////////////////////////////////////////////
+TextureReadback::TextureReadback(TextureReadback&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TextureReadback& TextureReadback::operator=(TextureReadback&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::start(const Texture& texture)
+{
+    const TransientContextLock contextLock;
+
+    m_impl->reset();
+
+    if (!texture.m_texture)
+        return false;
+
+    m_impl->size = texture.m_size;
+
+    if (!isAvailable())
+    {
+        m_impl->image = texture.copyToImage();
+        return true;
+    }
+
+#ifndef SFML_OPENGL_ES
+
+    const std::size_t byteCount = std::size_t{texture.m_actualSize.x} * std::size_t{texture.m_actualSize.y} * 4;
+
+    if (!m_impl->bindBuffer(byteCount))
+    {
+        m_impl->size = {};
+        return false;
+    }
+
+    {
+        // Make sure that the current texture binding will be preserved
+        const priv::TextureSaver save;
+
+        // With a pixel pack buffer bound, the pixels are copied to the buffer and the call doesn't wait
+        glCheck(glBindTexture(GL_TEXTURE_2D, texture.m_texture));
+        glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+    }
+
+    m_impl->placeFence(texture.m_actualSize, texture.m_pixelsFlipped);
+
+#endif // SFML_OPENGL_ES
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::start(RenderWindow& window)
+{
+    // Draws gathered by the batching mode must reach the back buffer before it is read
+    window.flush();
+
+    if (!window.setActive(true))
+    {
+        err() << "Failed to read window, failed to activate the window" << std::endl;
+        return false;
+    }
+
+    const TransientContextLock contextLock;
+
+    m_impl->reset();
+
+    const Vector2u size = window.getSize();
+    if ((size.x == 0) || (size.y == 0))
+        return false;
+
+    m_impl->size = size;
+
+    const auto width  = static_cast<GLsizei>(size.x);
+    const auto height = static_cast<GLsizei>(size.y);
+
+    if (!isAvailable())
+    {
+        // Read the back buffer synchronously, its rows are stored bottom up
+        std::vector<std::uint8_t> pixels(std::size_t{size.x} * std::size_t{size.y} * 4);
+        glCheck(glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
+
+        m_impl->image.emplace(size, pixels.data());
+        m_impl->image->flipVertically();
+        return true;
+    }
+
+    if (!m_impl->bindBuffer(std::size_t{size.x} * std::size_t{size.y} * 4))
+    {
+        m_impl->size = {};
+        return false;
+    }
+
+    // With a pixel pack buffer bound, the pixels are copied to the buffer and the call doesn't wait
+    glCheck(glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+
+    m_impl->placeFence(size, true);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::isReady() const
+{
+    if (m_impl->image)
+        return true;
+
+    if (!m_impl->fence)
+        return false;
+
+    const TransientContextLock contextLock;
+
+    const GLenum status = glCheck(GLEXT_glClientWaitSync(m_impl->fence, 0, 0));
+    return (status == GLEXT_GL_ALREADY_SIGNALED) || (status == GLEXT_GL_CONDITION_SATISFIED);
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> TextureReadback::getImage()
+{
+    if (!isReady())
+        return std::nullopt;
+
+    return waitForImage();
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<Image> TextureReadback::waitForImage()
+{
+    if (m_impl->image)
+    {
+        std::optional<Image> image = std::exchange(m_impl->image, std::nullopt);
+        m_impl->size               = {};
+        return image;
+    }
+
+    if (!m_impl->fence)
+        return std::nullopt;
+
+    const TransientContextLock contextLock;
+
+    return m_impl->readPixels();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TextureReadback::getSize() const
+{
+    return m_impl->size;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureReadback::isAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_pixel_buffer_object && GLEXT_map_buffer_range && GLEXT_sync;
+    }();
+
+    return available;
+}
+
+} // namespace sf
@@ -0,0 +1,253 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/GLCheck.hpp>
+#include <SFML/Graphics/GLExtensions.hpp>
+#include <SFML/Graphics/StreamBuffer.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureUploader.hpp>
+
+#include <SFML/System/Err.hpp>
+
+#include <deque>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureUploader::Impl
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload that the GPU may not have finished yet
+    ///
+    ////////////////////////////////////////////////////////////
+    struct PendingUpload
+    {
+        std::uint64_t id{};    //!< Identifier of the upload
+        GLsync        fence{}; //!< Fence following the upload
+    };
+
+    // Forget the uploads that the GPU has finished, fences are signaled in order
+    void pollCompletedUploads()
+    {
+        while (!pendingUploads.empty())
+        {
+            const GLenum status = glCheck(GLEXT_glClientWaitSync(pendingUploads.front().fence, 0, 0));
+            if ((status != GLEXT_GL_ALREADY_SIGNALED) && (status != GLEXT_GL_CONDITION_SATISFIED))
+                break;
+
+            glCheck(GLEXT_glDeleteSync(pendingUploads.front().fence));
+            completedId = pendingUploads.front().id;
+            pendingUploads.pop_front();
+        }
+    }
+
+    priv::StreamBuffer         buffer{GLEXT_GL_PIXEL_UNPACK_BUFFER}; //!< Ring buffer staging the pixels
+    std::vector<std::uint8_t>  staging;        //!< Pixels of the upload when the pixel buffer can't be mapped
+    std::deque<PendingUpload>  pendingUploads; //!< Uploads that the GPU may not have finished, in submission order
+    std::uint64_t              lastId{};       //!< Identifier of the last submitted upload
+    std::uint64_t              completedId{};  //!< Identifier of the last upload known to be finished
+    bool                       mapped{};       //!< Is an upload being written?
+    std::optional<std::size_t> mappedOffset;   //!< Offset of the mapped pixels in the pixel buffer, if it's mapped
+    Vector2u                   mappedSize;     //!< Size of the pixel region being written
+};
+
+
+////////////////////////////////////////////////////////////
+TextureUploader::TextureUploader() : m_impl(std::make_unique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureUploader::~TextureUploader()
+{
+    if (!m_impl)
+        return;
+
+    const TransientContextLock contextLock;
+
+    // Release the mapping, the pixels that were being written are dropped
+    if (m_impl->mappedOffset)
+    {
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, m_impl->buffer.getNativeHandle()));
+        [[maybe_unused]] const bool unmapped = m_impl->buffer.unmap();
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+    }
+
+    for (const Impl::PendingUpload& upload : m_impl->pendingUploads)
+        glCheck(GLEXT_glDeleteSync(upload.fence));
+}
+
+
+////////////////////////////////////////////////////////////
+TextureUploader::TextureUploader(TextureUploader&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TextureUploader& TextureUploader::operator=(TextureUploader&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::uint8_t* TextureUploader::map(Vector2u size)
+{
+    assert(!m_impl->mapped && "TextureUploader::map() called while an upload is already mapped");
+
+    const std::size_t byteCount = std::size_t{size.x} * std::size_t{size.y} * 4;
+    if (byteCount == 0)
+        return nullptr;
+
+    m_impl->mappedSize = size;
+
+    if (isAvailable())
+    {
+        const TransientContextLock contextLock;
+
+        // Reserve the pixels at the end of the ring buffer and map them, without waiting for the GPU
+        if (const std::optional<std::size_t> offset = m_impl->buffer.allocate(byteCount))
+        {
+            void* const pixels = m_impl->buffer.map(*offset, byteCount);
+
+            // Don't leave the pixel buffer bound, it would affect the other texture updates
+            glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+
+            if (pixels)
+            {
+                m_impl->mapped       = true;
+                m_impl->mappedOffset = offset;
+                return static_cast<std::uint8_t*>(pixels);
+            }
+        }
+
+        err() << "Failed to map pixel buffer, falling back to a synchronous upload" << std::endl;
+    }
+
+    m_impl->staging.resize(byteCount);
+    m_impl->mapped = true;
+    return m_impl->staging.data();
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t TextureUploader::unmap(Texture& texture, Vector2u dest)
+{
+    if (!m_impl->mapped)
+        return 0;
+
+    const Vector2u                   size   = m_impl->mappedSize;
+    const std::optional<std::size_t> offset = m_impl->mappedOffset;
+    m_impl->mapped                          = false;
+    m_impl->mappedOffset.reset();
+
+    assert(dest.x + size.x <= texture.getSize().x && "Destination x coordinate is outside of texture");
+    assert(dest.y + size.y <= texture.getSize().y && "Destination y coordinate is outside of texture");
+
+    const TransientContextLock contextLock;
+
+    // Without a mapped pixel buffer, the pixels are uploaded synchronously from the staging array
+    if (!offset)
+    {
+        texture.update(m_impl->staging.data(), size, dest);
+        m_impl->completedId = ++m_impl->lastId;
+        return m_impl->lastId;
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, m_impl->buffer.getNativeHandle()));
+
+    // Unmapping fails if the storage got corrupted while the pixels were written
+    if (!m_impl->buffer.unmap())
+    {
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+        err() << "Failed to upload pixels to texture, the pixel buffer got corrupted" << std::endl;
+        return 0;
+    }
+
+    // With a pixel unpack buffer bound, the pixels pointer is an offset in the buffer
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    texture.updatePixels(reinterpret_cast<const void*>(*offset), size, dest);
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_PIXEL_UNPACK_BUFFER, 0));
+
+    const std::uint64_t id = ++m_impl->lastId;
+
+    if (GLEXT_sync)
+        m_impl->pendingUploads.push_back({id, glCheck(GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0))});
+    else
+        m_impl->completedId = id;
+
+    return id;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t TextureUploader::update(Texture& texture, const std::uint8_t* pixels, Vector2u size, Vector2u dest)
+{
+    std::uint8_t* const destination = map(size);
+    if (!destination)
+        return 0;
+
+    std::memcpy(destination, pixels, std::size_t{size.x} * std::size_t{size.y} * 4);
+    return unmap(texture, dest);
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureUploader::isComplete(std::uint64_t upload) const
+{
+    if (upload > m_impl->completedId)
+    {
+        const TransientContextLock contextLock;
+        m_impl->pollCompletedUploads();
+    }
+
+    return upload <= m_impl->completedId;
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureUploader::isAvailable()
+{
+    static const bool available = []
+    {
+        const TransientContextLock contextLock;
+
+        // Make sure that extensions are initialized
+        priv::ensureExtensionsInit();
+
+        return GLEXT_pixel_buffer_object && GLEXT_map_buffer_range;
+    }();
+
+    return available;
+}
+
+} // namespace sf
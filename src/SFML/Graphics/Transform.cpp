@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/TransformPoints.hpp>
 
 #include <SFML/System/Angle.hpp>
 
@@ -34,6 +35,13 @@
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+void Transform::transformPoints(Vector2f* points, std::size_t count) const
+{
+    priv::transformPoints(*this, count, [points](std::size_t index) -> Vector2f& { return points[index]; });
+}
+
+
 ////////////////////////////////////////////////////////////
 Transform& Transform::rotate(Angle angle)
 {
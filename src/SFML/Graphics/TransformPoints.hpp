@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Transform.hpp>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Transform many 2D points in place
+///
+/// The coefficients of the matrix are read once, outside of
+/// the loop, so that the compiler can keep them in registers
+/// and vectorize the loop. `point` gives access to the points
+/// wherever they are stored, which allows transforming the
+/// positions of vertices without extracting them first.
+///
+/// \param transform Transform to apply
+/// \param count     Number of points to transform
+/// \param point     Function returning a reference to the point at a given index
+///
+////////////////////////////////////////////////////////////
+template <typename PointAccessor>
+void transformPoints(const Transform& transform, std::size_t count, PointAccessor&& point)
+{
+    const float* matrix = transform.getMatrix();
+    const float  a      = matrix[0];
+    const float  b      = matrix[1];
+    const float  c      = matrix[4];
+    const float  d      = matrix[5];
+    const float  tx     = matrix[12];
+    const float  ty     = matrix[13];
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Vector2f& p = point(i);
+        p           = {a * p.x + c * p.y + tx, b * p.x + d * p.y + ty};
+    }
+}
+
+} // namespace sf::priv
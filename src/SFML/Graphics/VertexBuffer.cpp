@@ -33,9 +33,12 @@
 
 #include <SFML/System/Err.hpp>
 
+#include <algorithm>
 #include <ostream>
 #include <utility>
+#include <vector>
 
+#include <cassert>
 #include <cstddef>
 #include <cstring>
 
@@ -63,6 +66,34 @@ GLenum usageToGlEnum(sf::VertexBuffer::Usage usage)
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+struct VertexBuffer::Ring
+{
+    struct Storage
+    {
+        unsigned int buffer{}; //!< Buffer object identifier
+        std::size_t  size{};   //!< Size in vertices of the buffer object storage
+        GLsync       fence{};  //!< Fence following the last draws that may read the buffer object
+    };
+
+    static void destroy(const Storage& storage)
+    {
+        if (storage.fence)
+            glCheck(GLEXT_glDeleteSync(storage.fence));
+
+        if (storage.buffer)
+            glCheck(GLEXT_glDeleteBuffers(1, &storage.buffer));
+    }
+
+    std::vector<Storage> storages;  //!< Buffer objects of the ring
+    std::size_t          current{}; //!< Index of the buffer object that is drawn
+};
+
+
+////////////////////////////////////////////////////////////
+VertexBuffer::VertexBuffer() = default;
+
+
 ////////////////////////////////////////////////////////////
 VertexBuffer::VertexBuffer(PrimitiveType type) : m_primitiveType(type)
 {
@@ -85,7 +116,8 @@ VertexBuffer::VertexBuffer(PrimitiveType type, Usage usage) : m_primitiveType(ty
 VertexBuffer::VertexBuffer(const VertexBuffer& copy) :
 GlResource(copy),
 m_primitiveType(copy.m_primitiveType),
-m_usage(copy.m_usage)
+m_usage(copy.m_usage),
+m_bufferCount(copy.m_bufferCount)
 {
     if (copy.m_buffer && copy.m_size)
     {
@@ -104,7 +136,14 @@ m_usage(copy.m_usage)
 ////////////////////////////////////////////////////////////
 VertexBuffer::~VertexBuffer()
 {
-    if (m_buffer)
+    if (m_ring)
+    {
+        const TransientContextLock contextLock;
+
+        for (const Ring::Storage& storage : m_ring->storages)
+            Ring::destroy(storage);
+    }
+    else if (m_buffer)
     {
         const TransientContextLock contextLock;
 
@@ -139,6 +178,13 @@ bool VertexBuffer::create(std::size_t vertexCount)
 
     m_size = vertexCount;
 
+    // The other buffer objects of the ring are reallocated by their next update
+    if (m_ring)
+    {
+        for (Ring::Storage& storage : m_ring->storages)
+            storage.size = (storage.buffer == m_buffer) ? vertexCount : 0;
+    }
+
     return true;
 }
 
@@ -172,6 +218,15 @@ bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsig
 
     const TransientContextLock contextLock;
 
+    // Make sure that extensions are initialized
+    priv::ensureExtensionsInit();
+
+    resizeRing();
+
+    // Partial updates of the ring need to copy the vertices they don't overwrite from the previous buffer object
+    if (m_ring && ((vertexCount >= m_size) || GLEXT_copy_buffer))
+        return streamVertices(vertices, vertexCount, offset);
+
     glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
 
     // Check if we need to resize or orphan the buffer
@@ -276,6 +331,8 @@ void VertexBuffer::swap(VertexBuffer& right) noexcept
     std::swap(m_buffer, right.m_buffer);
     std::swap(m_primitiveType, right.m_primitiveType);
     std::swap(m_usage, right.m_usage);
+    std::swap(m_bufferCount, right.m_bufferCount);
+    std::swap(m_ring, right.m_ring);
 }
 
 
@@ -326,6 +383,22 @@ VertexBuffer::Usage VertexBuffer::getUsage() const
 }
 
 
+////////////////////////////////////////////////////////////
+void VertexBuffer::setBufferCount(std::size_t count)
+{
+    assert(count > 0 && "VertexBuffer::setBufferCount() count must be at least 1");
+
+    m_bufferCount = count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t VertexBuffer::getBufferCount() const
+{
+    return m_bufferCount;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool VertexBuffer::isAvailable()
 {
@@ -351,6 +424,160 @@ void VertexBuffer::draw(RenderTarget& target, RenderStates states) const
 }
 
 
+////////////////////////////////////////////////////////////
+void VertexBuffer::resizeRing()
+{
+    if ((m_ring ? m_ring->storages.size() : 1) == m_bufferCount)
+        return;
+
+    if (!m_ring)
+    {
+        m_ring = std::make_unique<Ring>();
+        m_ring->storages.push_back({m_buffer, m_size, {}});
+    }
+
+    // Move the current buffer object to the front, so that it is kept
+    std::vector<Ring::Storage>& storages = m_ring->storages;
+    std::rotate(storages.begin(), storages.begin() + static_cast<std::ptrdiff_t>(m_ring->current), storages.end());
+    m_ring->current = 0;
+
+    for (std::size_t i = m_bufferCount; i < storages.size(); ++i)
+        Ring::destroy(storages[i]);
+
+    storages.resize(m_bufferCount);
+
+    if (m_bufferCount == 1)
+        m_ring.reset();
+}
+
+
+////////////////////////////////////////////////////////////
+bool VertexBuffer::streamVertices(const Vertex* vertices, std::size_t vertexCount, unsigned int offset)
+{
+    const std::size_t previousIndex = m_ring->current;
+    const std::size_t nextIndex     = (previousIndex + 1) % m_ring->storages.size();
+    Ring::Storage&    previous      = m_ring->storages[previousIndex];
+    Ring::Storage&    next          = m_ring->storages[nextIndex];
+
+    // Without a fence, we can't tell whether the GPU is done reading the next buffer object
+    bool inUse = true;
+
+    if (!next.buffer)
+    {
+        glCheck(GLEXT_glGenBuffers(1, &next.buffer));
+
+        if (!next.buffer)
+        {
+            err() << "Could not create vertex buffer, generation failed" << std::endl;
+            return false;
+        }
+
+        inUse = false;
+    }
+    else if (next.fence)
+    {
+        const GLenum status = glCheck(GLEXT_glClientWaitSync(next.fence, 0, 0));
+        inUse = (status != GLEXT_GL_ALREADY_SIGNALED) && (status != GLEXT_GL_CONDITION_SATISFIED);
+
+        glCheck(GLEXT_glDeleteSync(next.fence));
+        next.fence = {};
+    }
+
+    // Fence the draws issued so far, they are the last ones that may read the previous buffer object
+    if (GLEXT_sync)
+    {
+        if (previous.fence)
+            glCheck(GLEXT_glDeleteSync(previous.fence));
+
+        previous.fence = glCheck(GLEXT_glFenceSync(GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    }
+
+    const std::size_t size = std::max(vertexCount, m_size);
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, next.buffer));
+
+    // Replace the storage if the GPU may still be reading it, the driver
+    // keeps the old storage alive until the GPU is done with it
+    if (inUse || (next.size != size))
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * size),
+                                   nullptr,
+                                   VertexBufferImpl::usageToGlEnum(m_usage)));
+
+        next.size = size;
+    }
+
+    // Copy the vertices that are not overwritten from the previous buffer object
+    if (vertexCount < m_size)
+    {
+        const std::size_t end = offset + vertexCount;
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, previous.buffer));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, next.buffer));
+
+        if (offset > 0)
+        {
+            glCheck(GLEXT_glCopyBufferSubData(GLEXT_GL_COPY_READ_BUFFER,
+                                              GLEXT_GL_COPY_WRITE_BUFFER,
+                                              0,
+                                              0,
+                                              static_cast<GLsizeiptr>(sizeof(Vertex) * offset)));
+        }
+
+        if (end < m_size)
+        {
+            glCheck(GLEXT_glCopyBufferSubData(GLEXT_GL_COPY_READ_BUFFER,
+                                              GLEXT_GL_COPY_WRITE_BUFFER,
+                                              static_cast<GLintptr>(sizeof(Vertex) * end),
+                                              static_cast<GLintptr>(sizeof(Vertex) * end),
+                                              static_cast<GLsizeiptr>(sizeof(Vertex) * (m_size - end))));
+        }
+
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_WRITE_BUFFER, 0));
+        glCheck(GLEXT_glBindBuffer(GLEXT_GL_COPY_READ_BUFFER, 0));
+    }
+
+    bool written = false;
+
+    if (GLEXT_map_buffer_range && (vertexCount > 0))
+    {
+        // The GPU is done with the buffer object or its storage was just replaced,
+        // so there is no need to synchronize
+        void* const destination = glCheck(
+            GLEXT_glMapBufferRange(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLintptr>(sizeof(Vertex) * offset),
+                                   static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount),
+                                   GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT |
+                                       GLEXT_GL_MAP_UNSYNCHRONIZED_BIT));
+
+        if (destination)
+        {
+            std::memcpy(destination, vertices, sizeof(Vertex) * vertexCount);
+
+            // Unmapping fails if the storage got corrupted, in which case we upload it again below
+            written = (glCheck(GLEXT_glUnmapBuffer(GLEXT_GL_ARRAY_BUFFER)) == GL_TRUE);
+        }
+    }
+
+    if (!written)
+    {
+        glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                      static_cast<GLintptrARB>(sizeof(Vertex) * offset),
+                                      static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                                      vertices));
+    }
+
+    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+
+    m_ring->current = nextIndex;
+    m_buffer        = next.buffer;
+    m_size          = size;
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void swap(VertexBuffer& left, VertexBuffer& right) noexcept
 {
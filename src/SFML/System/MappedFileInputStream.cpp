@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Exception.hpp>
+#include <SFML/System/MappedFileInputStream.hpp>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+#include <SFML/System/Win32/FileMappingImpl.hpp>
+#else
+#include <SFML/System/Unix/FileMappingImpl.hpp>
+#endif
+
+#ifdef SFML_SYSTEM_ANDROID
+#include <SFML/System/Android/Activity.hpp>
+#include <SFML/System/Android/ResourceStream.hpp>
+#endif
+
+#include <algorithm>
+#include <utility>
+
+#include <cstring>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+MappedFileInputStream::MappedFileInputStream() = default;
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream::MappedFileInputStream(const std::filesystem::path& filename)
+{
+    if (!open(filename))
+        throw sf::Exception("Failed to open mapped file input stream");
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream::~MappedFileInputStream()
+{
+    close();
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream::MappedFileInputStream(MappedFileInputStream&& right) noexcept :
+#ifdef SFML_SYSTEM_ANDROID
+m_asset(std::move(right.m_asset)),
+#endif
+m_data(std::exchange(right.m_data, nullptr)),
+m_size(std::exchange(right.m_size, 0)),
+m_offset(std::exchange(right.m_offset, 0)),
+m_isOpen(std::exchange(right.m_isOpen, false))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream& MappedFileInputStream::operator=(MappedFileInputStream&& right) noexcept
+{
+    // Catch self-moving
+    if (&right == this)
+        return *this;
+
+    close();
+
+#ifdef SFML_SYSTEM_ANDROID
+    m_asset = std::move(right.m_asset);
+#endif
+    m_data   = std::exchange(right.m_data, nullptr);
+    m_size   = std::exchange(right.m_size, 0);
+    m_offset = std::exchange(right.m_offset, 0);
+    m_isOpen = std::exchange(right.m_isOpen, false);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool MappedFileInputStream::open(const std::filesystem::path& filename)
+{
+    close();
+
+#ifdef SFML_SYSTEM_ANDROID
+    if (priv::getActivityStatesPtr() != nullptr)
+    {
+        priv::ResourceStream             stream(filename);
+        const std::optional<std::size_t> size = stream.getSize();
+        if (!size)
+            return false;
+
+        m_asset.resize(*size);
+        if (stream.read(m_asset.data(), m_asset.size()) != m_asset.size())
+        {
+            m_asset.clear();
+            return false;
+        }
+
+        m_data   = m_asset.data();
+        m_size   = m_asset.size();
+        m_isOpen = true;
+        return true;
+    }
+#endif
+
+    const std::optional<priv::FileMapping> mapping = priv::mapFileImpl(filename);
+    if (!mapping)
+        return false;
+
+    m_data   = mapping->data;
+    m_size   = mapping->size;
+    m_isOpen = true;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> MappedFileInputStream::read(void* data, std::size_t size)
+{
+    if (!m_isOpen)
+        return std::nullopt;
+
+    const std::size_t count = std::min(size, m_size - m_offset);
+    if (count > 0)
+    {
+        std::memcpy(data, m_data + m_offset, count);
+        m_offset += count;
+    }
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> MappedFileInputStream::seek(std::size_t position)
+{
+    if (!m_isOpen)
+        return std::nullopt;
+
+    m_offset = std::min(position, m_size);
+    return m_offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> MappedFileInputStream::tell()
+{
+    if (!m_isOpen)
+        return std::nullopt;
+
+    return m_offset;
+}
+
+
+////////////////////////////////////////////////////////////
+std::optional<std::size_t> MappedFileInputStream::getSize()
+{
+    if (!m_isOpen)
+        return std::nullopt;
+
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+const std::byte* MappedFileInputStream::getData() const
+{
+    return m_data;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t MappedFileInputStream::getDataSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+void MappedFileInputStream::close()
+{
+#ifdef SFML_SYSTEM_ANDROID
+    // Assets are read in memory instead of being mapped
+    const bool isMapped = m_isOpen && m_asset.empty();
+    m_asset             = {};
+#else
+    const bool isMapped = m_isOpen;
+#endif
+
+    if (isMapped)
+        priv::unmapFileImpl({m_data, m_size});
+
+    m_data   = nullptr;
+    m_size   = 0;
+    m_offset = 0;
+    m_isOpen = false;
+}
+
+} // namespace sf
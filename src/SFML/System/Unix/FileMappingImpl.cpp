@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Unix/FileMappingImpl.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <limits>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::optional<FileMapping> mapFileImpl(const std::filesystem::path& filename)
+{
+    const int file = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file == -1)
+        return std::nullopt;
+
+    std::optional<FileMapping> mapping;
+
+    struct stat status{};
+    if ((fstat(file, &status) == 0) && S_ISREG(status.st_mode) &&
+        (static_cast<std::uintmax_t>(status.st_size) <= std::numeric_limits<std::size_t>::max()))
+    {
+        const auto size = static_cast<std::size_t>(status.st_size);
+
+        // Empty files can't be mapped, but there is nothing to read from them anyway
+        if (size == 0)
+        {
+            mapping.emplace();
+        }
+        else if (void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0); data != MAP_FAILED)
+        {
+            mapping = FileMapping{static_cast<const std::byte*>(data), size};
+        }
+    }
+
+    // The mapping keeps a reference to the file, which can be closed
+    ::close(file);
+
+    return mapping;
+}
+
+
+////////////////////////////////////////////////////////////
+void unmapFileImpl(const FileMapping& mapping)
+{
+    if (mapping.data)
+        munmap(const_cast<std::byte*>(mapping.data), mapping.size);
+}
+
+} // namespace sf::priv
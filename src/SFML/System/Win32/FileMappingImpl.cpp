@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/Win32/FileMappingImpl.hpp>
+#include <SFML/System/Win32/WindowsHeader.hpp>
+
+#include <limits>
+
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+std::optional<FileMapping> mapFileImpl(const std::filesystem::path& filename)
+{
+    const HANDLE file = CreateFileW(filename.c_str(),
+                                    GENERIC_READ,
+                                    FILE_SHARE_READ,
+                                    nullptr,
+                                    OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL,
+                                    nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return std::nullopt;
+
+    std::optional<FileMapping> mapping;
+
+    LARGE_INTEGER fileSize{};
+    if (GetFileSizeEx(file, &fileSize) &&
+        (static_cast<std::uint64_t>(fileSize.QuadPart) <= std::numeric_limits<std::size_t>::max()))
+    {
+        const auto size = static_cast<std::size_t>(fileSize.QuadPart);
+
+        // Empty files can't be mapped, but there is nothing to read from them anyway
+        if (size == 0)
+        {
+            mapping.emplace();
+        }
+        else if (const HANDLE fileMapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr))
+        {
+            if (const void* data = MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0))
+                mapping = FileMapping{static_cast<const std::byte*>(data), size};
+
+            // The view keeps a reference to the mapping object, which can be closed
+            CloseHandle(fileMapping);
+        }
+    }
+
+    CloseHandle(file);
+
+    return mapping;
+}
+
+
+////////////////////////////////////////////////////////////
+void unmapFileImpl(const FileMapping& mapping)
+{
+    if (mapping.data)
+        UnmapViewOfFile(mapping.data);
+}
+
+} // namespace sf::priv
@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2024 Laurent Gomila (laurent@sfml-dev.org)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <filesystem>
+#include <optional>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Contents of a file mapped in memory
+///
+////////////////////////////////////////////////////////////
+struct FileMapping
+{
+    const std::byte* data{}; //!< First byte of the file, null if the file is empty
+    std::size_t      size{}; //!< Size of the file, in bytes
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Windows implementation of read-only file mapping
+///
+/// \param filename Path of the file to map
+///
+/// \return Mapping of the whole file, or `std::nullopt` on error
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::optional<FileMapping> mapFileImpl(const std::filesystem::path& filename);
+
+////////////////////////////////////////////////////////////
+/// \brief Windows implementation of file unmapping
+///
+/// \param mapping Mapping returned by `mapFileImpl`
+///
+////////////////////////////////////////////////////////////
+void unmapFileImpl(const FileMapping& mapping);
+
+} // namespace sf::priv
@@ -1,6 +1,7 @@
 #include <SFML/Graphics/Font.hpp>
 
 // Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include <SFML/System/Exception.hpp>
@@ -254,4 +255,181 @@ TEST_CASE("[Graphics] sf::Font", runDisplayTests())
         font.setSmooth(false);
         CHECK(!font.isSmooth());
     }
+
+    SECTION("getAtlasStatistics()")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        CHECK(font.getAtlasStatistics().pageCount == 0);
+
+        for (char32_t codePoint = U'A'; codePoint <= U'Z'; ++codePoint)
+            (void)font.getGlyph(codePoint, 16, false);
+
+        const sf::Font::AtlasStatistics statistics = font.getAtlasStatistics();
+        CHECK(statistics.pageCount == 1);
+        CHECK(statistics.glyphCount == 26);
+        CHECK(statistics.textureBytes == 128 * 128 * 4);
+        CHECK(statistics.totalPixels == 128 * 128);
+        CHECK(statistics.occupiedPixels > 0);
+        CHECK(statistics.occupiedPixels < statistics.totalPixels);
+        CHECK(statistics.evictions == 0);
+    }
+
+    SECTION("Glyph and kerning caches")
+    {
+        const sf::Font font("Graphics/tuffy.ttf");
+
+        const sf::Glyph& glyph     = font.getGlyph(U'A', 24, false);
+        const sf::Glyph& boldGlyph = font.getGlyph(U'A', 24, true);
+        CHECK(&font.getGlyph(U'A', 24, false) == &glyph);
+        CHECK(&font.getGlyph(U'A', 24, true) == &boldGlyph);
+        CHECK(&font.getGlyph(U'A', 24, false, 1) != &glyph);
+        CHECK(boldGlyph.advance > glyph.advance);
+
+        const float kerning = font.getKerning(U'A', U'V', 24);
+        (void)font.getGlyph(U'A', 36, false);
+        CHECK(font.getKerning(U'A', U'V', 24) == kerning);
+        CHECK(font.getKerning(U'A', U'V', 24, true) == font.getKerning(U'A', U'V', 24, true));
+
+        const sf::Font copy(font); // NOLINT(performance-unnecessary-copy-initialization)
+        CHECK(&copy.getGlyph(U'A', 24, false) != &glyph);
+        CHECK(copy.getGlyph(U'A', 24, false).textureRect == glyph.textureRect);
+        CHECK(copy.getKerning(U'A', U'V', 24) == kerning);
+
+        sf::Font reopened("Graphics/tuffy.ttf");
+        CHECK(reopened.hasGlyph(U'\u00E9'));
+        CHECK(!reopened.openFromFile("does/not/exist.ttf"));
+        CHECK(!reopened.hasGlyph(U'\u00E9'));
+    }
+
+    SECTION("preloadGlyphs()")
+    {
+        sf::Font       font("Graphics/tuffy.ttf");
+        const sf::Font expectedFont("Graphics/tuffy.ttf");
+
+        font.preloadGlyphs(U' ', U'~', 24);
+        for (char32_t codePoint = U' '; codePoint <= U'~'; ++codePoint)
+            (void)expectedFont.getGlyph(codePoint, 24, false);
+
+        const sf::Font::AtlasStatistics statistics = font.getAtlasStatistics();
+        CHECK(statistics.pageCount == 1);
+        CHECK(statistics.glyphCount == expectedFont.getAtlasStatistics().glyphCount);
+
+        SECTION("Glyphs match the ones loaded on demand")
+        {
+            const sf::Image image         = font.getTexture(24).copyToImage();
+            const sf::Image expectedImage = expectedFont.getTexture(24).copyToImage();
+
+            for (char32_t codePoint = U' '; codePoint <= U'~'; ++codePoint)
+            {
+                const sf::Glyph& glyph         = font.getGlyph(codePoint, 24, false);
+                const sf::Glyph& expectedGlyph = expectedFont.getGlyph(codePoint, 24, false);
+                CHECK(glyph.advance == expectedGlyph.advance);
+                CHECK(glyph.bounds == expectedGlyph.bounds);
+                REQUIRE(glyph.textureRect.size == expectedGlyph.textureRect.size);
+
+                bool samePixels = true;
+                for (int y = 0; y < glyph.textureRect.size.y; ++y)
+                {
+                    for (int x = 0; x < glyph.textureRect.size.x; ++x)
+                    {
+                        const sf::Vector2i offset(x, y);
+                        samePixels = samePixels &&
+                                     (image.getPixel(sf::Vector2u(glyph.textureRect.position + offset)) ==
+                                      expectedImage.getPixel(sf::Vector2u(expectedGlyph.textureRect.position + offset)));
+                    }
+                }
+                CHECK(samePixels);
+            }
+        }
+
+        SECTION("Loaded glyphs are skipped")
+        {
+            font.preloadGlyphs(U"ABC", 24);
+            CHECK(font.getAtlasStatistics().glyphCount == statistics.glyphCount);
+            CHECK(font.getAtlasStatistics().occupiedPixels == statistics.occupiedPixels);
+
+            font.preloadGlyphs(U"ABC", 24, true);
+            CHECK(font.getAtlasStatistics().glyphCount == statistics.glyphCount + 3);
+        }
+
+        SECTION("Invalid range")
+        {
+            font.preloadGlyphs(U'Z', U'A', 32);
+            CHECK(font.getAtlasStatistics().pageCount == 1);
+        }
+    }
+
+    SECTION("Distance field")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        CHECK(!font.isDistanceFieldEnabled());
+        font.setDistanceFieldEnabled(true);
+        CHECK(font.isDistanceFieldEnabled());
+        font.setSmooth(false);
+
+        const sf::Glyph& glyph = font.getDistanceFieldGlyph(U'I', false);
+        const sf::Glyph& rasterizedGlyph = font.getGlyph(U'I', sf::Font::DistanceFieldCharacterSize, false);
+        CHECK(glyph.advance == rasterizedGlyph.advance);
+        CHECK(glyph.bounds == rasterizedGlyph.bounds);
+        CHECK(glyph.textureRect.size == rasterizedGlyph.textureRect.size);
+        CHECK(font.getDistanceFieldKerning(U'A', U'V') ==
+              font.getKerning(U'A', U'V', sf::Font::DistanceFieldCharacterSize));
+
+        const sf::Texture& texture = font.getDistanceFieldTexture();
+        CHECK(texture.isSmooth());
+        CHECK(&texture != &font.getTexture(sf::Font::DistanceFieldCharacterSize));
+        CHECK(font.getAtlasStatistics().pageCount == 2);
+
+        // Distances are above 0.5 inside the glyph, and fade to 0 at the spread outside of it
+        const sf::Image    image  = texture.copyToImage();
+        const sf::Vector2u spread = {sf::Font::DistanceFieldSpread, sf::Font::DistanceFieldSpread};
+        const sf::Vector2u center = sf::Vector2u(glyph.textureRect.position + glyph.textureRect.size / 2);
+        CHECK(image.getPixel(center).a > 128);
+        CHECK(image.getPixel(sf::Vector2u(glyph.textureRect.position) - spread).a == 0);
+    }
+
+    SECTION("Set/get memory budget")
+    {
+        sf::Font font("Graphics/tuffy.ttf");
+        CHECK(font.getMemoryBudget() == 0);
+
+        SECTION("Least recently used pages are evicted")
+        {
+            font.setMemoryBudget(2 * 128 * 128 * 4);
+            CHECK(font.getMemoryBudget() == 2 * 128 * 128 * 4);
+
+            (void)font.getGlyph(U'A', 10, false);
+            (void)font.getGlyph(U'A', 12, false);
+            (void)font.getGlyph(U'A', 10, false);
+            (void)font.getGlyph(U'A', 14, false);
+
+            const sf::Font::AtlasStatistics statistics = font.getAtlasStatistics();
+            CHECK(statistics.pageCount == 2);
+            CHECK(statistics.textureBytes <= font.getMemoryBudget());
+            CHECK(statistics.evictions == 1);
+        }
+
+        SECTION("Full pages are emptied")
+        {
+            font.setMemoryBudget(128 * 128 * 4);
+
+            for (char32_t codePoint = U'A'; codePoint <= U'Z'; ++codePoint)
+                (void)font.getGlyph(codePoint, 48, false);
+
+            const sf::Font::AtlasStatistics statistics = font.getAtlasStatistics();
+            CHECK(statistics.pageCount == 1);
+            CHECK(statistics.textureBytes == 128 * 128 * 4);
+            CHECK(statistics.glyphCount < 26);
+            CHECK(statistics.evictions > 0);
+            CHECK(font.getGlyph(U'Z', 48, false).textureRect.size != sf::Vector2i());
+        }
+
+        SECTION("Lowering the budget evicts pages")
+        {
+            (void)font.getGlyph(U'A', 10, false);
+            (void)font.getGlyph(U'A', 12, false);
+            font.setMemoryBudget(128 * 128 * 4);
+            CHECK(font.getAtlasStatistics().pageCount == 1);
+        }
+    }
 }
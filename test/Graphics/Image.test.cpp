@@ -4,11 +4,45 @@
 #include <SFML/System/Exception.hpp>
 #include <SFML/System/FileInputStream.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <array>
 #include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+// Pixels covering all the alpha values, including fully transparent and opaque ones
+std::vector<std::uint8_t> makePixels(sf::Vector2u size, std::uint32_t seed)
+{
+    std::vector<std::uint8_t> pixels(std::size_t{size.x} * size.y * 4);
+    for (std::size_t i = 0; i < pixels.size(); ++i)
+        pixels[i] = static_cast<std::uint8_t>((i * 37 + seed * 101 + (i >> 10) * 13) % 256);
+    return pixels;
+}
+
+// Pixel by pixel alpha blending, as Image::copy used to do it
+void blendOverReference(std::vector<std::uint8_t>& dst, const std::vector<std::uint8_t>& src)
+{
+    for (std::size_t i = 0; i < dst.size(); i += 4)
+    {
+        const std::uint8_t srcAlpha = src[i + 3];
+        const std::uint8_t dstAlpha = dst[i + 3];
+        const auto         outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
+
+        dst[i + 3] = outAlpha;
+
+        for (std::size_t k = 0; k < 3; ++k)
+            dst[i + k] = outAlpha ? static_cast<std::uint8_t>(
+                                        (src[i + k] * srcAlpha + dst[i + k] * (outAlpha - srcAlpha)) / outAlpha)
+                                  : src[i + k];
+    }
+}
+} // namespace
 
 TEST_CASE("[Graphics] sf::Image")
 {
@@ -641,4 +675,188 @@ TEST_CASE("[Graphics] sf::Image")
 
         CHECK(image.getPixel(sf::Vector2u(0, 9)) == sf::Color::Green);
     }
+
+    SECTION("Blending matches the pixel by pixel loop")
+    {
+        const sf::Vector2u              size(67, 45);
+        std::vector<std::uint8_t>       expected = makePixels(size, 1);
+        const std::vector<std::uint8_t> source   = makePixels(size, 2);
+
+        // Blend over translucent pixels, then over opaque ones
+        for (const bool opaque : {false, true})
+        {
+            if (opaque)
+                for (std::size_t i = 3; i < expected.size(); i += 4)
+                    expected[i] = 255;
+
+            sf::Image       image(size, expected.data());
+            const sf::Image sourceImage(size, source.data());
+            CHECK(image.copy(sourceImage, {0, 0}, {}, true));
+
+            blendOverReference(expected, source);
+            CHECK(std::vector<std::uint8_t>(image.getPixelsPtr(), image.getPixelsPtr() + expected.size()) == expected);
+        }
+    }
+
+    SECTION("Copy scaled")
+    {
+        sf::Image source(sf::Vector2u(2, 1));
+        source.setPixel({0, 0}, sf::Color(0, 0, 0, 0));
+        source.setPixel({1, 0}, sf::Color(255, 255, 255, 255));
+
+        SECTION("Nearest")
+        {
+            sf::Image image(sf::Vector2u(4, 2), sf::Color::Red);
+            CHECK(image.copyScaled(source, {{0, 0}, {4, 2}}));
+            CHECK(image.getPixel({0, 0}) == sf::Color(0, 0, 0, 0));
+            CHECK(image.getPixel({1, 1}) == sf::Color(0, 0, 0, 0));
+            CHECK(image.getPixel({2, 0}) == sf::Color::White);
+            CHECK(image.getPixel({3, 1}) == sf::Color::White);
+        }
+
+        SECTION("Bilinear")
+        {
+            sf::Image image(sf::Vector2u(4, 1));
+            CHECK(image.copyScaled(source, {{0, 0}, {4, 1}}, {}, sf::Image::Filter::Bilinear));
+            CHECK(image.getPixel({0, 0}) == sf::Color(0, 0, 0, 0));
+            CHECK(image.getPixel({1, 0}) == sf::Color(64, 64, 64, 64));
+            CHECK(image.getPixel({2, 0}) == sf::Color(191, 191, 191, 191));
+            CHECK(image.getPixel({3, 0}) == sf::Color::White);
+        }
+
+        SECTION("Same size")
+        {
+            const sf::Vector2u              size(13, 7);
+            const std::vector<std::uint8_t> pixels = makePixels(size, 3);
+            const sf::Image                 original(size, pixels.data());
+            sf::Image                       image(size);
+            CHECK(image.copyScaled(original, {{0, 0}, sf::Vector2i(size)}, {}, sf::Image::Filter::Bilinear));
+            CHECK(std::vector<std::uint8_t>(image.getPixelsPtr(), image.getPixelsPtr() + pixels.size()) == pixels);
+        }
+
+        SECTION("Clipped")
+        {
+            sf::Image image(sf::Vector2u(2, 1), sf::Color::Red);
+            CHECK(image.copyScaled(source, {{-2, 0}, {4, 1}}));
+            CHECK(image.getPixel({0, 0}) == sf::Color::White);
+            CHECK(image.getPixel({1, 0}) == sf::Color::White);
+        }
+
+        SECTION("Invalid rectangles")
+        {
+            sf::Image image(sf::Vector2u(2, 1), sf::Color::Red);
+            CHECK(!image.copyScaled(source, {{2, 0}, {4, 1}}));
+            CHECK(!image.copyScaled(source, {{0, 0}, {0, 1}}));
+            CHECK(!image.copyScaled(source, {{0, 0}, {2, 1}}, {{1, 0}, {2, 1}}));
+            CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+        }
+    }
+
+    SECTION("Fill rectangle")
+    {
+        sf::Image image(sf::Vector2u(4, 4), sf::Color::Red);
+        image.fillRect({{-1, 1}, {3, 10}}, sf::Color::Green);
+
+        for (std::uint32_t i = 0; i < 4; ++i)
+        {
+            for (std::uint32_t j = 0; j < 4; ++j)
+            {
+                const bool filled = (i < 2) && (j >= 1);
+                CHECK(image.getPixel(sf::Vector2u(i, j)) == (filled ? sf::Color::Green : sf::Color::Red));
+            }
+        }
+    }
+
+    SECTION("Premultiply alpha")
+    {
+        sf::Image image(sf::Vector2u(3, 1));
+        image.setPixel({0, 0}, sf::Color(200, 100, 50, 128));
+        image.setPixel({1, 0}, sf::Color(200, 100, 50, 0));
+        image.setPixel({2, 0}, sf::Color(200, 100, 50, 255));
+
+        image.premultiplyAlpha();
+        CHECK(image.getPixel({0, 0}) == sf::Color(100, 50, 25, 128));
+        CHECK(image.getPixel({1, 0}) == sf::Color(0, 0, 0, 0));
+        CHECK(image.getPixel({2, 0}) == sf::Color(200, 100, 50, 255));
+
+        image.unpremultiplyAlpha();
+        CHECK(image.getPixel({0, 0}) == sf::Color(199, 100, 50, 128));
+        CHECK(image.getPixel({1, 0}) == sf::Color(0, 0, 0, 0));
+        CHECK(image.getPixel({2, 0}) == sf::Color(200, 100, 50, 255));
+    }
+
+    SECTION("Transform colors")
+    {
+        const sf::Color color(200, 100, 50, 128);
+        const sf::Color multiplier(255, 128, 0, 255);
+        const sf::Color offset(0, 10, 20, 200);
+
+        sf::Image image(sf::Vector2u(2, 2), color);
+        image.transformColors(multiplier, offset);
+        CHECK(image.getPixel({1, 1}) == color * multiplier + offset);
+
+        image.transformColors(sf::Color::White);
+        CHECK(image.getPixel({1, 1}) == color * multiplier + offset);
+    }
+}
+
+TEST_CASE("[Graphics] sf::Image benchmark", "[.benchmark]")
+{
+    const sf::Vector2u              size(1024, 1024);
+    const std::vector<std::uint8_t> source = makePixels(size, 1);
+    std::vector<std::uint8_t>       pixels = makePixels(size, 2);
+    for (std::size_t i = 3; i < pixels.size(); i += 4)
+        pixels[i] = 255;
+
+    const sf::Image sourceImage(size, source.data());
+    sf::Image       image(size, pixels.data());
+
+    BENCHMARK("Blending, pixel by pixel loop")
+    {
+        blendOverReference(pixels, source);
+        return pixels.front();
+    };
+
+    BENCHMARK("Blending, copy()")
+    {
+        return image.copy(sourceImage, {0, 0}, {}, true);
+    };
+
+    BENCHMARK("Mask, pixel by pixel loop")
+    {
+        for (std::size_t i = 0; i < pixels.size(); i += 4)
+            if ((pixels[i] == 1) && (pixels[i + 1] == 2) && (pixels[i + 2] == 3) && (pixels[i + 3] == 4))
+                pixels[i + 3] = 0;
+        return pixels.front();
+    };
+
+    BENCHMARK("Mask, createMaskFromColor()")
+    {
+        image.createMaskFromColor(sf::Color(1, 2, 3, 4));
+    };
+
+    BENCHMARK("Flip horizontally")
+    {
+        image.flipHorizontally();
+    };
+
+    BENCHMARK("Premultiply alpha")
+    {
+        image.premultiplyAlpha();
+    };
+
+    BENCHMARK("Transform colors")
+    {
+        image.transformColors(sf::Color(200, 100, 50), sf::Color(1, 2, 3));
+    };
+
+    BENCHMARK("Copy scaled, nearest")
+    {
+        return image.copyScaled(sourceImage, {{0, 0}, {700, 900}});
+    };
+
+    BENCHMARK("Copy scaled, bilinear")
+    {
+        return image.copyScaled(sourceImage, {{0, 0}, {700, 900}}, {}, sf::Image::Filter::Bilinear);
+    };
 }
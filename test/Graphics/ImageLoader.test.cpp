@@ -0,0 +1,120 @@
+#include <SFML/Graphics/ImageLoader.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Texture.hpp>
+
+#include <SFML/System/Exception.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <SystemUtil.hpp>
+#include <WindowUtil.hpp>
+#include <future>
+#include <type_traits>
+#include <vector>
+
+#include <cstdint>
+
+TEST_CASE("[Graphics] sf::ImageLoader")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::ImageLoader>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::ImageLoader>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::ImageLoader>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::ImageLoader>);
+    }
+
+    sf::ImageLoader loader(2);
+
+    SECTION("Construction")
+    {
+        CHECK(loader.getPendingUploadCount() == 0);
+        CHECK(loader.getStatistics().empty());
+    }
+
+    SECTION("loadFromFile()")
+    {
+        std::vector<std::future<sf::Image>> images;
+        for (int i = 0; i < 4; ++i)
+            images.push_back(loader.loadFromFile("Graphics/sfml-logo-big.png"));
+
+        for (auto& future : images)
+        {
+            const sf::Image image = future.get();
+            CHECK(image.getSize() == sf::Vector2u(1001, 304));
+            CHECK(image.getPixel({200, 150}) == sf::Color(144, 208, 62));
+        }
+
+        const auto statistics = loader.getStatistics();
+        REQUIRE(statistics.size() == 4);
+        CHECK(statistics[0].name == "Graphics/sfml-logo-big.png");
+        CHECK(statistics[0].decodeTime > sf::Time::Zero);
+        CHECK(statistics[0].uploadTime == sf::Time::Zero);
+        CHECK(!statistics[0].failed);
+
+        loader.clearStatistics();
+        CHECK(loader.getStatistics().empty());
+    }
+
+    SECTION("loadFromMemory()")
+    {
+        const auto                memory = loadIntoMemory("Graphics/sfml-logo-big.jpg");
+        std::vector<std::uint8_t> data(memory.size());
+        for (std::size_t i = 0; i < memory.size(); ++i)
+            data[i] = static_cast<std::uint8_t>(memory[i]);
+
+        const sf::Image image = loader.loadFromMemory(data, "logo").get();
+        CHECK(image.getSize() == sf::Vector2u(1001, 304));
+        CHECK(image.getPixel({200, 150}) == sf::Color(144, 208, 62));
+        CHECK(loader.getStatistics().at(0).name == "logo");
+    }
+
+    SECTION("Invalid file")
+    {
+        auto future = loader.loadFromFile("this/does/not/exist.jpg");
+        CHECK_THROWS_AS(future.get(), sf::Exception);
+        REQUIRE(loader.getStatistics().size() == 1);
+        CHECK(loader.getStatistics()[0].failed);
+    }
+}
+
+TEST_CASE("[Graphics] sf::ImageLoader uploads", runDisplayTests())
+{
+    sf::ImageLoader loader;
+
+    SECTION("loadToTexture()")
+    {
+        sf::Texture       texture;
+        sf::Texture       invalidTexture;
+        std::future<void> loaded  = loader.loadToTexture("Graphics/sfml-logo-big.png", texture);
+        std::future<void> invalid = loader.loadToTexture("this/does/not/exist.jpg", invalidTexture);
+        CHECK(loader.getPendingUploadCount() == 2);
+
+        // Upload the images, one per call since no time is given
+        std::size_t uploaded = 0;
+        while (loader.getPendingUploadCount() > 0)
+            uploaded += loader.processUploads(sf::Time::Zero);
+
+        CHECK(uploaded == 2);
+        CHECK_NOTHROW(loaded.get());
+        CHECK(texture.getSize() == sf::Vector2u(1001, 304));
+        CHECK_THROWS_AS(invalid.get(), sf::Exception);
+
+        const auto statistics = loader.getStatistics();
+        REQUIRE(statistics.size() == 2);
+        for (const auto& entry : statistics)
+        {
+            if (entry.name == "Graphics/sfml-logo-big.png")
+            {
+                CHECK(entry.decodeTime > sf::Time::Zero);
+                CHECK(!entry.failed);
+            }
+            else
+            {
+                CHECK(entry.failed);
+            }
+        }
+    }
+}
@@ -1,13 +1,26 @@
+#include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/IndexBuffer.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/SpriteBatch.hpp>
 #include <SFML/Graphics/StencilMode.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/UniformBuffer.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
 #include <WindowUtil.hpp>
 
+#include <array>
+#include <optional>
+#include <string_view>
+
 TEST_CASE("[Graphics] Render Tests", runDisplayTests())
 {
     SECTION("Stencil Tests")
@@ -237,4 +250,420 @@ TEST_CASE("[Graphics] Render Tests", runDisplayTests())
             }
         }
     }
+
+    SECTION("Batching")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.setBatchingEnabled(true);
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.resetDrawStatistics();
+
+        sf::RectangleShape shape({50, 50});
+        shape.setFillColor(sf::Color::Green);
+        renderTexture.draw(shape);
+        shape.setPosition({50, 50});
+        renderTexture.draw(shape);
+        shape.setFillColor(sf::Color::Blue);
+        shape.setPosition({50, 0});
+        renderTexture.draw(shape);
+        CHECK(renderTexture.getDrawStatistics().drawsSubmitted == 3);
+        CHECK(renderTexture.getDrawStatistics().drawCallsIssued == 0);
+
+        renderTexture.display();
+        CHECK(renderTexture.getDrawStatistics().drawsSubmitted == 3);
+        CHECK(renderTexture.getDrawStatistics().drawCallsIssued == 1);
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 25}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 75}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 25}) == sf::Color::Blue);
+        CHECK(image.getPixel({25, 75}) == sf::Color::Red);
+
+        SECTION("Incompatible states")
+        {
+            renderTexture.resetDrawStatistics();
+            renderTexture.draw(shape);
+            renderTexture.draw(shape, sf::BlendAdd);
+            renderTexture.draw(shape);
+            renderTexture.display();
+            CHECK(renderTexture.getDrawStatistics().drawsSubmitted == 3);
+            CHECK(renderTexture.getDrawStatistics().drawCallsIssued == 3);
+        }
+    }
+
+    SECTION("Vertex cache threshold")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        sf::RectangleShape shape({50, 50});
+        shape.setPosition({25, 25});
+        shape.setFillColor(sf::Color::Green);
+
+        SECTION("Default")
+        {
+            renderTexture.draw(shape);
+            CHECK(renderTexture.getDrawStatistics().preTransformedDraws == 1);
+            CHECK(renderTexture.getDrawStatistics().preTransformedVertices == 4);
+            CHECK(renderTexture.getDrawStatistics().matrixTransformedDraws == 0);
+        }
+
+        SECTION("Always use the OpenGL matrix")
+        {
+            renderTexture.setVertexCacheThreshold(0);
+            renderTexture.draw(shape);
+            CHECK(renderTexture.getDrawStatistics().preTransformedDraws == 0);
+            CHECK(renderTexture.getDrawStatistics().matrixTransformedDraws == 1);
+            CHECK(renderTexture.getDrawStatistics().matrixTransformedVertices == 4);
+        }
+
+        SECTION("Grown cache")
+        {
+            const sf::CircleShape circle(25, 100);
+            renderTexture.setVertexCacheThreshold(1000);
+            renderTexture.draw(circle);
+            renderTexture.draw(shape);
+            CHECK(renderTexture.getDrawStatistics().preTransformedDraws == 2);
+            CHECK(renderTexture.getDrawStatistics().matrixTransformedDraws == 0);
+        }
+
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({50, 50}) == sf::Color::Green);
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({90, 90}) == sf::Color::Red);
+    }
+
+    SECTION("Sprite batch")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.resetDrawStatistics();
+
+        const sf::Texture texture(sf::Image({10, 10}, sf::Color::White));
+        sf::SpriteBatch   spriteBatch(texture);
+        spriteBatch.addInstance(sf::Transform::Identity, {{0, 0}, {10, 10}}, sf::Color::Green);
+        spriteBatch.addInstance(sf::Transform().translate({50, 50}).scale({2, 2}), {{0, 0}, {10, 10}}, sf::Color::Blue);
+        spriteBatch.addInstance(sf::Transform().translate({80, 0}), {{0, 0}, {-10, 10}}, sf::Color::Yellow);
+        spriteBatch.setPosition({10, 10});
+
+        renderTexture.draw(spriteBatch);
+        CHECK(renderTexture.getDrawStatistics().drawsSubmitted == 1);
+        CHECK(renderTexture.getDrawStatistics().drawCallsIssued == 1);
+
+        renderTexture.display();
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({15, 15}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 75}) == sf::Color::Blue);
+        CHECK(image.getPixel({95, 15}) == sf::Color::Yellow);
+        CHECK(image.getPixel({5, 5}) == sf::Color::Red);
+        CHECK(image.getPixel({45, 45}) == sf::Color::Red);
+    }
+
+    SECTION("Streamed vertex buffer")
+    {
+        if (!sf::VertexBuffer::isAvailable())
+            return;
+
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        std::array vertices = {sf::Vertex{{25, 25}, sf::Color::Green},
+                               sf::Vertex{{75, 25}, sf::Color::Green},
+                               sf::Vertex{{75, 75}, sf::Color::Green},
+                               sf::Vertex{{25, 25}, sf::Color::Green},
+                               sf::Vertex{{75, 75}, sf::Color::Green},
+                               sf::Vertex{{25, 75}, sf::Color::Green}};
+
+        sf::VertexBuffer vertexBuffer(sf::PrimitiveType::Triangles);
+        vertexBuffer.setBufferCount(2);
+        REQUIRE(vertexBuffer.create(vertices.size()));
+        REQUIRE(vertexBuffer.update(vertices.data()));
+
+        // Only the first triangle is updated, the second one must be kept
+        for (std::size_t i = 0; i < 3; ++i)
+            vertices[i].color = sf::Color::Blue;
+        REQUIRE(vertexBuffer.update(vertices.data(), 3, 0));
+
+        renderTexture.draw(vertexBuffer);
+        renderTexture.display();
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({70, 30}) == sf::Color::Blue);
+        CHECK(image.getPixel({30, 70}) == sf::Color::Green);
+        CHECK(image.getPixel({10, 10}) == sf::Color::Red);
+    }
+
+    SECTION("Indexed drawing")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.resetDrawStatistics();
+
+        const std::array vertices = {sf::Vertex{{25, 25}, sf::Color::Green},
+                                     sf::Vertex{{75, 25}, sf::Color::Green},
+                                     sf::Vertex{{75, 75}, sf::Color::Green},
+                                     sf::Vertex{{25, 75}, sf::Color::Green}};
+        constexpr std::array<std::uint16_t, 6> indices = {0, 1, 2, 0, 2, 3};
+
+        SECTION("Client-side indices")
+        {
+            renderTexture.draw(vertices.data(),
+                               vertices.size(),
+                               indices.data(),
+                               indices.size(),
+                               sf::PrimitiveType::Triangles);
+            CHECK(renderTexture.getDrawStatistics().drawsSubmitted == 1);
+            CHECK(renderTexture.getDrawStatistics().drawCallsIssued == 1);
+
+            // Indices past the end of the vertices are rejected
+            renderTexture.draw(vertices.data(), 3, indices.data(), indices.size(), sf::PrimitiveType::Triangles);
+            CHECK(renderTexture.getDrawStatistics().drawsSubmitted == 1);
+        }
+
+        SECTION("Batched")
+        {
+            renderTexture.setBatchingEnabled(true);
+            renderTexture.draw(vertices.data(),
+                               vertices.size(),
+                               indices.data(),
+                               indices.size(),
+                               sf::PrimitiveType::Triangles);
+            renderTexture.draw(vertices.data(),
+                               vertices.size(),
+                               indices.data(),
+                               indices.size(),
+                               sf::PrimitiveType::Triangles);
+            renderTexture.display();
+            CHECK(renderTexture.getDrawStatistics().drawsSubmitted == 2);
+            CHECK(renderTexture.getDrawStatistics().drawCallsIssued == 1);
+        }
+
+        SECTION("Vertex and index buffers")
+        {
+            if (!sf::IndexBuffer::isAvailable())
+                return;
+
+            sf::VertexBuffer vertexBuffer(sf::PrimitiveType::Triangles);
+            REQUIRE(vertexBuffer.create(vertices.size()));
+            REQUIRE(vertexBuffer.update(vertices.data()));
+
+            sf::IndexBuffer indexBuffer;
+            REQUIRE(indexBuffer.create(indices.size()));
+            REQUIRE(indexBuffer.update(indices.data()));
+
+            renderTexture.draw(vertexBuffer, indexBuffer);
+            CHECK(renderTexture.getDrawStatistics().drawsSubmitted == 1);
+            CHECK(renderTexture.getDrawStatistics().drawCallsIssued == 1);
+        }
+
+        renderTexture.display();
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({30, 70}) == sf::Color::Green);
+        CHECK(image.getPixel({70, 30}) == sf::Color::Green);
+        CHECK(image.getPixel({10, 10}) == sf::Color::Red);
+        CHECK(image.getPixel({90, 90}) == sf::Color::Red);
+    }
+
+    SECTION("State change statistics")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        const std::array vertices = {sf::Vertex{{25, 25}, sf::Color::Green},
+                                     sf::Vertex{{75, 25}, sf::Color::Green},
+                                     sf::Vertex{{25, 75}, sf::Color::Green},
+                                     sf::Vertex{{75, 75}, sf::Color::Green}};
+        renderTexture.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TriangleStrip);
+        renderTexture.resetDrawStatistics();
+
+        // Nothing changed since the first draw
+        renderTexture.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TriangleStrip);
+        CHECK(renderTexture.getDrawStatistics().textureBinds == 0);
+        CHECK(renderTexture.getDrawStatistics().textureBindsSkipped == 1);
+        CHECK(renderTexture.getDrawStatistics().blendModeChanges == 0);
+        CHECK(renderTexture.getDrawStatistics().blendModeChangesSkipped == 1);
+        CHECK(renderTexture.getDrawStatistics().stencilModeChangesSkipped == 1);
+        CHECK(renderTexture.getDrawStatistics().viewChanges == 0);
+        CHECK(renderTexture.getDrawStatistics().viewChangesSkipped == 1);
+        CHECK(renderTexture.getDrawStatistics().bytesUploaded == sizeof(sf::Vertex) * vertices.size());
+
+        renderTexture.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TriangleStrip, sf::BlendAdd);
+        CHECK(renderTexture.getDrawStatistics().blendModeChanges == 1);
+        CHECK(renderTexture.getDrawStatistics().bytesUploaded == 2 * sizeof(sf::Vertex) * vertices.size());
+
+        renderTexture.setView(sf::View(sf::FloatRect({0, 0}, {50, 50})));
+        renderTexture.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TriangleStrip, sf::BlendAdd);
+        CHECK(renderTexture.getDrawStatistics().viewChanges == 1);
+    }
+
+    SECTION("Timers")
+    {
+        sf::RenderTexture renderTexture({100, 100});
+        CHECK(!renderTexture.getTimerResults("frame").has_value());
+
+        // Ending a region that was never started does nothing
+        renderTexture.endTimer();
+
+        for (int frame = 0; frame < 3; ++frame)
+        {
+            renderTexture.beginTimer("frame");
+            renderTexture.clear(sf::Color::Red);
+            renderTexture.draw(sf::RectangleShape({50, 50}));
+            renderTexture.endTimer();
+            renderTexture.display();
+        }
+
+        const std::optional results = renderTexture.getTimerResults("frame");
+        REQUIRE(results.has_value());
+        CHECK(results->cpuTime >= sf::Time::Zero);
+        if (!sf::RenderTarget::isGpuTimerAvailable())
+            CHECK(!results->gpuTime.has_value());
+        CHECK(!renderTexture.getTimerResults("other").has_value());
+    }
+
+    SECTION("Shader binding cache")
+    {
+        if (!sf::Shader::isAvailable())
+            return;
+
+        sf::Shader shader(std::string_view("uniform vec4 color;\nvoid main()\n{\n    gl_FragColor = color;\n}"),
+                          sf::Shader::Type::Fragment);
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.resetDrawStatistics();
+
+        sf::RectangleShape shape({50, 50});
+        shader.setUniform("color", sf::Glsl::Vec4(sf::Color::Green));
+        renderTexture.draw(shape, &shader);
+
+        // Uniforms changed while the shader stays bound still apply
+        shader.setUniform("color", sf::Glsl::Vec4(sf::Color::Blue));
+        shape.setPosition({50, 0});
+        renderTexture.draw(shape, &shader);
+        CHECK(renderTexture.getDrawStatistics().shaderBinds == 1);
+        CHECK(renderTexture.getDrawStatistics().shaderBindsSkipped == 1);
+        CHECK(renderTexture.getDrawStatistics().shaderCallsSkipped == 2);
+
+        // Drawing without a shader unbinds it
+        shape.setPosition({0, 50});
+        renderTexture.draw(shape);
+        shape.setPosition({50, 50});
+        renderTexture.draw(shape, &shader);
+        CHECK(renderTexture.getDrawStatistics().shaderBinds == 2);
+        CHECK(renderTexture.getDrawStatistics().shaderBindsSkipped == 1);
+
+        renderTexture.display();
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 25}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 25}) == sf::Color::Blue);
+        CHECK(image.getPixel({25, 75}) == sf::Color::White);
+        CHECK(image.getPixel({75, 75}) == sf::Color::Blue);
+    }
+
+    SECTION("Uniform handles")
+    {
+        if (!sf::Shader::isAvailable())
+            return;
+
+        sf::Shader shader(std::string_view("uniform vec4 color;\nvoid main()\n{\n    gl_FragColor = color;\n}"),
+                          sf::Shader::Type::Fragment);
+        const std::optional color = shader.getUniformHandle("color");
+        REQUIRE(color);
+
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        sf::RectangleShape shape({50, 100});
+        shader.setUniform(*color, sf::Glsl::Vec4(sf::Color::Green));
+        renderTexture.draw(shape, &shader);
+        shader.setUniform(*color, sf::Glsl::Vec4(sf::Color::Blue));
+        shape.setPosition({50, 0});
+        renderTexture.draw(shape, &shader);
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 50}) == sf::Color::Blue);
+    }
+
+    SECTION("Uniform buffer")
+    {
+        if (!sf::UniformBuffer::isAvailable())
+            return;
+
+        constexpr std::string_view source = R"(#version 140
+layout(std140) uniform Colors
+{
+    vec4 color;
+};
+
+void main()
+{
+    gl_FragColor = color;
+})";
+
+        // Both shaders read the same buffer
+        sf::Shader shader1(source, sf::Shader::Type::Fragment);
+        sf::Shader shader2(source, sf::Shader::Type::Fragment);
+
+        sf::UniformBuffer buffer;
+        REQUIRE(buffer.create(sizeof(sf::Glsl::Vec4)));
+        shader1.setUniformBlock("Colors", buffer);
+        shader2.setUniformBlock("Colors", buffer);
+
+        sf::RenderTexture renderTexture({100, 100});
+        renderTexture.clear(sf::Color::Red);
+
+        sf::RectangleShape shape({50, 100});
+        const sf::Glsl::Vec4 green(sf::Color::Green);
+        REQUIRE(buffer.update(&green));
+        renderTexture.draw(shape, &shader1);
+        renderTexture.display();
+
+        const sf::Glsl::Vec4 blue(sf::Color::Blue);
+        REQUIRE(buffer.update(&blue));
+        shape.setPosition({50, 0});
+        renderTexture.draw(shape, &shader2);
+        renderTexture.display();
+
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({25, 50}) == sf::Color::Green);
+        CHECK(image.getPixel({75, 50}) == sf::Color::Blue);
+    }
+
+    SECTION("Batched distance field texts")
+    {
+        sf::RenderTexture renderTexture({200, 100});
+        renderTexture.setBatchingEnabled(true);
+        renderTexture.clear(sf::Color::Black);
+
+        sf::Font font("Graphics/tuffy.ttf");
+        font.setDistanceFieldEnabled(true);
+
+        sf::Text red(font, "I", 80);
+        red.setOutlineThickness(6);
+        red.setOutlineColor(sf::Color::Red);
+        sf::Text blue(red);
+        blue.setOutlineColor(sf::Color::Blue);
+        blue.setPosition({100, 0});
+
+        renderTexture.draw(red);
+        renderTexture.draw(blue);
+        renderTexture.display();
+
+        // Each text keeps its own outline color, even though both use the shader of the font
+        const sf::Image image = renderTexture.getTexture().copyToImage();
+        const auto      countPixels = [&image](unsigned int left, bool (*predicate)(sf::Color))
+        {
+            std::size_t count = 0;
+            for (unsigned int y = 0; y < 100; ++y)
+                for (unsigned int x = left; x < left + 100; ++x)
+                    count += predicate(image.getPixel({x, y})) ? 1 : 0;
+            return count;
+        };
+        const auto isRed  = [](sf::Color color) { return (color.r > 200) && (color.g < 50) && (color.b < 50); };
+        const auto isBlue = [](sf::Color color) { return (color.b > 200) && (color.r < 50) && (color.g < 50); };
+        CHECK(countPixels(0, isRed) > 0);
+        CHECK(countPixels(0, isBlue) == 0);
+        CHECK(countPixels(100, isBlue) > 0);
+        CHECK(countPixels(100, isRed) == 0);
+    }
 }
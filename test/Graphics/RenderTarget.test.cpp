@@ -53,6 +53,55 @@ TEST_CASE("[Graphics] sf::RenderTarget")
         CHECK(renderTarget.getView().getSize() == sf::Vector2f(3, 4));
     }
 
+    SECTION("Set/get batching enabled")
+    {
+        RenderTarget renderTarget;
+        CHECK(!renderTarget.isBatchingEnabled());
+        renderTarget.setBatchingEnabled(true);
+        CHECK(renderTarget.isBatchingEnabled());
+        renderTarget.setBatchingEnabled(false);
+        CHECK(!renderTarget.isBatchingEnabled());
+    }
+
+    SECTION("Set/get vertex cache threshold")
+    {
+        RenderTarget renderTarget;
+        CHECK(renderTarget.getVertexCacheThreshold() == 4);
+        renderTarget.setVertexCacheThreshold(0);
+        CHECK(renderTarget.getVertexCacheThreshold() == 0);
+        renderTarget.setVertexCacheThreshold(1024);
+        CHECK(renderTarget.getVertexCacheThreshold() == 1024);
+    }
+
+    SECTION("getDrawStatistics()")
+    {
+        const RenderTarget renderTarget;
+        CHECK(renderTarget.getDrawStatistics().drawsSubmitted == 0);
+        CHECK(renderTarget.getDrawStatistics().drawCallsIssued == 0);
+        CHECK(renderTarget.getDrawStatistics().preTransformedDraws == 0);
+        CHECK(renderTarget.getDrawStatistics().preTransformedVertices == 0);
+        CHECK(renderTarget.getDrawStatistics().matrixTransformedDraws == 0);
+        CHECK(renderTarget.getDrawStatistics().matrixTransformedVertices == 0);
+        CHECK(renderTarget.getDrawStatistics().shaderBinds == 0);
+        CHECK(renderTarget.getDrawStatistics().shaderBindsSkipped == 0);
+        CHECK(renderTarget.getDrawStatistics().shaderCallsSkipped == 0);
+        CHECK(renderTarget.getDrawStatistics().textureBinds == 0);
+        CHECK(renderTarget.getDrawStatistics().textureBindsSkipped == 0);
+        CHECK(renderTarget.getDrawStatistics().blendModeChanges == 0);
+        CHECK(renderTarget.getDrawStatistics().blendModeChangesSkipped == 0);
+        CHECK(renderTarget.getDrawStatistics().stencilModeChanges == 0);
+        CHECK(renderTarget.getDrawStatistics().stencilModeChangesSkipped == 0);
+        CHECK(renderTarget.getDrawStatistics().viewChanges == 0);
+        CHECK(renderTarget.getDrawStatistics().viewChangesSkipped == 0);
+        CHECK(renderTarget.getDrawStatistics().bytesUploaded == 0);
+    }
+
+    SECTION("getTimerResults()")
+    {
+        const RenderTarget renderTarget;
+        CHECK(!renderTarget.getTimerResults("frame").has_value());
+    }
+
     SECTION("setActive()")
     {
         RenderTarget renderTarget;
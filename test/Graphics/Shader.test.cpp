@@ -6,6 +6,8 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+#include <filesystem>
 #include <type_traits>
 
 namespace
@@ -167,6 +169,14 @@ TEST_CASE("[Graphics] sf::Shader (Dummy Implementation)", skipShaderDummyTests()
         CHECK_FALSE(shader.loadFromMemory(vertexSource, fragmentSource));
         CHECK_FALSE(shader.loadFromMemory(vertexSource, geometrySource, fragmentSource));
     }
+
+    SECTION("loadManyFromMemory()")
+    {
+        sf::Shader                      shader;
+        const sf::Shader::MemorySources sources{&shader, vertexSource, {}, fragmentSource};
+        CHECK(sf::Shader::loadManyFromMemory(&sources, 1) == 0);
+        CHECK_FALSE(sf::Shader::isProgramCacheAvailable());
+    }
 }
 
 TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
@@ -390,6 +400,16 @@ TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
         }
     }
 
+    SECTION("getUniformHandle()")
+    {
+        sf::Shader shader;
+        CHECK(!shader.getUniformHandle("blink_alpha"));
+
+        REQUIRE(shader.loadFromMemory(fragmentSource, sf::Shader::Type::Fragment));
+        CHECK(shader.getUniformHandle("blink_alpha"));
+        CHECK(!shader.getUniformHandle("missing"));
+    }
+
     SECTION("loadFromFile()")
     {
         sf::Shader shader;
@@ -435,6 +455,41 @@ TEST_CASE("[Graphics] sf::Shader", skipShaderFullTests())
         CHECK(static_cast<bool>(shader.getNativeHandle()) == sf::Shader::isAvailable());
     }
 
+    SECTION("loadManyFromMemory()")
+    {
+        sf::Shader                                     first;
+        sf::Shader                                     second;
+        sf::Shader                                     invalid;
+        const std::array<sf::Shader::MemorySources, 3> sources = {{{&first, vertexSource, {}, fragmentSource},
+                                                                   {&invalid, {}, geometrySource, {}},
+                                                                   {&second, {}, {}, fragmentSource}}};
+        CHECK(sf::Shader::loadManyFromMemory(sources.data(), sources.size()) == (sf::Shader::isAvailable() ? 2 : 0));
+        CHECK(static_cast<bool>(first.getNativeHandle()) == sf::Shader::isAvailable());
+        CHECK(static_cast<bool>(second.getNativeHandle()) == sf::Shader::isAvailable());
+        CHECK(invalid.getNativeHandle() == 0);
+    }
+
+    SECTION("Program cache")
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "sfml-program-cache-test";
+        std::filesystem::remove_all(directory);
+
+        CHECK(sf::Shader::getProgramCacheDirectory().empty());
+        sf::Shader::setProgramCacheDirectory(directory);
+        CHECK(sf::Shader::getProgramCacheDirectory() == directory);
+
+        // The second load reads the program saved by the first one
+        sf::Shader shader;
+        CHECK(shader.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+        CHECK(std::filesystem::exists(directory) == sf::Shader::isProgramCacheAvailable());
+        CHECK(shader.loadFromMemory(vertexSource, fragmentSource) == sf::Shader::isAvailable());
+        CHECK(shader.getUniformHandle("storm_position").has_value() == sf::Shader::isAvailable());
+
+        sf::Shader::setProgramCacheDirectory({});
+        CHECK(sf::Shader::getProgramCacheDirectory().empty());
+        std::filesystem::remove_all(directory);
+    }
+
     SECTION("loadFromStream()")
     {
         sf::Shader          shader;
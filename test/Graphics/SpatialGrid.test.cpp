@@ -0,0 +1,177 @@
+#include <SFML/Graphics/SpatialGrid.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/View.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+std::vector<std::size_t> query(const sf::SpatialGrid& grid, const sf::FloatRect& area)
+{
+    std::vector<std::size_t> ids;
+    grid.query(area, ids);
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::SpatialGrid")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SpatialGrid>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SpatialGrid>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SpatialGrid>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SpatialGrid>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::SpatialGrid grid;
+            CHECK(grid.getCellSize() == sf::Vector2f(256, 256));
+            CHECK(grid.getObjectCount() == 0);
+            CHECK(!grid.contains(0));
+        }
+
+        SECTION("Cell size constructor")
+        {
+            const sf::SpatialGrid grid({32, 64});
+            CHECK(grid.getCellSize() == sf::Vector2f(32, 64));
+            CHECK(grid.getObjectCount() == 0);
+        }
+    }
+
+    SECTION("insert()")
+    {
+        sf::SpatialGrid   grid({10, 10});
+        const std::size_t first  = grid.insert({{0, 0}, {5, 5}});
+        const std::size_t second = grid.insert({{15, 15}, {20, 20}});
+        CHECK(first != second);
+        CHECK(grid.getObjectCount() == 2);
+        CHECK(grid.contains(first));
+        CHECK(grid.contains(second));
+        CHECK(grid.getBounds(second) == sf::FloatRect({15, 15}, {20, 20}));
+
+        // Negative sizes are normalized
+        const std::size_t flipped = grid.insert({{30, 30}, {-10, -10}});
+        CHECK(grid.getBounds(flipped) == sf::FloatRect({20, 20}, {10, 10}));
+        CHECK(query(grid, {{25, 25}, {1, 1}}) == std::vector<std::size_t>{second, flipped});
+        CHECK(query(grid, {{26, 26}, {-2, -2}}) == std::vector<std::size_t>{second, flipped});
+    }
+
+    SECTION("remove()")
+    {
+        sf::SpatialGrid   grid({10, 10});
+        const std::size_t first  = grid.insert({{0, 0}, {5, 5}});
+        const std::size_t second = grid.insert({{0, 0}, {30, 30}});
+        grid.remove(first);
+        CHECK(grid.getObjectCount() == 1);
+        CHECK(!grid.contains(first));
+        CHECK(query(grid, {{0, 0}, {100, 100}}) == std::vector<std::size_t>{second});
+
+        // Identifiers of removed objects are reused
+        CHECK(grid.insert({{50, 50}, {5, 5}}) == first);
+    }
+
+    SECTION("clear()")
+    {
+        sf::SpatialGrid grid;
+        (void)grid.insert({{0, 0}, {5, 5}});
+        (void)grid.insert({{-1e9f, -1e9f}, {2e9f, 2e9f}});
+        grid.clear();
+        CHECK(grid.getObjectCount() == 0);
+        CHECK(query(grid, {{-100, -100}, {200, 200}}).empty());
+    }
+
+    SECTION("query()")
+    {
+        sf::SpatialGrid   grid({10, 10});
+        const std::size_t small    = grid.insert({{2, 2}, {3, 3}});
+        const std::size_t spanning = grid.insert({{-15, -15}, {40, 40}});
+        const std::size_t negative = grid.insert({{-8, -8}, {2, 2}});
+        const std::size_t huge     = grid.insert({{-1e6f, -1e6f}, {2e6f, 2e6f}});
+        const std::size_t far      = grid.insert({{1000, 1000}, {5, 5}});
+
+        SECTION("Area")
+        {
+            CHECK(query(grid, {{0, 0}, {10, 10}}) == std::vector<std::size_t>{small, spanning, huge});
+            CHECK(query(grid, {{-10, -10}, {5, 5}}) == std::vector<std::size_t>{spanning, negative, huge});
+            CHECK(query(grid, {{990, 990}, {20, 20}}) == std::vector<std::size_t>{huge, far});
+            CHECK(query(grid, {{2e6f, 2e6f}, {10, 10}}).empty());
+        }
+
+        SECTION("Objects aligned on the cells")
+        {
+            sf::SpatialGrid   tiles({10, 10});
+            const std::size_t left  = tiles.insert({{0, 0}, {10, 10}});
+            const std::size_t right = tiles.insert({{10, 0}, {10, 10}});
+            CHECK(query(tiles, {{0, 0}, {10, 10}}) == std::vector<std::size_t>{left});
+            CHECK(query(tiles, {{10, 0}, {10, 10}}) == std::vector<std::size_t>{right});
+            CHECK(query(tiles, {{5, 5}, {10, 1}}) == std::vector<std::size_t>{left, right});
+        }
+
+        SECTION("Objects spanning several cells are reported once")
+        {
+            CHECK(query(grid, {{-20, -20}, {60, 60}}) == std::vector<std::size_t>{small, spanning, negative, huge});
+        }
+
+        SECTION("Area covering many empty cells")
+        {
+            CHECK(query(grid, {{-1e5f, -1e5f}, {2e5f, 2e5f}}) ==
+                  std::vector<std::size_t>{small, spanning, negative, huge, far});
+        }
+
+        SECTION("Results are appended")
+        {
+            std::vector<std::size_t> ids = {42};
+            grid.query(sf::FloatRect({1000, 1000}, {1, 1}), ids);
+            std::sort(ids.begin(), ids.end());
+            CHECK(ids == std::vector<std::size_t>{huge, far, 42});
+        }
+
+        SECTION("View")
+        {
+            std::vector<std::size_t> ids;
+            grid.query(sf::View({1000, 1000}, {20, 20}), ids);
+            std::sort(ids.begin(), ids.end());
+            CHECK(ids == std::vector<std::size_t>{huge, far});
+        }
+    }
+
+    SECTION("update()")
+    {
+        sf::SpatialGrid   grid({10, 10});
+        const std::size_t id = grid.insert({{2, 2}, {3, 3}});
+
+        SECTION("Within the same cells")
+        {
+            grid.update(id, {{4, 4}, {3, 3}});
+            CHECK(grid.getBounds(id) == sf::FloatRect({4, 4}, {3, 3}));
+            CHECK(query(grid, {{3, 3}, {1, 1}}).empty());
+            CHECK(query(grid, {{5, 5}, {1, 1}}) == std::vector<std::size_t>{id});
+        }
+
+        SECTION("To other cells")
+        {
+            grid.update(id, {{52, 52}, {3, 3}});
+            CHECK(query(grid, {{0, 0}, {10, 10}}).empty());
+            CHECK(query(grid, {{50, 50}, {10, 10}}) == std::vector<std::size_t>{id});
+        }
+
+        SECTION("Growing past the cells")
+        {
+            grid.update(id, {{-1e4f, -1e4f}, {2e4f, 2e4f}});
+            CHECK(query(grid, {{5000, 5000}, {1, 1}}) == std::vector<std::size_t>{id});
+            grid.update(id, {{2, 2}, {3, 3}});
+            CHECK(query(grid, {{5000, 5000}, {1, 1}}).empty());
+            CHECK(query(grid, {{0, 0}, {10, 10}}) == std::vector<std::size_t>{id});
+        }
+    }
+}
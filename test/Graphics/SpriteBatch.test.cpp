@@ -0,0 +1,119 @@
+#include <SFML/Graphics/SpriteBatch.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::SpriteBatch", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_constructible_v<sf::SpriteBatch, sf::Texture&&>);
+        STATIC_CHECK(!std::is_constructible_v<sf::SpriteBatch, const sf::Texture&&>);
+        STATIC_CHECK(std::is_copy_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::SpriteBatch>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::SpriteBatch>);
+    }
+
+    const sf::Texture texture(sf::Vector2u(64, 64));
+
+    SECTION("Construction")
+    {
+        const sf::SpriteBatch spriteBatch(texture);
+        CHECK(&spriteBatch.getTexture() == &texture);
+        CHECK(spriteBatch.getInstanceCount() == 0);
+    }
+
+    SECTION("Set/get texture")
+    {
+        sf::SpriteBatch   spriteBatch(texture);
+        const sf::Texture otherTexture(sf::Vector2u(64, 64));
+        spriteBatch.setTexture(otherTexture);
+        CHECK(&spriteBatch.getTexture() == &otherTexture);
+    }
+
+    SECTION("addInstance()")
+    {
+        sf::SpriteBatch spriteBatch(texture);
+        const auto      transform = sf::Transform().translate({10, 20}).rotate(sf::degrees(90));
+
+        CHECK(spriteBatch.addInstance(transform, {{1, 2}, {3, 4}}, sf::Color::Red) == 0);
+        CHECK(spriteBatch.addInstance(sf::Transform::Identity, {{0, 0}, {8, 8}}) == 1);
+        CHECK(spriteBatch.getInstanceCount() == 2);
+        CHECK(spriteBatch.getInstanceTransform(0) == Approx(transform));
+        CHECK(spriteBatch.getInstanceTextureRect(0) == sf::IntRect({1, 2}, {3, 4}));
+        CHECK(spriteBatch.getInstanceColor(0) == sf::Color::Red);
+        CHECK(spriteBatch.getInstanceTransform(1) == sf::Transform::Identity);
+        CHECK(spriteBatch.getInstanceColor(1) == sf::Color::White);
+
+        sf::Sprite sprite(texture, {{4, 5}, {6, 7}});
+        sprite.setPosition({30, 40});
+        sprite.setScale({2, 3});
+        sprite.setColor(sf::Color::Blue);
+        CHECK(spriteBatch.addInstance(sprite) == 2);
+        CHECK(spriteBatch.getInstanceTransform(2) == Approx(sprite.getTransform()));
+        CHECK(spriteBatch.getInstanceTextureRect(2) == sprite.getTextureRect());
+        CHECK(spriteBatch.getInstanceColor(2) == sf::Color::Blue);
+    }
+
+    SECTION("Set instance properties")
+    {
+        sf::SpriteBatch spriteBatch(texture);
+        spriteBatch.addInstance(sf::Transform::Identity, {{0, 0}, {8, 8}});
+
+        const auto transform = sf::Transform().scale({2, 2});
+        spriteBatch.setInstanceTransform(0, transform);
+        spriteBatch.setInstanceTextureRect(0, {{8, 8}, {-8, 8}});
+        spriteBatch.setInstanceColor(0, sf::Color::Green);
+        CHECK(spriteBatch.getInstanceTransform(0) == transform);
+        CHECK(spriteBatch.getInstanceTextureRect(0) == sf::IntRect({8, 8}, {-8, 8}));
+        CHECK(spriteBatch.getInstanceColor(0) == sf::Color::Green);
+    }
+
+    SECTION("removeInstance()")
+    {
+        sf::SpriteBatch spriteBatch(texture);
+        spriteBatch.addInstance(sf::Transform::Identity, {{0, 0}, {1, 1}}, sf::Color::Red);
+        spriteBatch.addInstance(sf::Transform::Identity, {{0, 0}, {2, 2}}, sf::Color::Green);
+        spriteBatch.addInstance(sf::Transform().translate({5, 5}), {{0, 0}, {3, 3}}, sf::Color::Blue);
+
+        // The last instance takes the place of the removed one
+        spriteBatch.removeInstance(0);
+        CHECK(spriteBatch.getInstanceCount() == 2);
+        CHECK(spriteBatch.getInstanceTransform(0) == sf::Transform().translate({5, 5}));
+        CHECK(spriteBatch.getInstanceTextureRect(0) == sf::IntRect({0, 0}, {3, 3}));
+        CHECK(spriteBatch.getInstanceColor(0) == sf::Color::Blue);
+        CHECK(spriteBatch.getInstanceColor(1) == sf::Color::Green);
+
+        spriteBatch.removeInstance(1);
+        CHECK(spriteBatch.getInstanceCount() == 1);
+        CHECK(spriteBatch.getInstanceColor(0) == sf::Color::Blue);
+    }
+
+    SECTION("clear()")
+    {
+        sf::SpriteBatch spriteBatch(texture);
+        spriteBatch.reserve(10);
+        spriteBatch.addInstance(sf::Transform::Identity, {{0, 0}, {1, 1}});
+        spriteBatch.clear();
+        CHECK(spriteBatch.getInstanceCount() == 0);
+    }
+
+    SECTION("Copy")
+    {
+        sf::SpriteBatch spriteBatch(texture);
+        spriteBatch.addInstance(sf::Transform::Identity, {{0, 0}, {1, 1}}, sf::Color::Red);
+
+        const sf::SpriteBatch copy(spriteBatch); // NOLINT(performance-unnecessary-copy-initialization)
+        CHECK(&copy.getTexture() == &texture);
+        CHECK(copy.getInstanceCount() == 1);
+        CHECK(copy.getInstanceColor(0) == sf::Color::Red);
+    }
+}
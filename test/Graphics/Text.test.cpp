@@ -2,6 +2,7 @@
 
 // Other 1st party headers
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Shader.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -9,6 +10,8 @@
 #include <WindowUtil.hpp>
 #include <type_traits>
 
+#include <cmath>
+
 TEST_CASE("[Graphics] sf::Text", runDisplayTests())
 {
     SECTION("Type traits")
@@ -125,6 +128,27 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         sf::Text text(font, "Fill color");
         text.setFillColor(sf::Color::Red);
         CHECK(text.getFillColor() == sf::Color::Red);
+
+        SECTION("Range of characters")
+        {
+            text.setFillColor(sf::Color::Blue, 2, 3);
+            CHECK(text.getFillColor() == sf::Color::Red);
+            CHECK(text.getFillColor(1) == sf::Color::Red);
+            CHECK(text.getFillColor(2) == sf::Color::Blue);
+            CHECK(text.getFillColor(4) == sf::Color::Blue);
+            CHECK(text.getFillColor(5) == sf::Color::Red);
+            CHECK(text.getFillColor(1'000) == sf::Color::Red);
+
+            // Kept characters keep their color, new ones get the fill color
+            text.setString("Fill me");
+            CHECK(text.getFillColor(2) == sf::Color::Blue);
+            CHECK(text.getFillColor(4) == sf::Color::Blue);
+            CHECK(text.getFillColor(5) == sf::Color::Red);
+
+            // Setting the fill color of the text resets the colors of the characters
+            text.setFillColor(sf::Color::Green);
+            CHECK(text.getFillColor(2) == sf::Color::Green);
+        }
     }
 
     SECTION("Set/get outline color")
@@ -141,6 +165,38 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         CHECK(text.getOutlineThickness() == 3.14f);
     }
 
+    SECTION("Set/get glow color")
+    {
+        sf::Text text(font);
+        text.setGlowColor(sf::Color::Yellow);
+        CHECK(text.getGlowColor() == sf::Color::Yellow);
+    }
+
+    SECTION("Set/get glow thickness")
+    {
+        sf::Text text(font);
+        CHECK(text.getGlowThickness() == 0);
+        text.setGlowThickness(2.5f);
+        CHECK(text.getGlowThickness() == 2.5f);
+    }
+
+    SECTION("Distance field")
+    {
+        sf::Font distanceFieldFont("Graphics/tuffy.ttf");
+        distanceFieldFont.setDistanceFieldEnabled(true);
+
+        const sf::Text text(distanceFieldFont, "abcdefghijklmnopqrstuvwxyz", 96);
+        const sf::Text rasterizedText(font, "abcdefghijklmnopqrstuvwxyz", 96);
+        const sf::Vector2f size           = text.getLocalBounds().size;
+        const sf::Vector2f rasterizedSize = rasterizedText.getLocalBounds().size;
+        CHECK(std::abs(size.x - rasterizedSize.x) < rasterizedSize.x * 0.05f);
+        CHECK(std::abs(size.y - rasterizedSize.y) < rasterizedSize.y * 0.05f);
+
+        // Only the distance field glyphs are loaded, whatever the character size
+        if (sf::Shader::isAvailable())
+            CHECK(distanceFieldFont.getAtlasStatistics().pageCount == 1);
+    }
+
     SECTION("findCharacterPos()")
     {
         sf::Text text(font, "\tabcdefghijklmnopqrstuvwxyz \n");
@@ -155,6 +211,34 @@ TEST_CASE("[Graphics] sf::Text", runDisplayTests())
         CHECK(text.findCharacterPos(1'000) == sf::Vector2f(120, 277));
     }
 
+    SECTION("Incremental layout")
+    {
+        const auto makeText = [&font](const sf::String& string)
+        {
+            sf::Text text(font, string, 24);
+            text.setStyle(sf::Text::Underlined);
+            text.setOutlineThickness(2);
+            return text;
+        };
+
+        sf::Text text = makeText("Hello");
+        CHECK(text.getLocalBounds() != sf::FloatRect());
+
+        // Appending to and changing the end of the string gives the same layout as a new text
+        for (const sf::String string : {"Hello world\n\tagain", "Hello world\r\n!", "Hi"})
+        {
+            text.setString(string);
+            const sf::Text newText = makeText(string);
+            CHECK(text.getLocalBounds() == newText.getLocalBounds());
+            for (std::size_t i = 0; i <= string.getSize(); ++i)
+                CHECK(text.findCharacterPos(i) == newText.findCharacterPos(i));
+        }
+
+        text.setString("");
+        CHECK(text.getLocalBounds() == sf::FloatRect());
+        CHECK(text.findCharacterPos(0) == sf::Vector2f());
+    }
+
     SECTION("Get bounds")
     {
         sf::Text text(font, "Test", 18);
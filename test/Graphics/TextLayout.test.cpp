@@ -0,0 +1,131 @@
+#include <SFML/Graphics/TextLayout.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Font.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TextLayout", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(std::is_copy_constructible_v<sf::TextLayout>);
+        STATIC_CHECK(std::is_copy_assignable_v<sf::TextLayout>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextLayout>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextLayout>);
+    }
+
+    const sf::Font font("Graphics/tuffy.ttf");
+
+    SECTION("Construction")
+    {
+        const sf::TextLayout layout;
+        CHECK(layout.getRunCount() == 0);
+        CHECK(layout.getWrapWidth() == 0);
+        CHECK(layout.getLineSpacing() == 1);
+        CHECK(layout.getLineCount() == 0);
+        CHECK(layout.getBatchCount() == 0);
+        CHECK(layout.getLocalBounds() == sf::FloatRect());
+        CHECK(layout.getGlobalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Add/get runs")
+    {
+        sf::TextLayout layout;
+        layout.addRun(font, "Hello ", 24, sf::Text::Bold, sf::Color::Red);
+
+        sf::TextLayout::Run run;
+        run.font             = &font;
+        run.string           = "world";
+        run.outlineThickness = 2;
+        layout.addRun(run);
+
+        CHECK(layout.getRunCount() == 2);
+        CHECK(layout.getRun(0).font == &font);
+        CHECK(layout.getRun(0).string == "Hello ");
+        CHECK(layout.getRun(0).characterSize == 24);
+        CHECK(layout.getRun(0).style == sf::Text::Bold);
+        CHECK(layout.getRun(0).fillColor == sf::Color::Red);
+        CHECK(layout.getRun(1).string == "world");
+        CHECK(layout.getRun(1).characterSize == 30);
+        CHECK(layout.getRun(1).outlineThickness == 2);
+
+        run.string = "there";
+        layout.setRun(1, run);
+        CHECK(layout.getRun(1).string == "there");
+
+        layout.clear();
+        CHECK(layout.getRunCount() == 0);
+        CHECK(layout.getLocalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Set/get wrap width")
+    {
+        sf::TextLayout layout;
+        layout.setWrapWidth(200);
+        CHECK(layout.getWrapWidth() == 200);
+    }
+
+    SECTION("Set/get line spacing")
+    {
+        sf::TextLayout layout;
+        layout.setLineSpacing(1.5f);
+        CHECK(layout.getLineSpacing() == 1.5f);
+    }
+
+    SECTION("Single run")
+    {
+        // A single run is laid out like a text
+        const sf::Text text(font, "Hello\nworld", 18);
+        sf::TextLayout layout;
+        layout.addRun(font, "Hello\nworld", 18);
+        CHECK(layout.getLineCount() == 2);
+        CHECK(layout.getBatchCount() == 1);
+        CHECK(layout.getLocalBounds() == text.getLocalBounds());
+
+        layout.setPosition({100, 200});
+        CHECK(layout.getGlobalBounds() ==
+              sf::FloatRect(text.getLocalBounds().position + sf::Vector2f(100, 200), text.getLocalBounds().size));
+    }
+
+    SECTION("Batches")
+    {
+        sf::TextLayout layout;
+        layout.addRun(font, "Red ", 20, sf::Text::Regular, sf::Color::Red);
+        layout.addRun(font, "bold ", 20, sf::Text::Bold, sf::Color::Green);
+        layout.addRun(font, "italic", 20, sf::Text::Italic | sf::Text::Underlined, sf::Color::Blue);
+        CHECK(layout.getBatchCount() == 1);
+
+        // Runs of another character size use another glyph texture
+        layout.addRun(font, " big", 40);
+        CHECK(layout.getBatchCount() == 2);
+        CHECK(layout.getLineCount() == 1);
+
+        // The line is as high as its largest characters
+        CHECK(layout.getLocalBounds().size.y > 20);
+    }
+
+    SECTION("Wrapping")
+    {
+        sf::TextLayout layout;
+        layout.addRun(font, "The quick brown fox jumps over the lazy dog", 20);
+        CHECK(layout.getLineCount() == 1);
+        const float width = layout.getLocalBounds().size.x;
+
+        layout.setWrapWidth(width / 2);
+        CHECK(layout.getLineCount() > 1);
+        CHECK(layout.getLocalBounds().size.x < width);
+
+        // Words wider than the wrap width are broken
+        layout.setWrapWidth(1);
+        CHECK(layout.getLineCount() == 35);
+
+        layout.setWrapWidth(0);
+        CHECK(layout.getLineCount() == 1);
+        CHECK(layout.getLocalBounds().size.x == width);
+    }
+}
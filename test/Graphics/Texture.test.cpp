@@ -12,6 +12,58 @@
 #include <WindowUtil.hpp>
 #include <array>
 #include <type_traits>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+void writeUint32(std::vector<std::uint8_t>& data, std::size_t offset, std::uint32_t value)
+{
+    for (std::size_t i = 0; i < 4; ++i)
+        data[offset + i] = static_cast<std::uint8_t>(value >> (i * 8));
+}
+
+// DDS file of 4x4 red pixels in a single BC1 block
+std::vector<std::uint8_t> makeDds()
+{
+    std::vector<std::uint8_t> data(128);
+    writeUint32(data, 0, 0x20534444); // "DDS "
+    writeUint32(data, 4, 124);
+    writeUint32(data, 12, 4);          // Height
+    writeUint32(data, 16, 4);          // Width
+    writeUint32(data, 80, 0x4);        // Pixel format given by the FourCC
+    writeUint32(data, 84, 0x31545844); // "DXT1"
+
+    // Red and black endpoints, all the pixels use the first one
+    const std::array<std::uint8_t, 8> block = {0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    data.insert(data.end(), block.begin(), block.end());
+    return data;
+}
+
+// KTX2 file of 2x2 RGBA pixels with their two mipmap levels
+std::vector<std::uint8_t> makeKtx2()
+{
+    std::vector<std::uint8_t> data = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+    data.resize(128);
+    writeUint32(data, 12, 37); // VK_FORMAT_R8G8B8A8_UNORM
+    writeUint32(data, 20, 2);  // Width
+    writeUint32(data, 24, 2);  // Height
+    writeUint32(data, 36, 1);  // Face count
+    writeUint32(data, 40, 2);  // Level count
+    writeUint32(data, 80, 128);
+    writeUint32(data, 88, 16);
+    writeUint32(data, 104, 144);
+    writeUint32(data, 112, 4);
+
+    // Red, green, blue and yellow pixels, then a gray one
+    const std::array<std::uint8_t, 20> pixels = {255, 0,   0,  255, 0,   255, 0,   255, 0,   0,
+                                                 255, 255, 255, 255, 0,  255, 128, 128, 128, 255};
+    data.insert(data.end(), pixels.begin(), pixels.end());
+    return data;
+}
+} // namespace
 
 TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
 {
@@ -234,6 +286,68 @@ TEST_CASE("[Graphics] sf::Texture", runDisplayTests())
         CHECK(texture.getNativeHandle() != 0);
     }
 
+    SECTION("loadFromMemory() texture container")
+    {
+        sf::Texture texture;
+
+        SECTION("DDS")
+        {
+            const std::vector<std::uint8_t> memory = makeDds();
+            REQUIRE(texture.loadFromMemory(memory.data(), memory.size()));
+            CHECK(texture.getSize() == sf::Vector2u(4, 4));
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+            CHECK(image.getPixel({3, 3}) == sf::Color::Red);
+        }
+
+        SECTION("KTX2")
+        {
+            const std::vector<std::uint8_t> memory = makeKtx2();
+            REQUIRE(texture.loadFromMemory(memory.data(), memory.size()));
+            CHECK(texture.getSize() == sf::Vector2u(2, 2));
+            const sf::Image image = texture.copyToImage();
+            CHECK(image.getPixel({0, 0}) == sf::Color::Red);
+            CHECK(image.getPixel({1, 0}) == sf::Color::Green);
+            CHECK(image.getPixel({0, 1}) == sf::Color::Blue);
+            CHECK(image.getPixel({1, 1}) == sf::Color::Yellow);
+        }
+
+        SECTION("Subarea")
+        {
+            const std::vector<std::uint8_t> memory = makeKtx2();
+            REQUIRE(texture.loadFromMemory(memory.data(), memory.size(), false, {{1, 0}, {1, 2}}));
+            CHECK(texture.getSize() == sf::Vector2u(1, 2));
+            CHECK(texture.copyToImage().getPixel({0, 1}) == sf::Color::Yellow);
+        }
+
+        SECTION("Truncated")
+        {
+            std::vector<std::uint8_t> memory = makeDds();
+            memory.pop_back();
+            CHECK(!texture.loadFromMemory(memory.data(), memory.size()));
+
+            memory = makeKtx2();
+            memory.resize(140);
+            CHECK(!texture.loadFromMemory(memory.data(), memory.size()));
+            CHECK(texture.getSize() == sf::Vector2u());
+        }
+
+        SECTION("Oversized")
+        {
+            std::vector<std::uint8_t> memory = makeDds();
+            writeUint32(memory, 12, 0xFFFFFFFF);
+            writeUint32(memory, 16, 0xFFFFFFFF);
+            writeUint32(memory, 84, 0x35545844); // "DXT5"
+            CHECK(!texture.loadFromMemory(memory.data(), memory.size()));
+
+            memory = makeKtx2();
+            writeUint32(memory, 20, 0x80000000);
+            writeUint32(memory, 24, 0x80000000);
+            CHECK(!texture.loadFromMemory(memory.data(), memory.size()));
+            CHECK(texture.getSize() == sf::Vector2u());
+        }
+    }
+
     SECTION("loadFromImage()")
     {
         SECTION("Empty image")
@@ -0,0 +1,146 @@
+#include <SFML/Graphics/TextureAtlas.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TextureAtlas", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TextureAtlas>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TextureAtlas>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextureAtlas>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextureAtlas>);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            const sf::TextureAtlas atlas;
+            CHECK(atlas.getTexture().getSize() == sf::Vector2u());
+            CHECK(atlas.getPadding() == 1);
+            CHECK(!atlas.isSmooth());
+            CHECK(!atlas.isFrozen());
+        }
+
+        SECTION("Padding constructor")
+        {
+            const sf::TextureAtlas atlas(4);
+            CHECK(atlas.getTexture().getSize() == sf::Vector2u());
+            CHECK(atlas.getPadding() == 4);
+        }
+    }
+
+    SECTION("add()")
+    {
+        sf::TextureAtlas atlas;
+
+        SECTION("Image")
+        {
+            const auto greenRect = atlas.add(sf::Image({10, 20}, sf::Color::Green));
+            const auto blueRect  = atlas.add(sf::Image({30, 5}, sf::Color::Blue));
+            REQUIRE(greenRect);
+            REQUIRE(blueRect);
+            CHECK(greenRect->size == sf::Vector2i(10, 20));
+            CHECK(blueRect->size == sf::Vector2i(30, 5));
+            CHECK(!greenRect->findIntersection(*blueRect));
+
+            const sf::Image image = atlas.getTexture().copyToImage();
+            CHECK(image.getPixel(sf::Vector2u(greenRect->position)) == sf::Color::Green);
+            CHECK(image.getPixel(sf::Vector2u(blueRect->position + blueRect->size - sf::Vector2i(1, 1))) ==
+                  sf::Color::Blue);
+            CHECK(image.getPixel({0, 0}) == sf::Color::Transparent);
+        }
+
+        SECTION("Pixels")
+        {
+            constexpr std::uint8_t pixels[] = {255, 0, 0, 255, 0, 255, 0, 255};
+            const auto             rect     = atlas.add(pixels, {2, 1});
+            REQUIRE(rect);
+            CHECK(rect->size == sf::Vector2i(2, 1));
+
+            const sf::Image image = atlas.getTexture().copyToImage();
+            CHECK(image.getPixel(sf::Vector2u(rect->position)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(rect->position) + sf::Vector2u(1, 0)) == sf::Color::Green);
+        }
+
+        SECTION("Growth")
+        {
+            const auto firstRect = atlas.add(sf::Image({200, 200}, sf::Color::Red));
+            REQUIRE(firstRect);
+            const sf::Vector2u initialSize = atlas.getTexture().getSize();
+
+            const auto secondRect = atlas.add(sf::Image({200, 200}, sf::Color::Green));
+            REQUIRE(secondRect);
+            CHECK(atlas.getTexture().getSize() != initialSize);
+            CHECK(!firstRect->findIntersection(*secondRect));
+
+            const sf::Image image = atlas.getTexture().copyToImage();
+            CHECK(image.getPixel(sf::Vector2u(firstRect->position)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u(secondRect->position)) == sf::Color::Green);
+
+            // The area added by the growth starts transparent
+            CHECK(image.getPixel(image.getSize() - sf::Vector2u(1, 1)) == sf::Color::Transparent);
+        }
+
+        SECTION("Too large")
+        {
+            const unsigned int maximumSize = sf::Texture::getMaximumSize();
+            CHECK(!atlas.add(nullptr, {maximumSize + 1, 1}));
+            CHECK(atlas.getTexture().getSize() == sf::Vector2u());
+        }
+
+        SECTION("Several images")
+        {
+            const std::vector<sf::Image> images = {sf::Image({10, 10}, sf::Color::Red),
+                                                   sf::Image({20, 40}, sf::Color::Green),
+                                                   sf::Image({30, 20}, sf::Color::Blue)};
+
+            const auto rects = atlas.add(images);
+            REQUIRE(rects);
+            REQUIRE(rects->size() == 3);
+            CHECK((*rects)[0].size == sf::Vector2i(10, 10));
+            CHECK((*rects)[1].size == sf::Vector2i(20, 40));
+            CHECK((*rects)[2].size == sf::Vector2i(30, 20));
+
+            const sf::Image image = atlas.getTexture().copyToImage();
+            CHECK(image.getPixel(sf::Vector2u((*rects)[0].position)) == sf::Color::Red);
+            CHECK(image.getPixel(sf::Vector2u((*rects)[1].position)) == sf::Color::Green);
+            CHECK(image.getPixel(sf::Vector2u((*rects)[2].position)) == sf::Color::Blue);
+        }
+    }
+
+    SECTION("freeze()")
+    {
+        sf::TextureAtlas atlas;
+        const auto       rect = atlas.add(sf::Image({10, 10}, sf::Color::Green));
+        REQUIRE(rect);
+
+        atlas.freeze();
+        CHECK(atlas.isFrozen());
+        CHECK(atlas.getTexture().getSize() == sf::Vector2u(11, 11));
+        CHECK(atlas.getTexture().copyToImage().getPixel(sf::Vector2u(rect->position)) == sf::Color::Green);
+        CHECK(!atlas.add(sf::Image({10, 10}, sf::Color::Green)));
+
+        atlas.clear();
+        CHECK(!atlas.isFrozen());
+        CHECK(atlas.getTexture().getSize() == sf::Vector2u());
+        CHECK(atlas.add(sf::Image({10, 10}, sf::Color::Green)));
+    }
+
+    SECTION("Set/get smooth")
+    {
+        sf::TextureAtlas atlas;
+        atlas.setSmooth(true);
+        CHECK(atlas.isSmooth());
+        CHECK(atlas.add(sf::Image({10, 10}, sf::Color::Green)));
+        CHECK(atlas.getTexture().isSmooth());
+    }
+}
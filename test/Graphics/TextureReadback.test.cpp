@@ -0,0 +1,106 @@
+#include <SFML/Graphics/TextureReadback.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <optional>
+#include <type_traits>
+
+TEST_CASE("[Graphics] sf::TextureReadback", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TextureReadback>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TextureReadback>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextureReadback>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextureReadback>);
+    }
+
+    SECTION("Construction")
+    {
+        sf::TextureReadback readback;
+        CHECK(readback.getSize() == sf::Vector2u());
+        CHECK(!readback.isReady());
+        CHECK(!readback.getImage());
+        CHECK(!readback.waitForImage());
+    }
+
+    SECTION("start()")
+    {
+        sf::TextureReadback readback;
+        CHECK(!readback.start(sf::Texture()));
+        CHECK(readback.getSize() == sf::Vector2u());
+
+        const sf::Texture texture("Graphics/sfml-logo-big.png");
+        CHECK(readback.start(texture));
+        CHECK(readback.getSize() == sf::Vector2u(1001, 304));
+    }
+
+    SECTION("getImage()")
+    {
+        const sf::Texture   texture("Graphics/sfml-logo-big.png");
+        sf::TextureReadback readback(texture);
+
+        std::optional<sf::Image> image;
+        while (!image)
+            image = readback.getImage();
+
+        CHECK(image->getSize() == sf::Vector2u(1001, 304));
+        CHECK(image->getPixel({200, 150}) == sf::Color(144, 208, 62));
+        CHECK(readback.getSize() == sf::Vector2u());
+        CHECK(!readback.getImage());
+    }
+
+    SECTION("waitForImage()")
+    {
+        // Render textures store their rows bottom up
+        sf::RenderTexture renderTexture({4, 4});
+        renderTexture.clear(sf::Color::Red);
+        sf::RectangleShape shape({4, 1});
+        shape.setFillColor(sf::Color::Green);
+        renderTexture.draw(shape);
+        renderTexture.display();
+
+        sf::TextureReadback readback(renderTexture.getTexture());
+
+        // The render texture can be modified before the pixels arrive
+        renderTexture.clear(sf::Color::Blue);
+        renderTexture.display();
+
+        const std::optional<sf::Image> image = readback.waitForImage();
+        REQUIRE(image);
+        CHECK(image->getSize() == sf::Vector2u(4, 4));
+        CHECK(image->getPixel({0, 0}) == sf::Color::Green);
+        CHECK(image->getPixel({3, 3}) == sf::Color::Red);
+        CHECK(!readback.isReady());
+    }
+
+    SECTION("Window")
+    {
+        sf::RenderWindow window(sf::VideoMode(sf::Vector2u(64, 64), 24), "Window Title");
+        window.setBatchingEnabled(true);
+        window.clear(sf::Color::Red);
+        sf::RectangleShape shape({64, 16});
+        shape.setFillColor(sf::Color::Green);
+        window.draw(shape);
+
+        // The pending batch is submitted before the back buffer is read
+        sf::TextureReadback readback;
+        REQUIRE(readback.start(window));
+        CHECK(readback.getSize() == sf::Vector2u(64, 64));
+        window.display();
+
+        const std::optional<sf::Image> image = readback.waitForImage();
+        REQUIRE(image);
+        CHECK(image->getSize() == sf::Vector2u(64, 64));
+        CHECK(image->getPixel({0, 0}) == sf::Color::Green);
+        CHECK(image->getPixel({63, 63}) == sf::Color::Red);
+    }
+}
@@ -0,0 +1,72 @@
+#include <SFML/Graphics/TextureUploader.hpp>
+
+// Other 1st party headers
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+#include <array>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("[Graphics] sf::TextureUploader", runDisplayTests())
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::TextureUploader>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::TextureUploader>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::TextureUploader>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::TextureUploader>);
+    }
+
+    sf::TextureUploader uploader;
+    sf::Texture         texture(sf::Vector2u(4, 4));
+
+    SECTION("isComplete()")
+    {
+        CHECK(uploader.isComplete(0));
+    }
+
+    SECTION("update()")
+    {
+        constexpr std::array<std::uint8_t, 8> pixels = {1, 2, 3, 4, 5, 6, 7, 8};
+        const std::uint64_t                   upload = uploader.update(texture, pixels.data(), {2, 1}, {1, 2});
+        CHECK(upload != 0);
+
+        // Reading the texture back waits for the upload
+        const sf::Image image = texture.copyToImage();
+        CHECK(image.getPixel({1, 2}) == sf::Color(1, 2, 3, 4));
+        CHECK(image.getPixel({2, 2}) == sf::Color(5, 6, 7, 8));
+
+        while (!uploader.isComplete(upload))
+        {
+        }
+        CHECK(uploader.isComplete(upload));
+    }
+
+    SECTION("map() and unmap()")
+    {
+        CHECK(uploader.map({0, 4}) == nullptr);
+        CHECK(uploader.unmap(texture) == 0);
+
+        std::uint64_t previous = 0;
+        for (std::uint8_t value = 0; value < 3; ++value)
+        {
+            std::uint8_t* const pixels = uploader.map({4, 4});
+            REQUIRE(pixels != nullptr);
+            for (std::size_t i = 0; i < 4 * 4 * 4; ++i)
+                pixels[i] = value;
+
+            const std::uint64_t upload = uploader.unmap(texture);
+            CHECK(upload > previous);
+            previous = upload;
+
+            CHECK(texture.copyToImage().getPixel({3, 3}) == sf::Color(value, value, value, value));
+        }
+    }
+}
@@ -2,10 +2,13 @@
 
 #include <SFML/System/Angle.hpp>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <GraphicsUtil.hpp>
+#include <array>
 #include <sstream>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -69,6 +72,31 @@ TEST_CASE("[Graphics] sf::Transform")
         STATIC_CHECK(transform.transformPoint({1.0f, 1.0f}) == sf::Vector2f(6.0f, 13.0f));
     }
 
+    SECTION("transformPoints()")
+    {
+        const sf::Transform transform(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f);
+        std::array<sf::Vector2f, 7> points = {{{-1.0f, -1.0f},
+                                               {0.0f, 0.0f},
+                                               {1.0f, 1.0f},
+                                               {-10.0f, 5.0f},
+                                               {2.5f, -0.5f},
+                                               {100.0f, 200.0f},
+                                               {-3.0f, 7.0f}}};
+        std::array<sf::Vector2f, points.size()> expected{};
+        for (std::size_t i = 0; i < points.size(); ++i)
+            expected[i] = transform.transformPoint(points[i]);
+
+        transform.transformPoints(points.data(), points.size());
+        for (std::size_t i = 0; i < points.size(); ++i)
+            CHECK(points[i] == Approx(expected[i]));
+
+        sf::Transform::Identity.transformPoints(points.data(), points.size());
+        for (std::size_t i = 0; i < points.size(); ++i)
+            CHECK(points[i] == Approx(expected[i]));
+
+        transform.transformPoints(nullptr, 0);
+    }
+
     SECTION("transformRect()")
     {
         STATIC_CHECK(sf::Transform::Identity.transformRect({{-200.0f, -200.0f}, {-100.0f, -100.0f}}) ==
@@ -221,3 +249,27 @@ TEST_CASE("[Graphics] sf::Transform")
         }
     }
 }
+
+TEST_CASE("[Graphics] sf::Transform benchmark", "[.benchmark]")
+{
+    sf::Transform transform;
+    transform.rotate(sf::degrees(30)).scale({2.0f, 3.0f}).translate({10.0f, 20.0f});
+
+    for (const std::size_t count : {4u, 64u, 1024u, 65536u})
+    {
+        std::vector<sf::Vector2f> points(count, sf::Vector2f(1.0f, 2.0f));
+
+        BENCHMARK("transformPoint() x " + std::to_string(count))
+        {
+            for (sf::Vector2f& point : points)
+                point = transform.transformPoint(point);
+            return points.front();
+        };
+
+        BENCHMARK("transformPoints() x " + std::to_string(count))
+        {
+            transform.transformPoints(points.data(), points.size());
+            return points.front();
+        };
+    }
+}
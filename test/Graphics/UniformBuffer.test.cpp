@@ -0,0 +1,74 @@
+#include <SFML/Graphics/UniformBuffer.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+// Skip these tests with [.display] because they produce flakey failures in CI when using xvfb-run
+TEST_CASE("[Graphics] sf::UniformBuffer", "[.display]")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::UniformBuffer>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::UniformBuffer>);
+    }
+
+    SECTION("Construction")
+    {
+        const sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.getSize() == 0);
+        CHECK(uniformBuffer.getNativeHandle() == 0);
+    }
+
+    // Skip tests if uniform buffers aren't available
+    if (!sf::UniformBuffer::isAvailable())
+        return;
+
+    SECTION("create()")
+    {
+        sf::UniformBuffer uniformBuffer;
+        CHECK(uniformBuffer.create(64));
+        CHECK(uniformBuffer.getSize() == 64);
+        CHECK(uniformBuffer.getNativeHandle() != 0);
+
+        const unsigned int handle = uniformBuffer.getNativeHandle();
+        CHECK(uniformBuffer.create(128));
+        CHECK(uniformBuffer.getSize() == 128);
+        CHECK(uniformBuffer.getNativeHandle() == handle);
+    }
+
+    SECTION("update()")
+    {
+        const std::array<float, 8> values{1, 2, 3, 4, 5, 6, 7, 8};
+
+        sf::UniformBuffer uniformBuffer;
+        CHECK(!uniformBuffer.update(values.data()));
+
+        REQUIRE(uniformBuffer.create(sizeof(values)));
+        CHECK(uniformBuffer.update(values.data()));
+        CHECK(uniformBuffer.update(values.data(), 16, 16));
+        CHECK(!uniformBuffer.update(nullptr));
+        CHECK(!uniformBuffer.update(values.data(), 16, 24));
+        CHECK(!uniformBuffer.update(values.data(), 16, 64));
+    }
+
+    SECTION("Move semantics")
+    {
+        sf::UniformBuffer movedBuffer;
+        REQUIRE(movedBuffer.create(64));
+        const unsigned int handle = movedBuffer.getNativeHandle();
+
+        sf::UniformBuffer uniformBuffer(std::move(movedBuffer));
+        CHECK(uniformBuffer.getSize() == 64);
+        CHECK(uniformBuffer.getNativeHandle() == handle);
+
+        sf::UniformBuffer assignedBuffer;
+        assignedBuffer = std::move(uniformBuffer);
+        CHECK(assignedBuffer.getSize() == 64);
+        CHECK(assignedBuffer.getNativeHandle() == handle);
+    }
+}
@@ -178,4 +178,40 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         vertexBuffer.setUsage(sf::VertexBuffer::Usage::Dynamic);
         CHECK(vertexBuffer.getUsage() == sf::VertexBuffer::Usage::Dynamic);
     }
+
+    SECTION("Set/get buffer count")
+    {
+        sf::VertexBuffer vertexBuffer;
+        CHECK(vertexBuffer.getBufferCount() == 1);
+        vertexBuffer.setBufferCount(3);
+        CHECK(vertexBuffer.getBufferCount() == 3);
+    }
+
+    SECTION("Streaming updates")
+    {
+        sf::VertexBuffer            vertexBuffer;
+        std::array<sf::Vertex, 128> vertices{};
+        vertexBuffer.setBufferCount(2);
+        CHECK(vertexBuffer.create(128));
+        const unsigned int firstHandle = vertexBuffer.getNativeHandle();
+
+        CHECK(vertexBuffer.update(vertices.data()));
+        const unsigned int secondHandle = vertexBuffer.getNativeHandle();
+        CHECK(secondHandle != 0);
+        CHECK(secondHandle != firstHandle);
+
+        CHECK(vertexBuffer.update(vertices.data()));
+        CHECK(vertexBuffer.getNativeHandle() == firstHandle);
+
+        CHECK(vertexBuffer.update(vertices.data(), 64, 32));
+        CHECK(vertexBuffer.getVertexCount() == 128);
+
+        CHECK(vertexBuffer.update(vertices.data(), 128, 0));
+        CHECK(vertexBuffer.getVertexCount() == 128);
+
+        vertexBuffer.setBufferCount(1);
+        const unsigned int currentHandle = vertexBuffer.getNativeHandle();
+        CHECK(vertexBuffer.update(vertices.data()));
+        CHECK(vertexBuffer.getNativeHandle() == currentHandle);
+    }
 }
@@ -0,0 +1,166 @@
+#include <SFML/System/MappedFileInputStream.hpp>
+
+// Other 1st party headers
+#include <SFML/System/Exception.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <cassert>
+
+namespace
+{
+std::filesystem::path getTemporaryFilePath()
+{
+    static int counter = 0;
+
+    std::ostringstream oss;
+    oss << "sfmlmappedtemp" << counter++ << ".tmp";
+
+    return std::filesystem::temp_directory_path() / oss.str();
+}
+
+class TemporaryFile
+{
+public:
+    // Create a temporary file with a randomly generated path, containing 'contents'.
+    explicit TemporaryFile(const std::string& contents) : m_path(getTemporaryFilePath())
+    {
+        std::ofstream ofs(m_path);
+        assert(ofs && "Stream encountered an error");
+
+        ofs << contents;
+        assert(ofs && "Stream encountered an error");
+    }
+
+    // Close and delete the generated file.
+    ~TemporaryFile()
+    {
+        [[maybe_unused]] const bool removed = std::filesystem::remove(m_path);
+        assert(removed && "m_path failed to be removed from filesystem");
+    }
+
+    // Prevent copies.
+    TemporaryFile(const TemporaryFile&) = delete;
+
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+    // Return the randomly generated path.
+    [[nodiscard]] const std::filesystem::path& getPath() const
+    {
+        return m_path;
+    }
+
+private:
+    std::filesystem::path m_path;
+};
+} // namespace
+
+TEST_CASE("[System] sf::MappedFileInputStream")
+{
+    using namespace std::string_view_literals;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!std::is_copy_constructible_v<sf::MappedFileInputStream>);
+        STATIC_CHECK(!std::is_copy_assignable_v<sf::MappedFileInputStream>);
+        STATIC_CHECK(std::is_nothrow_move_constructible_v<sf::MappedFileInputStream>);
+        STATIC_CHECK(std::is_nothrow_move_assignable_v<sf::MappedFileInputStream>);
+    }
+
+    const TemporaryFile  temporaryFile("Hello world");
+    std::array<char, 32> buffer{};
+
+    SECTION("Construction")
+    {
+        SECTION("Default constructor")
+        {
+            sf::MappedFileInputStream mappedFileInputStream;
+            CHECK(mappedFileInputStream.read(nullptr, 0) == std::nullopt);
+            CHECK(mappedFileInputStream.seek(0) == std::nullopt);
+            CHECK(mappedFileInputStream.tell() == std::nullopt);
+            CHECK(mappedFileInputStream.getSize() == std::nullopt);
+            CHECK(mappedFileInputStream.getData() == nullptr);
+            CHECK(mappedFileInputStream.getDataSize() == 0);
+        }
+
+        SECTION("File path constructor")
+        {
+            sf::MappedFileInputStream mappedFileInputStream(temporaryFile.getPath());
+            CHECK(mappedFileInputStream.read(buffer.data(), 5) == 5);
+            CHECK(mappedFileInputStream.tell() == 5);
+            CHECK(mappedFileInputStream.getSize() == 11);
+            CHECK(std::string_view(buffer.data(), 5) == "Hello"sv);
+            CHECK(mappedFileInputStream.seek(6) == 6);
+            CHECK(mappedFileInputStream.tell() == 6);
+        }
+
+        SECTION("Missing file")
+        {
+            CHECK_THROWS_AS(sf::MappedFileInputStream("does/not/exist.txt"), sf::Exception);
+        }
+    }
+
+    SECTION("Move semantics")
+    {
+        SECTION("Move constructor")
+        {
+            sf::MappedFileInputStream movedMappedFileInputStream(temporaryFile.getPath());
+            sf::MappedFileInputStream mappedFileInputStream = std::move(movedMappedFileInputStream);
+            CHECK(mappedFileInputStream.read(buffer.data(), 6) == 6);
+            CHECK(mappedFileInputStream.tell() == 6);
+            CHECK(mappedFileInputStream.getSize() == 11);
+            CHECK(std::string_view(buffer.data(), 6) == "Hello "sv);
+        }
+
+        SECTION("Move assignment")
+        {
+            sf::MappedFileInputStream movedMappedFileInputStream(temporaryFile.getPath());
+            const TemporaryFile       temporaryFile2("Hello world the sequel");
+            sf::MappedFileInputStream mappedFileInputStream(temporaryFile2.getPath());
+            mappedFileInputStream = std::move(movedMappedFileInputStream);
+            CHECK(mappedFileInputStream.read(buffer.data(), 6) == 6);
+            CHECK(mappedFileInputStream.tell() == 6);
+            CHECK(mappedFileInputStream.getSize() == 11);
+            CHECK(std::string_view(buffer.data(), 6) == "Hello "sv);
+        }
+    }
+
+    SECTION("open()")
+    {
+        sf::MappedFileInputStream mappedFileInputStream;
+        CHECK(!mappedFileInputStream.open("does/not/exist.txt"));
+        REQUIRE(mappedFileInputStream.open(temporaryFile.getPath()));
+        CHECK(mappedFileInputStream.read(buffer.data(), 32) == 11);
+        CHECK(mappedFileInputStream.read(buffer.data(), 32) == 0);
+        CHECK(mappedFileInputStream.seek(20) == 11);
+        CHECK(std::string_view(buffer.data(), 11) == "Hello world"sv);
+    }
+
+    SECTION("Empty file")
+    {
+        const TemporaryFile       emptyFile("");
+        sf::MappedFileInputStream mappedFileInputStream(emptyFile.getPath());
+        CHECK(mappedFileInputStream.read(buffer.data(), 5) == 0);
+        CHECK(mappedFileInputStream.tell() == 0);
+        CHECK(mappedFileInputStream.getSize() == 0);
+        CHECK(mappedFileInputStream.getDataSize() == 0);
+    }
+
+    SECTION("getData()")
+    {
+        const sf::MappedFileInputStream mappedFileInputStream(temporaryFile.getPath());
+        REQUIRE(mappedFileInputStream.getData() != nullptr);
+        CHECK(mappedFileInputStream.getDataSize() == 11);
+        CHECK(std::string_view(reinterpret_cast<const char*>(mappedFileInputStream.getData()),
+                               mappedFileInputStream.getDataSize()) == "Hello world"sv);
+    }
+}